@@ -345,6 +345,23 @@ static inline void sched_runq_advance(uint8_t prio)
 extern void sched_runq_callback(uint8_t prio);
 #endif
 
+#if (IS_USED(MODULE_SCHED_WAKEUP_CALLBACK)) || defined(DOXYGEN)
+/**
+ * @brief   Scheduler wakeup callback
+ *
+ * @details Function has to be provided by the user of this API.
+ *          It will be called when a thread enters a runqueue, i.e. it becomes
+ *          ready to run. It is called with interrupts disabled.
+ *
+ * @warning This API is not intended for out of tree users.
+ *          Breaking API changes will be done without notice and
+ *          without deprecation. Consider yourself warned!
+ *
+ * @param   thread    the thread woken up
+ */
+extern void sched_wakeup_callback(thread_t *thread);
+#endif
+
 /**
  * @brief   Tell if the number of threads in a runqueue is 0
  *
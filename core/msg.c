@@ -35,6 +35,7 @@
 #endif
 #include "irq.h"
 #include "cib.h"
+#include "trace.h"
 
 #define ENABLE_DEBUG 0
 #include "debug.h"
@@ -105,6 +106,8 @@ static int _msg_send(msg_t *m, kernel_pid_t target_pid, bool block,
         return -1;
     }
 
+    trace_msg_send(target_pid, m->type);
+
     thread_t *me = thread_get_active();
 
     DEBUG("msg_send() %s:%i: Sending from %" PRIkernel_pid " to %" PRIkernel_pid
@@ -188,6 +191,7 @@ int msg_send_to_self(msg_t *m)
     unsigned state = irq_disable();
 
     m->sender_pid = thread_getpid();
+    trace_msg_send(m->sender_pid, m->type);
     int res = queue_msg(thread_get_active(), m);
 
     irq_restore(state);
@@ -209,6 +213,8 @@ static int _msg_send_oneway(msg_t *m, kernel_pid_t target_pid)
         return -1;
     }
 
+    trace_msg_send(target_pid, m->type);
+
     if (target->status == STATUS_RECEIVE_BLOCKED) {
         DEBUG("%s: Direct msg copy from %" PRIkernel_pid " to %"
               PRIkernel_pid ".\n", __func__, thread_getpid(), target_pid);
@@ -287,7 +293,13 @@ int msg_send_receive(msg_t *m, msg_t *reply, kernel_pid_t target_pid)
      * overwritten if the target is not in RECEIVE_BLOCKED */
     *reply = *m;
     /* msg_send blocks until reply received */
-    return _msg_send(reply, target_pid, true, state);
+    int res = _msg_send(reply, target_pid, true, state);
+
+    if (res == 1) {
+        /* msg_reply() does not set the sender of the reply */
+        trace_msg_recv(target_pid, reply->type);
+    }
+    return res;
 }
 
 int msg_reply(msg_t *m, msg_t *reply)
@@ -311,6 +323,7 @@ int msg_reply(msg_t *m, msg_t *reply)
     /* copy msg to target */
     msg_t *target_message = (msg_t *)target->wait_data;
 
+    trace_msg_send(target->pid, reply->type);
     *target_message = *reply;
     sched_set_status(target, STATUS_PENDING);
     uint16_t target_prio = target->priority;
@@ -337,6 +350,7 @@ int msg_reply_int(msg_t *m, msg_t *reply)
 
     msg_t *target_message = (msg_t *)target->wait_data;
 
+    trace_msg_send(target->pid, reply->type);
     *target_message = *reply;
     sched_set_status(target, STATUS_PENDING);
     sched_context_switch_request = 1;
@@ -345,12 +359,22 @@ int msg_reply_int(msg_t *m, msg_t *reply)
 
 int msg_try_receive(msg_t *m)
 {
-    return _msg_receive(m, 0);
+    int res = _msg_receive(m, 0);
+
+    if (res == 1) {
+        trace_msg_recv(m->sender_pid, m->type);
+    }
+    return res;
 }
 
 int msg_receive(msg_t *m)
 {
-    return _msg_receive(m, 1);
+    int res = _msg_receive(m, 1);
+
+    if (res == 1) {
+        trace_msg_recv(m->sender_pid, m->type);
+    }
+    return res;
 }
 
 static int _msg_receive(msg_t *m, int block)
@@ -136,6 +136,43 @@ static inline uintptr_t cpu_get_caller_pc(void)
     return lr_ptr;
 }
 
+/* ARMv6-M and ARMv8-M baseline cores have no cycle counter */
+#if ((__CORTEX_M >= 3) && (__CORTEX_M != 23)) || defined(DOXYGEN)
+/**
+ * @brief   Frequency of @ref cpu_cycles_read in Hz
+ *
+ * Needs the board's `periph_conf.h`.
+ */
+#define CPU_CYCLES_FREQ     (CLOCK_CORECLOCK)
+
+/**
+ * @brief   Start the free running cycle counter of the DWT unit
+ *
+ * Provided with feature `cpu_cycle_counter`. The counter does not run while
+ * the core is sleeping.
+ */
+static inline void cpu_cycles_init(void)
+{
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+#ifdef __CORE_CM7_H_GENERIC
+    /* unlock the DWT registers */
+    DWT->LAR = 0xC5ACCE55;
+#endif
+    DWT->CYCCNT = 0;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+}
+
+/**
+ * @brief   Read the free running cycle counter
+ *
+ * @return  number of core clock cycles, wrapping around at 2^32
+ */
+static inline uint32_t cpu_cycles_read(void)
+{
+    return DWT->CYCCNT;
+}
+#endif
+
 /**
  * @brief   Put the CPU into the 'wait for event' sleep mode
  *
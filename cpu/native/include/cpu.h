@@ -45,6 +45,28 @@ __attribute__((always_inline)) static inline uintptr_t cpu_get_caller_pc(void)
     return (uintptr_t)__builtin_return_address(0);
 }
 
+/**
+ * @brief   Frequency of @ref cpu_cycles_read in Hz
+ */
+#define CPU_CYCLES_FREQ     (1000000000LU)
+
+/**
+ * @brief   Start the cycle counter, nothing to do on native
+ */
+static inline void cpu_cycles_init(void)
+{
+}
+
+/**
+ * @brief   Read the CPU time consumed by the process
+ *
+ * Provided with feature `cpu_cycle_counter`. Like the cycle counters of MCUs,
+ * this does not advance while native is sleeping.
+ *
+ * @return  CPU time in nanoseconds, wrapping around at 2^32
+ */
+uint32_t cpu_cycles_read(void);
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,104 @@
+/*
+ * Copyright (C) 2026 Mesotic SAS
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser General
+ * Public License v2.1. See the file LICENSE in the top level directory for
+ * more details.
+ */
+
+/**
+ * @defgroup    cpu_native_vtime    Virtual time on native
+ * @ingroup     cpu_native
+ * @brief       Skip idle time on native by jumping to the next timer deadline
+ *
+ * By default, the timer of native follows the monotonic clock of the host, so
+ * an application that sleeps for an hour takes an hour to run. With
+ *
+ * ```
+ * USEMODULE += native_vtime
+ * ```
+ *
+ * the timer reads the host clock plus an offset. Whenever no thread is
+ * runnable and no interrupt is pending, the idle thread adds the time left
+ * until the timer fires to that offset instead of waiting for it. Time still
+ * passes at the host rate while threads run, so run times measured in the
+ * application stay meaningful.
+ *
+ * Instances connected to a ZEP dispatcher (see @ref drivers_socket_zep) may
+ * not jump on their own, or a node would receive frames from its neighbours'
+ * past. Started with `--vtime-lockstep`, an instance only reports the time
+ * left until its next deadline to the dispatcher whenever it goes idle. Once
+ * every node is idle and no frame is in flight, `zep_dispatch -l <nodes>`
+ * grants the smallest of those times to all nodes, which jump by the same
+ * amount.
+ *
+ * The RTC and the wall clock of the host (e.g. `gettimeofday()`) are not
+ * affected.
+ *
+ * @{
+ *
+ * @file
+ * @brief       Virtual time on native
+ */
+#ifndef NATIVE_VTIME_H
+#define NATIVE_VTIME_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Callback reporting that the instance went idle
+ *
+ * @param[in] arg       argument given to @ref native_vtime_set_idle_cb
+ * @param[in] armed     true if the timer is set
+ * @param[in] left      time left until the timer fires in µs, if @p armed
+ */
+typedef void (*native_vtime_idle_cb_t)(void *arg, bool armed, uint32_t left);
+
+/**
+ * @brief   Only advance time when granted by @ref native_vtime_advance
+ *
+ * Set by the `--vtime-lockstep` command line option.
+ */
+extern bool native_vtime_lockstep;
+
+/**
+ * @brief   Sleep until the next signal, skipping to the next timer deadline
+ *
+ * Called by the idle thread in place of `pause()`, with switching disabled.
+ * Unless in lockstep mode, time jumps to the deadline of the timer if no
+ * signal is pending.
+ */
+void native_vtime_sleep(void);
+
+/**
+ * @brief   Advance the virtual time
+ *
+ * Callable from interrupt context. The timer is set again, so it fires at the
+ * same virtual time as before.
+ *
+ * @param[in] us        time to skip in µs
+ */
+void native_vtime_advance(uint32_t us);
+
+/**
+ * @brief   Set the callback called when the instance goes idle in lockstep
+ *          mode
+ *
+ * The callback runs with all signals blocked.
+ *
+ * @param[in] cb        callback, NULL to disable
+ * @param[in] arg       argument for @p cb
+ */
+void native_vtime_set_idle_cb(native_vtime_idle_cb_t cb, void *arg);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* NATIVE_VTIME_H */
+/** @} */
@@ -26,12 +26,33 @@ extern "C" {
 
 #include <stdint.h>
 #include <stdbool.h>
+
+#include "kernel_defines.h"
 #include "net/netdev.h"
 
+#include "net/ethernet.h"
 #include "net/ethernet/hdr.h"
 
 #include "net/if.h"
 
+/**
+ * @brief   Number of received frames buffered by a tap interface
+ *
+ * Only used with module `netdev_tap_rx_ring`. All frames pending on the tap
+ * are read in one go per interrupt, up to this number.
+ */
+#ifndef CONFIG_NETDEV_TAP_RX_RING_SIZE
+#define CONFIG_NETDEV_TAP_RX_RING_SIZE  (16U)
+#endif
+
+/**
+ * @brief   A buffered received frame
+ */
+typedef struct {
+    uint16_t len;                       /**< length of the frame */
+    uint8_t data[ETHERNET_FRAME_LEN];   /**< the frame */
+} netdev_tap_frame_t;
+
 /**
  * @brief tap interface state
  */
@@ -42,6 +63,14 @@ typedef struct netdev_tap {
     uint8_t addr[ETHERNET_ADDR_LEN];    /**< The MAC address of the TAP */
     bool promiscuous;                   /**< Flag for promiscuous mode */
     bool wired;                         /**< Flag for wired mode */
+#if IS_USED(MODULE_NETDEV_TAP_RX_RING) || defined(DOXYGEN)
+    /**
+     * @brief   Received frames, only with module `netdev_tap_rx_ring`
+     */
+    netdev_tap_frame_t rx_ring[CONFIG_NETDEV_TAP_RX_RING_SIZE];
+    uint8_t rx_head;                    /**< index of the oldest frame */
+    uint8_t rx_numof;                   /**< number of buffered frames */
+#endif
 } netdev_tap_t;
 
 /**
@@ -46,6 +46,27 @@
  *     |       0       |       0       |       0       |       0       |
  *     +-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
  *
+ * With module `native_vtime` and the `--vtime-lockstep` option, the node
+ * exchanges VTIME packets (ZEP type 0xFE) with the dispatcher to keep the
+ * virtual time of all nodes in lockstep (see @ref cpu_native_vtime). Such
+ * packets must not be forwarded to other nodes.
+ *
+ *     +-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
+ *     |         Preamble (EX)         |  Version (2)  |  Type  (254)  |
+ *     +-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
+ *     |      Op       |     Flags     |         Reserved (0)          |
+ *     +-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
+ *     |                          Time (µs)                            |
+ *     +-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
+ *     |                       Received packets                        |
+ *     +-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
+ *
+ * A node sends IDLE (Op 0) whenever it goes idle. If Flags has bit 0 set, Time
+ * is the time left until its timer fires. Received packets counts all packets
+ * the node read from the dispatcher, so the dispatcher can tell whether a
+ * frame is still in flight. The dispatcher answers with GRANT (Op 1), which
+ * makes the node skip Time. All fields are in network byte order.
+ *
  * @{
  *
  * @file
@@ -107,8 +128,34 @@ typedef struct {
     ieee802154_filter_mode_t filter_mode;   /**< frame filter mode */
     bool rx;                                /**< whether the radio is listening for packets */
     bool send_hello;                        /**< send HELLO packet on connect */
+#if defined(MODULE_NATIVE_VTIME) || defined(DOXYGEN)
+    uint32_t rx_count;                      /**< packets read, for lockstep */
+#endif
 } socket_zep_t;
 
+/**
+ * @name    Virtual time lockstep packets
+ * @{
+ */
+#define SOCKET_ZEP_V2_TYPE_VTIME        (254)   /**< ZEP type of VTIME packets */
+#define SOCKET_ZEP_VTIME_OP_IDLE        (0)     /**< node is idle */
+#define SOCKET_ZEP_VTIME_OP_GRANT       (1)     /**< node may skip time */
+#define SOCKET_ZEP_VTIME_FLAG_ARMED     (0x01)  /**< time left is valid */
+
+/**
+ * @brief   VTIME packet
+ */
+typedef struct __attribute__((packed)) {
+    zep_hdr_t hdr;              /**< common header fields */
+    uint8_t type;               /**< type (must be @ref SOCKET_ZEP_V2_TYPE_VTIME) */
+    uint8_t op;                 /**< IDLE or GRANT */
+    uint8_t flags;              /**< flags */
+    uint8_t resv[2];            /**< reserved, must be 0 */
+    network_uint32_t us;        /**< time left (IDLE) or time to skip (GRANT) */
+    network_uint32_t rx_count;  /**< packets received by the node (IDLE) */
+} socket_zep_vtime_t;
+/** @} */
+
 /**
  * @brief   Setup socket_zep_t structure
  *
@@ -41,6 +41,7 @@
 
 #include "native_internal.h"
 #include "test_utils/expect.h"
+#include "trace.h"
 
 #define ENABLE_DEBUG 0
 #include "debug.h"
@@ -274,7 +275,9 @@ void native_irq_handler(void)
 
         if (native_irq_handlers[sig] != NULL) {
             DEBUG("native_irq_handler: calling interrupt handler for %i\n", sig);
+            trace_isr_enter(sig);
             native_irq_handlers[sig]();
+            trace_isr_exit(sig);
         }
         else if (sig == SIGUSR1) {
             warnx("native_irq_handler: ignoring SIGUSR1");
@@ -30,6 +30,7 @@
 #include <signal.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <time.h>
 #include <unistd.h>
 
 #if USE_LIBUCONTEXT
@@ -114,6 +115,14 @@ void native_breakpoint(void)
     raise(SIGTRAP);
 }
 
+uint32_t cpu_cycles_read(void)
+{
+    struct timespec t;
+
+    clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &t);
+    return (uint32_t)t.tv_sec * 1000000000LU + t.tv_nsec;
+}
+
 static inline void *align_stack(uintptr_t start, int *stacksize)
 {
     const size_t alignment = sizeof(uintptr_t);
@@ -95,6 +95,30 @@ static inline int _get_wired(netdev_t *netdev)
     return dev->wired;
 }
 
+#if IS_USED(MODULE_NETDEV_TAP_RX_RING)
+static void _rx_fill(netdev_tap_t *dev);
+static void _continue_reading(netdev_tap_t *dev);
+
+static inline void _isr(netdev_t *netdev)
+{
+    netdev_tap_t *dev = container_of(netdev, netdev_tap_t, netdev);
+
+    /* take all pending frames in one go */
+    _rx_fill(dev);
+
+    if (dev->rx_numof && netdev->event_callback) {
+        netdev->event_callback(netdev, NETDEV_EVENT_RX_COMPLETE);
+    }
+
+    if (dev->rx_numof) {
+        /* frames left, come back after the other events of the upper layer */
+        netdev_trigger_event_isr(netdev);
+    }
+    else {
+        _continue_reading(dev);
+    }
+}
+#else
 static inline void _isr(netdev_t *netdev)
 {
     if (netdev->event_callback) {
@@ -106,6 +130,7 @@ static inline void _isr(netdev_t *netdev)
     }
 #endif
 }
+#endif
 
 static int _get(netdev_t *dev, netopt_t opt, void *value, size_t max_len)
 {
@@ -135,6 +160,20 @@ static int _get(netdev_t *dev, netopt_t opt, void *value, size_t max_len)
                 res = sizeof(bool);
             }
             break;
+#if IS_USED(MODULE_NETDEV_TAP_RX_RING)
+        case NETOPT_RX_PENDING:
+            {
+                netdev_tap_t *tap = container_of(dev, netdev_tap_t, netdev);
+
+                if (tap->rx_numof == 0) {
+                    _rx_fill(tap);
+                }
+                *((netopt_enable_t *)value) = tap->rx_numof ? NETOPT_ENABLE
+                                                            : NETOPT_DISABLE;
+                res = sizeof(netopt_enable_t);
+            }
+            break;
+#endif
         default:
             res = netdev_eth_get(dev, opt, value, max_len);
             break;
@@ -188,13 +227,13 @@ static const netdev_driver_t netdev_driver_tap = {
 };
 
 /* driver implementation */
-static inline bool _is_addr_broadcast(uint8_t *addr)
+static inline bool _is_addr_broadcast(const uint8_t *addr)
 {
     return ((addr[0] == 0xff) && (addr[1] == 0xff) && (addr[2] == 0xff) &&
             (addr[3] == 0xff) && (addr[4] == 0xff) && (addr[5] == 0xff));
 }
 
-static inline bool _is_addr_multicast(uint8_t *addr)
+static inline bool _is_addr_multicast(const uint8_t *addr)
 {
     /* source: http://ieee802.org/secmail/pdfocSP2xXA6d.pdf */
     return (addr[0] & 0x01);
@@ -227,6 +266,76 @@ static void _continue_reading(netdev_tap_t *dev)
     _native_in_syscall--;
 }
 
+static bool _accept(netdev_tap_t *dev, const ethernet_hdr_t *hdr)
+{
+    if (!(dev->promiscuous) && !_is_addr_multicast(hdr->dst) &&
+        !_is_addr_broadcast(hdr->dst) &&
+        (memcmp(hdr->dst, dev->addr, ETHERNET_ADDR_LEN) != 0)) {
+        DEBUG("netdev_tap: received for %02x:%02x:%02x:%02x:%02x:%02x\n"
+              "That's not me => Dropped\n",
+              hdr->dst[0], hdr->dst[1], hdr->dst[2],
+              hdr->dst[3], hdr->dst[4], hdr->dst[5]);
+        return false;
+    }
+    return true;
+}
+
+#if IS_USED(MODULE_NETDEV_TAP_RX_RING)
+/* reads frames from the tap until it is drained or the ring is full */
+static void _rx_fill(netdev_tap_t *dev)
+{
+    while (dev->rx_numof < CONFIG_NETDEV_TAP_RX_RING_SIZE) {
+        unsigned idx = (dev->rx_head + dev->rx_numof) % CONFIG_NETDEV_TAP_RX_RING_SIZE;
+        netdev_tap_frame_t *frame = &dev->rx_ring[idx];
+        int nread = real_read(dev->tap_fd, frame->data, sizeof(frame->data));
+
+        if (nread < 0) {
+            if ((errno == EAGAIN) || (errno == EWOULDBLOCK)) {
+                break;
+            }
+            err(EXIT_FAILURE, "netdev_tap: read");
+        }
+        if (nread < (int)sizeof(ethernet_hdr_t)) {
+            DEBUG("netdev_tap: ignoring short frame\n");
+            continue;
+        }
+        if (!_accept(dev, (ethernet_hdr_t *)frame->data)) {
+            continue;
+        }
+        frame->len = nread;
+        dev->rx_numof++;
+    }
+    DEBUG("netdev_tap: %u frames buffered\n", dev->rx_numof);
+}
+
+static int _recv(netdev_t *netdev, void *buf, size_t len, void *info)
+{
+    netdev_tap_t *dev = container_of(netdev, netdev_tap_t, netdev);
+    netdev_tap_frame_t *frame = &dev->rx_ring[dev->rx_head];
+    int res = frame->len;
+    (void)info;
+
+    if (dev->rx_numof == 0) {
+        return 0;
+    }
+    if (!buf && !len) {
+        return res;
+    }
+    if (buf) {
+        if (len < frame->len) {
+            res = -ENOBUFS;
+        }
+        else {
+            memcpy(buf, frame->data, frame->len);
+        }
+    }
+    /* frame was read or dropped */
+    dev->rx_head = (dev->rx_head + 1) % CONFIG_NETDEV_TAP_RX_RING_SIZE;
+    dev->rx_numof--;
+
+    return res;
+}
+#else
 static int _recv(netdev_t *netdev, void *buf, size_t len, void *info)
 {
     netdev_tap_t *dev = container_of(netdev, netdev_tap_t, netdev);
@@ -261,15 +370,7 @@ static int _recv(netdev_t *netdev, void *buf, size_t len, void *info)
     DEBUG("netdev_tap: read %d bytes\n", nread);
 
     if (nread > 0) {
-        ethernet_hdr_t *hdr = (ethernet_hdr_t *)buf;
-        if (!(dev->promiscuous) && !_is_addr_multicast(hdr->dst) &&
-            !_is_addr_broadcast(hdr->dst) &&
-            (memcmp(hdr->dst, dev->addr, ETHERNET_ADDR_LEN) != 0)) {
-            DEBUG("netdev_tap: received for %02x:%02x:%02x:%02x:%02x:%02x\n"
-                  "That's not me => Dropped\n",
-                  hdr->dst[0], hdr->dst[1], hdr->dst[2],
-                  hdr->dst[3], hdr->dst[4], hdr->dst[5]);
-
+        if (!_accept(dev, buf)) {
             native_async_read_continue(dev->tap_fd);
 
             return 0;
@@ -295,6 +396,7 @@ static int _recv(netdev_t *netdev, void *buf, size_t len, void *info)
 
     return -1;
 }
+#endif
 
 static int _send(netdev_t *netdev, const iolist_t *iolist)
 {
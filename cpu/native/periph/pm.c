@@ -23,6 +23,7 @@
 
 #include "periph/pm.h"
 #include "native_internal.h"
+#include "native_vtime.h"
 #include "async_read.h"
 #include "tty_uart.h"
 
@@ -41,7 +42,11 @@ unsigned _native_retval = EXIT_SUCCESS;
 static void _native_sleep(void)
 {
     _native_in_syscall++; /* no switching here */
+#ifdef MODULE_NATIVE_VTIME
+    native_vtime_sleep();
+#else
     real_pause();
+#endif
     _native_in_syscall--;
 
     if (_native_sigpend > 0) {
@@ -38,6 +38,7 @@
 #include "cpu.h"
 #include "cpu_conf.h"
 #include "native_internal.h"
+#include "native_vtime.h"
 #include "panic.h"
 #include "periph/timer.h"
 #include "time_units.h"
@@ -56,6 +57,18 @@ static struct itimerspec its;
 
 static timer_t itimer_monotonic;
 
+#ifdef MODULE_NATIVE_VTIME
+bool native_vtime_lockstep;
+
+/* virtual time is the host time plus the time skipped while idle */
+static uint32_t _vtime_offset;
+static bool _vtime_armed;
+static uint32_t _vtime_deadline;
+static uint32_t _vtime_interval;
+static native_vtime_idle_cb_t _vtime_idle_cb;
+static void *_vtime_idle_arg;
+#endif
+
 /**
  * returns ticks for give timespec
  */
@@ -74,6 +87,15 @@ void native_isr_timer(void)
 {
     DEBUG("%s\n", __func__);
 
+#ifdef MODULE_NATIVE_VTIME
+    if (_vtime_interval) {
+        _vtime_deadline += _vtime_interval;
+    }
+    else {
+        _vtime_armed = false;
+    }
+#endif
+
     _callback(_cb_arg, 0);
 }
 
@@ -204,6 +226,11 @@ void timer_start(tim_t dev)
     DEBUG("%s\n", __func__);
 
     _native_syscall_enter();
+#ifdef MODULE_NATIVE_VTIME
+    _vtime_armed = its.it_value.tv_sec || its.it_value.tv_nsec;
+    _vtime_deadline = timer_read(dev) + ts2ticks(&its.it_value);
+    _vtime_interval = ts2ticks(&its.it_interval);
+#endif
     if (timer_settime(itimer_monotonic, 0, &its, NULL) == -1) {
         core_panic(PANIC_GENERAL_ERROR, "Failed to set monotonic timer");
     }
@@ -216,6 +243,9 @@ void timer_stop(tim_t dev)
     DEBUG("%s\n", __func__);
 
     _native_syscall_enter();
+#ifdef MODULE_NATIVE_VTIME
+    _vtime_armed = false;
+#endif
     struct itimerspec zero = {0};
     if (timer_settime(itimer_monotonic, 0, &zero, &its) == -1) {
         core_panic(PANIC_GENERAL_ERROR, "Failed to set monotonic timer");
@@ -243,5 +273,80 @@ unsigned int timer_read(tim_t dev)
 
     _native_syscall_leave();
 
+#ifdef MODULE_NATIVE_VTIME
+    return ts2ticks(&t) - time_null + _vtime_offset;
+#else
     return ts2ticks(&t) - time_null;
+#endif
+}
+
+#ifdef MODULE_NATIVE_VTIME
+static void _us2ts(uint32_t us, struct timespec *tp)
+{
+    tp->tv_sec = us / NATIVE_TIMER_SPEED;
+    tp->tv_nsec = (us % NATIVE_TIMER_SPEED) * (NS_PER_SEC / NATIVE_TIMER_SPEED);
+}
+
+void native_vtime_advance(uint32_t us)
+{
+    _vtime_offset += us;
+
+    if (!_vtime_armed) {
+        return;
+    }
+
+    /* fire the host timer at the same virtual time as before, a deadline
+     * that passed by now is due right away */
+    int32_t left = _vtime_deadline - timer_read(0);
+    struct itimerspec vits;
+
+    if (left <= 0) {
+        left = 1;
+    }
+    _us2ts((uint32_t)left, &vits.it_value);
+    _us2ts(_vtime_interval, &vits.it_interval);
+
+    _native_syscall_enter();
+    if (timer_settime(itimer_monotonic, 0, &vits, NULL) == -1) {
+        core_panic(PANIC_GENERAL_ERROR, "Failed to set monotonic timer");
+    }
+    _native_syscall_leave();
+}
+
+void native_vtime_set_idle_cb(native_vtime_idle_cb_t cb, void *arg)
+{
+    _vtime_idle_cb = cb;
+    _vtime_idle_arg = arg;
+}
+
+void native_vtime_sleep(void)
+{
+    sigset_t all, prev;
+
+    /* block everything, so no signal gets lost between checking for pending
+     * ones and suspending */
+    sigfillset(&all);
+    sigprocmask(SIG_SETMASK, &all, &prev);
+
+    if (_native_sigpend == 0) {
+        uint32_t left = _vtime_armed ? _vtime_deadline - timer_read(0) : 0;
+
+        if ((int32_t)left < 0) {
+            left = 0;
+        }
+
+        if (native_vtime_lockstep) {
+            if (_vtime_idle_cb) {
+                _vtime_idle_cb(_vtime_idle_arg, _vtime_armed, left);
+            }
+        }
+        else if (_vtime_armed) {
+            native_vtime_advance(left);
+        }
+
+        sigsuspend(&prev);
+    }
+
+    sigprocmask(SIG_SETMASK, &prev, NULL);
 }
+#endif
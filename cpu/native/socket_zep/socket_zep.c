@@ -17,6 +17,7 @@
 #include <assert.h>
 #include <err.h>
 #include <errno.h>
+#include <inttypes.h>
 #include <stdbool.h>
 #include <stdio.h>
 #include <string.h>
@@ -29,6 +30,7 @@
 #include "byteorder.h"
 #include "checksum/crc16_ccitt.h"
 #include "native_internal.h"
+#include "native_vtime.h"
 
 #include "net/ieee802154/radio.h"
 #include "socket_zep.h"
@@ -232,12 +234,58 @@ static void _send_zep_hello(socket_zep_t *dev)
     }
 }
 
+#ifdef MODULE_NATIVE_VTIME
+static void _vtime_idle(void *arg, bool armed, uint32_t left)
+{
+    socket_zep_t *dev = arg;
+    socket_zep_vtime_t pkt = {
+        .hdr.preamble = "EX",
+        .hdr.version = 2,
+        .type = SOCKET_ZEP_V2_TYPE_VTIME,
+        .op = SOCKET_ZEP_VTIME_OP_IDLE,
+        .flags = armed ? SOCKET_ZEP_VTIME_FLAG_ARMED : 0,
+        .us = byteorder_htonl(left),
+        .rx_count = byteorder_htonl(dev->rx_count),
+    };
+
+    real_send(dev->sock_fd, &pkt, sizeof(pkt), 0);
+}
+
+/* GRANT packets are consumed here, as they may arrive while the radio does
+ * not listen */
+static bool _vtime_grant(socket_zep_t *dev)
+{
+    socket_zep_vtime_t pkt;
+
+    if ((real_recv(dev->sock_fd, &pkt, sizeof(pkt), MSG_PEEK | MSG_DONTWAIT)
+         != sizeof(pkt)) || (pkt.type != SOCKET_ZEP_V2_TYPE_VTIME)) {
+        return false;
+    }
+
+    real_recv(dev->sock_fd, &pkt, sizeof(pkt), MSG_DONTWAIT);
+    if (pkt.op == SOCKET_ZEP_VTIME_OP_GRANT) {
+        DEBUG("socket_zep::vtime: granted %" PRIu32 " us\n",
+              byteorder_ntohl(pkt.us));
+        native_vtime_advance(byteorder_ntohl(pkt.us));
+    }
+
+    return true;
+}
+#endif
+
 static void _socket_isr(int fd, void *arg)
 {
     ieee802154_dev_t *dev = arg;
 
     DEBUG("socket_zep::_socket_isr: bytes on %d\n", fd);
 
+#ifdef MODULE_NATIVE_VTIME
+    if (_vtime_grant(dev->priv)) {
+        _continue_reading(dev->priv);
+        return;
+    }
+#endif
+
     dev->cb(dev, IEEE802154_RADIO_INDICATION_RX_DONE);
 }
 
@@ -284,6 +332,12 @@ static int _request_on(ieee802154_dev_t *dev)
     /* only send hello if we are connected to a remote */
     zepdev->send_hello = !_connect_remote(zepdev, zepdev->params);
 
+#ifdef MODULE_NATIVE_VTIME
+    if (native_vtime_lockstep) {
+        native_vtime_set_idle_cb(_vtime_idle, zepdev);
+    }
+#endif
+
     return 0;
 }
 
@@ -504,6 +558,14 @@ static int _read(ieee802154_dev_t *dev, void *buf, size_t max_size,
 
     DEBUG("socket_zep::read: got %d/%zu bytes\n", res, frame_len);
 
+#ifdef MODULE_NATIVE_VTIME
+    /* the dispatcher counts every packet it forwards to us */
+    if ((res > (int)sizeof(zep_hdr_t)) &&
+        (((zep_v2_ack_hdr_t *)zepdev->rcv_buf)->type != SOCKET_ZEP_V2_TYPE_VTIME)) {
+        zepdev->rx_count++;
+    }
+#endif
+
     if (res <= (int)sizeof(zep_v2_data_hdr_t) || res > (int)frame_len) {
         DEBUG("socket_zep::read: %s\n", strerror(errno));
         res = 0;
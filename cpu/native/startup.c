@@ -90,6 +90,9 @@ netdev_tap_params_t netdev_tap_params[NETDEV_TAP_MAX];
 
 socket_zep_params_t socket_zep_params[SOCKET_ZEP_MAX];
 #endif
+#if defined(MODULE_NATIVE_VTIME) && defined(MODULE_SOCKET_ZEP)
+#include "native_vtime.h"
+#endif
 #ifdef MODULE_PERIPH_EEPROM
 #include "eeprom_native.h"
 extern char eeprom_file[EEPROM_FILEPATH_MAX_LEN];
@@ -108,6 +111,9 @@ static const char short_opts[] = ":hi:s:deEoc:"
 #ifdef MODULE_SOCKET_ZEP
     "z:"
 #endif
+#if defined(MODULE_NATIVE_VTIME) && defined(MODULE_SOCKET_ZEP)
+    "L"
+#endif
 #ifdef MODULE_NATIVE_CLI_EUI_PROVIDER
     "U:"
 #endif
@@ -146,6 +152,9 @@ static const struct option long_opts[] = {
 #ifdef MODULE_SOCKET_ZEP
     { "zep", required_argument, NULL, 'z' },
 #endif
+#if defined(MODULE_NATIVE_VTIME) && defined(MODULE_SOCKET_ZEP)
+    { "vtime-lockstep", no_argument, NULL, 'L' },
+#endif
 #ifdef MODULE_NATIVE_CLI_EUI_PROVIDER
     { "eui64", required_argument, NULL, 'U' },
 #endif
@@ -297,6 +306,9 @@ void usage_exit(int status)
         real_printf(" -z <laddr>:<lport>,<raddr>:<rport>");
     }
 #endif
+#if defined(MODULE_NATIVE_VTIME) && defined(MODULE_SOCKET_ZEP)
+    real_printf(" [-L]");
+#endif
 #ifdef MODULE_NATIVE_CLI_EUI_PROVIDER
     real_printf(" [--eui64 <eui64> …]");
 #endif
@@ -343,6 +355,11 @@ void usage_exit(int status)
 "        on a local address.\n"
 "        Required to be provided SOCKET_ZEP_MAX times\n"
 #endif
+#if defined(MODULE_NATIVE_VTIME) && defined(MODULE_SOCKET_ZEP)
+"    -L, --vtime-lockstep\n"
+"        only skip idle time when granted by the ZEP dispatcher, which keeps\n"
+"        all nodes in lockstep (zep_dispatch -l)\n"
+#endif
 #ifdef MODULE_NATIVE_CLI_EUI_PROVIDER
 "    -U <eui64>, --eui64=<eui64>\n"
 "        provide a ZEP interface with EUI-64 (MAC address)\n"
@@ -608,6 +625,11 @@ __attribute__((constructor)) static void startup(int argc, char **argv, char **e
                 _zep_params_setup(optarg, zeps++);
                 break;
 #endif
+#if defined(MODULE_NATIVE_VTIME) && defined(MODULE_SOCKET_ZEP)
+            case 'L':
+                native_vtime_lockstep = true;
+                break;
+#endif
 #ifdef MODULE_NATIVE_CLI_EUI_PROVIDER
             case 'U':
                 native_cli_add_eui64(optarg);
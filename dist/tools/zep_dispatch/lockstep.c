@@ -0,0 +1,271 @@
+/*
+ * Copyright (C) 2026 Mesotic SAS
+ *
+ * This file is subject to the terms and conditions of the GNU General Public
+ * License v2. See the file LICENSE for more details.
+ */
+
+#include <arpa/inet.h>
+#include <inttypes.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "kernel_defines.h"
+#include "list.h"
+#include "lockstep.h"
+
+/* see socket_zep.h, which can't be included here */
+#define SOCKET_ZEP_V2_TYPE_VTIME        (254)
+#define SOCKET_ZEP_VTIME_OP_IDLE        (0)
+#define SOCKET_ZEP_VTIME_OP_GRANT       (1)
+#define SOCKET_ZEP_VTIME_FLAG_ARMED     (0x01)
+
+/* host time after which frames a node has not read are given up on */
+#define STALL_TIMEOUT_US                (1000000U)
+
+typedef struct __attribute__((packed)) {
+    char preamble[2];
+    uint8_t version;
+    uint8_t type;
+    uint8_t op;
+    uint8_t flags;
+    uint8_t resv[2];
+    uint32_t us;            /* network byte order */
+    uint32_t rx_count;      /* network byte order */
+} vtime_pkt_t;
+
+typedef struct {
+    list_node_t node;
+    struct sockaddr_in6 addr;
+    uint32_t sent;          /* packets forwarded to the node */
+    uint32_t rx_count;      /* packets the node reported to have read */
+    uint64_t idle_since;    /* time of the last IDLE report in µs */
+    uint64_t unread_since;  /* time since packets are unread in µs, or 0 */
+    uint32_t left;          /* time left until its timer fires in µs */
+    bool reported;          /* node takes part in lockstep */
+    bool asleep;            /* node reported IDLE and was not granted since */
+    bool idle;              /* node is idle and read all packets */
+    bool armed;             /* left is valid */
+} lockstep_node_t;
+
+static list_node_t _nodes;
+static unsigned _nodes_numof;
+static unsigned _grants;
+static uint64_t _skipped_us;
+
+static uint64_t _now_us(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ((uint64_t)ts.tv_sec * 1000000) + (ts.tv_nsec / 1000);
+}
+
+static lockstep_node_t *_get_node(const struct sockaddr_in6 *addr)
+{
+    for (list_node_t *n = _nodes.next; n; n = n->next) {
+        lockstep_node_t *node = container_of(n, lockstep_node_t, node);
+        if (memcmp(&node->addr, addr, sizeof(*addr)) == 0) {
+            return node;
+        }
+    }
+
+    lockstep_node_t *node = calloc(1, sizeof(*node));
+    if (node) {
+        memcpy(&node->addr, addr, sizeof(*addr));
+        list_add(&_nodes, &node->node);
+    }
+    return node;
+}
+
+static void _try_grant(int sock)
+{
+    uint64_t now = _now_us();
+    int64_t grant = INT64_MAX;
+    unsigned reported = 0;
+
+    for (list_node_t *n = _nodes.next; n; n = n->next) {
+        lockstep_node_t *node = container_of(n, lockstep_node_t, node);
+
+        if (!node->reported) {
+            continue;
+        }
+        if (!node->idle) {
+            return;
+        }
+        reported++;
+        if (node->armed) {
+            int64_t left = (int64_t)node->left - (int64_t)(now - node->idle_since);
+            if (left < grant) {
+                grant = left;
+            }
+        }
+    }
+
+    /* nothing to wait for, a node must wake up by other means */
+    if ((reported < _nodes_numof) || (grant == INT64_MAX)) {
+        return;
+    }
+    if (grant < 0) {
+        grant = 0;
+    }
+
+    vtime_pkt_t pkt = {
+        .preamble = "EX",
+        .version = 2,
+        .type = SOCKET_ZEP_V2_TYPE_VTIME,
+        .op = SOCKET_ZEP_VTIME_OP_GRANT,
+        .us = htonl(grant),
+    };
+
+    /* every node skips the same time, the GRANT also wakes it up so it
+     * reports again once idle */
+    for (list_node_t *n = _nodes.next; n; n = n->next) {
+        lockstep_node_t *node = container_of(n, lockstep_node_t, node);
+
+        if (!node->reported) {
+            continue;
+        }
+        sendto(sock, &pkt, sizeof(pkt), 0,
+               (struct sockaddr *)&node->addr, sizeof(node->addr));
+        node->idle = false;
+        node->asleep = false;
+    }
+
+    _grants++;
+    _skipped_us += grant;
+}
+
+void lockstep_init(unsigned nodes)
+{
+    _nodes_numof = nodes;
+}
+
+bool lockstep_handle(int sock, const void *buffer, size_t len,
+                     const struct sockaddr_in6 *src_addr, bool hold)
+{
+    const vtime_pkt_t *pkt = buffer;
+
+    if ((len < offsetof(vtime_pkt_t, op)) || (pkt->type != SOCKET_ZEP_V2_TYPE_VTIME)) {
+        return false;
+    }
+
+    if (!_nodes_numof || (len < sizeof(*pkt)) ||
+        (pkt->op != SOCKET_ZEP_VTIME_OP_IDLE)) {
+        return true;
+    }
+
+    lockstep_node_t *node = _get_node(src_addr);
+    if (node == NULL) {
+        return true;
+    }
+
+    if (!node->reported) {
+        char addr_str[INET6_ADDRSTRLEN];
+        inet_ntop(AF_INET6, &src_addr->sin6_addr, addr_str, sizeof(addr_str));
+        printf("lockstep: adding [%s]:%d\n", addr_str, ntohs(src_addr->sin6_port));
+        node->reported = true;
+    }
+
+    node->rx_count = ntohl(pkt->rx_count);
+    /* the node read packets given up on before */
+    if ((int32_t)(node->rx_count - node->sent) > 0) {
+        node->sent = node->rx_count;
+    }
+    /* a packet is still on its way to the node */
+    node->idle = node->rx_count == node->sent;
+    node->asleep = true;
+    node->armed = pkt->flags & SOCKET_ZEP_VTIME_FLAG_ARMED;
+    node->left = ntohl(pkt->us);
+    node->idle_since = _now_us();
+    if (node->idle) {
+        node->unread_since = 0;
+    }
+    else if (!node->unread_since) {
+        node->unread_since = node->idle_since;
+    }
+
+    if (node->idle && !hold) {
+        _try_grant(sock);
+    }
+
+    return true;
+}
+
+ssize_t lockstep_sendto(int sock, const void *buffer, size_t len,
+                        const struct sockaddr_in6 *dst_addr)
+{
+    ssize_t res = sendto(sock, buffer, len, 0,
+                         (const struct sockaddr *)dst_addr, sizeof(*dst_addr));
+
+    if ((res >= 0) && _nodes_numof) {
+        lockstep_node_t *node = _get_node(dst_addr);
+        if (node) {
+            node->sent++;
+            node->idle = false;
+            if (!node->unread_since) {
+                node->unread_since = _now_us();
+            }
+        }
+    }
+
+    return res;
+}
+
+int64_t lockstep_check_unread(int sock, bool hold)
+{
+    uint64_t now = _now_us();
+    int64_t due = -1;
+    bool resync = false;
+
+    for (list_node_t *n = _nodes.next; n; n = n->next) {
+        lockstep_node_t *node = container_of(n, lockstep_node_t, node);
+
+        if (!node->unread_since) {
+            continue;
+        }
+        if ((now - node->unread_since) < STALL_TIMEOUT_US) {
+            int64_t left = STALL_TIMEOUT_US - (now - node->unread_since);
+            if ((due < 0) || (left < due)) {
+                due = left;
+            }
+            continue;
+        }
+
+        /* e.g. the radio of the node is off, or it dropped the frames
+         * without reading them: don't wait for them forever */
+        char addr_str[INET6_ADDRSTRLEN];
+        inet_ntop(AF_INET6, &node->addr.sin6_addr, addr_str, sizeof(addr_str));
+        printf("lockstep: [%s]:%d did not read %" PRIu32 " packets, "
+               "giving up on them\n", addr_str, ntohs(node->addr.sin6_port),
+               node->sent - node->rx_count);
+        node->sent = node->rx_count;
+        node->unread_since = 0;
+        node->idle = node->asleep;
+        resync = true;
+    }
+
+    if (resync && !hold) {
+        _try_grant(sock);
+    }
+
+    return due;
+}
+
+void lockstep_print_stats(bool reset)
+{
+    if (!_nodes_numof) {
+        return;
+    }
+
+    printf("lockstep: %u grants, %" PRIu64 " µs skipped\n", _grants, _skipped_us);
+
+    if (reset) {
+        _grants = 0;
+        _skipped_us = 0;
+    }
+}
@@ -0,0 +1,86 @@
+/*
+ * Copyright (C) 2026 Mesotic SAS
+ *
+ * This file is subject to the terms and conditions of the GNU General Public
+ * License v2. See the file LICENSE for more details.
+ */
+
+#ifndef LOCKSTEP_H
+#define LOCKSTEP_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <sys/types.h>
+#include <netinet/in.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Keep the virtual time of native nodes in lockstep
+ *
+ * @param[in] nodes     number of nodes to wait for before granting time
+ */
+void lockstep_init(unsigned nodes);
+
+/**
+ * @brief   Handle a virtual time packet of a node
+ *
+ * Grants time to all nodes once every node is idle.
+ *
+ * @param[in] sock      socket of the dispatcher
+ * @param[in] buffer    ZEP packet
+ * @param[in] len       size of buffer
+ * @param[in] src_addr  address of the node
+ * @param[in] hold      do not grant time, as frames are in flight
+ *
+ * @return true if the packet was a virtual time packet, which must not be
+ *         forwarded
+ */
+bool lockstep_handle(int sock, const void *buffer, size_t len,
+                     const struct sockaddr_in6 *src_addr, bool hold);
+
+/**
+ * @brief   Forward a ZEP packet to a node
+ *
+ * Counts the packets sent to each node, so a node that has not read all of
+ * them yet is not considered idle.
+ *
+ * @param[in] sock      socket of the dispatcher
+ * @param[in] buffer    ZEP packet
+ * @param[in] len       size of buffer
+ * @param[in] dst_addr  address of the node
+ *
+ * @return result of sendto()
+ */
+ssize_t lockstep_sendto(int sock, const void *buffer, size_t len,
+                        const struct sockaddr_in6 *dst_addr);
+
+/**
+ * @brief   Give up on packets a node has not read for too long
+ *
+ * A node only counts the packets its driver reads. Packets it never reads,
+ * e.g. while its radio is off, would keep it from being idle forever. After
+ * a timeout they are reported and no longer waited for.
+ *
+ * @param[in] sock      socket of the dispatcher
+ * @param[in] hold      do not grant time, as frames are in flight
+ *
+ * @return µs until the next node times out, -1 if no packets are unread
+ */
+int64_t lockstep_check_unread(int sock, bool hold);
+
+/**
+ * @brief   Print the number of grants and the time skipped
+ *
+ * @param[in] reset     reset the statistics
+ */
+void lockstep_print_stats(bool reset);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* LOCKSTEP_H */
@@ -9,8 +9,11 @@
 #define ZEP_DISPATCH_PDU    256
 #endif
 
+#define _GNU_SOURCE     /* ppoll() */
+
 #include <arpa/inet.h>
 #include <netdb.h>
+#include <poll.h>
 #include <stdbool.h>
 #include <stdio.h>
 #include <stdlib.h>
@@ -24,6 +27,7 @@
 #include <sys/ioctl.h>
 
 #include "kernel_defines.h"
+#include "lockstep.h"
 #include "topology.h"
 #include "zep_parser.h"
 
@@ -56,7 +60,7 @@ static void _send_flat(void *ctx, void *buffer, size_t len,
             known_node = true;
             /* remove client if sending fails */
         }
-        else if (sendto(sock, buffer, len, 0, (struct sockaddr *)addr, sizeof(*addr)) < 0) {
+        else if (lockstep_sendto(sock, buffer, len, addr) < 0) {
             inet_ntop(src_addr->sin6_family, &addr->sin6_addr, addr_str, INET6_ADDRSTRLEN);
             printf("removing [%s]:%d\n", addr_str, ntohs(addr->sin6_port));
             prev->next = n->next;
@@ -95,6 +99,8 @@ static void _send_topology(void *ctx, void *buffer, size_t len,
     topology_send(ctx, sock, src_addr, buffer, len);
 }
 
+static topology_t topology;
+
 static void dispatch_loop(int sock, int tap, dispatch_cb_t dispatch, void *ctx)
 {
     puts("entering loop…");
@@ -103,6 +109,26 @@ static void dispatch_loop(int sock, int tap, dispatch_cb_t dispatch, void *ctx)
         struct sockaddr_in6 src_addr;
         socklen_t addr_len = sizeof(src_addr);
 
+        /* wait for a frame, for the next frame delayed by a link or for a
+         * node that does not read its frames */
+        topology_deliver(&topology, sock);
+        int64_t due = topology_next_due(&topology);
+        int64_t unread = lockstep_check_unread(sock, topology.events_numof > 0);
+        if ((unread >= 0) && ((due < 0) || (unread < due))) {
+            due = unread;
+        }
+        if (due >= 0) {
+            struct pollfd pfd = { .fd = sock, .events = POLLIN };
+            struct timespec timeout = {
+                .tv_sec = due / 1000000,
+                .tv_nsec = (due % 1000000) * 1000,
+            };
+
+            if (ppoll(&pfd, 1, &timeout, NULL) <= 0) {
+                continue;
+            }
+        }
+
         /* receive incoming packet */
         ssize_t bytes_in = recvfrom(sock, buffer, sizeof(buffer), 0,
                                     (struct sockaddr *)&src_addr, &addr_len);
@@ -111,6 +137,13 @@ static void dispatch_loop(int sock, int tap, dispatch_cb_t dispatch, void *ctx)
             continue;
         }
 
+        /* virtual time packets are for the dispatcher only, time must not
+         * be skipped while links hold frames */
+        if (lockstep_handle(sock, buffer, bytes_in, &src_addr,
+                            topology.events_numof > 0)) {
+            continue;
+        }
+
         /* send packet to virtual 802.15.4 interface */
         if (tap) {
             size_t len = bytes_in;
@@ -129,7 +162,6 @@ static void dispatch_loop(int sock, int tap, dispatch_cb_t dispatch, void *ctx)
     }
 }
 
-static topology_t topology;
 static const char *graphviz_file = "example.gv";
 static const char *pidfile;
 static void _info_handler(int signal)
@@ -144,7 +176,11 @@ static void _info_handler(int signal)
         }
         break;
     case SIGUSR2:
-        topology_print_stats(&topology, true);
+        /* a flat topology only keeps a list of clients */
+        if (!topology.flat) {
+            topology_print_stats(&topology, true);
+        }
+        lockstep_print_stats(true);
         break;
     case SIGINT:
     case SIGTERM:
@@ -192,7 +228,7 @@ error:
 static void _print_help(const char *progname)
 {
     fprintf(stderr, "usage: %s [-t topology] [-s seed] "
-                    "[-g graphviz_out] [-w interface] <address> <port>\n",
+                    "[-g graphviz_out] [-w interface] [-l nodes] <address> <port>\n",
             progname);
 
     fprintf(stderr, "\npositional arguments:\n");
@@ -206,6 +242,8 @@ static void _print_help(const char *progname)
     fprintf(stderr, "\t-g <file>\tFile to dump topology as Graphviz visualisation on SIGUSR1\n");
     fprintf(stderr, "\t-w <interface>\tSend frames to virtual 802.15.4 "
                     "interface (mac802154_hwsim)\n");
+    fprintf(stderr, "\t-l <nodes>\tKeep the virtual time of <nodes> native nodes "
+                    "started with --vtime-lockstep in lockstep\n");
 }
 
 int main(int argc, char **argv)
@@ -222,7 +260,7 @@ int main(int argc, char **argv)
         .ai_flags    = AI_NUMERICHOST,
     };
 
-    while ((c = getopt(argc, argv, "t:s:g:w:p:")) != -1) {
+    while ((c = getopt(argc, argv, "t:s:g:w:p:l:")) != -1) {
         switch (c) {
         case 't':
             topo_file = optarg;
@@ -242,6 +280,9 @@ int main(int argc, char **argv)
         case 'p':
             pidfile = optarg;
             break;
+        case 'l':
+            lockstep_init(atoi(optarg));
+            break;
         default:
             _print_help(progname);
             exit(1);
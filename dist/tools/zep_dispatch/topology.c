@@ -6,6 +6,7 @@
  */
 
 #include <arpa/inet.h>
+#include <inttypes.h>
 #include <netdb.h>
 #include <stdbool.h>
 #include <stdio.h>
@@ -13,14 +14,19 @@
 #include <stdlib.h>
 #include <string.h>
 #include <limits.h>
+#include <time.h>
 
 #include "kernel_defines.h"
+#include "lockstep.h"
 #include "topology.h"
 #include "zep_parser.h"
 
 #define NODE_NAME_MAX_LEN   32
 #define HW_ADDR_MAX_LEN      8
 
+/* frames a link holds until they are delivered, unless set by queue= */
+#define LINK_QUEUE_LEN_DEFAULT  16
+
 struct node {
     list_node_t next;
     char name[NODE_NAME_MAX_LEN];
@@ -31,16 +37,60 @@ struct node {
     uint8_t mac_len;
 };
 
+/* one direction of an edge */
+struct link {
+    float weight;           /* probability of a successful transmission */
+    uint32_t delay_us;      /* propagation delay */
+    uint32_t jitter_us;     /* maximum random extra delay */
+    uint32_t rate_bps;      /* serialization rate, 0 for none */
+    unsigned queue_len;     /* maximum number of frames in flight */
+    /* Gilbert-Elliott loss model, disabled if ge_p is 0 */
+    float ge_p;             /* probability good -> bad */
+    float ge_r;             /* probability bad -> good */
+    float ge_loss_good;     /* loss probability in the good state */
+    float ge_loss_bad;      /* loss probability in the bad state */
+    bool ge_bad;            /* current state */
+    uint64_t busy_until;    /* end of serialization of the last frame */
+    uint64_t last_due;      /* delivery of the last frame, to keep order */
+    unsigned queued;        /* frames in flight */
+    /* statistics */
+    uint32_t num_tx;        /* frames delivered */
+    uint64_t bytes_tx;      /* bytes delivered */
+    uint32_t num_lost;      /* frames dropped by the loss models */
+    uint32_t num_overflow;  /* frames dropped on a full queue */
+    uint64_t queue_us_sum;  /* time spent waiting for serialization */
+    uint32_t queue_us_max;
+    uint64_t latency_us_sum;    /* time from reception to delivery */
+};
+
 struct edge {
     list_node_t next;
     struct node *a;
     struct node *b;
-    float weight_a_b;
-    float weight_b_a;
+    struct link a_b;
+    struct link b_a;
+};
+
+/* a frame waiting for delivery */
+struct event {
+    uint64_t due;           /* time of delivery */
+    uint64_t received;      /* time of reception by the dispatcher */
+    struct link *link;
+    struct node *dst;
+    size_t len;
+    uint8_t buffer[];
 };
 
 size_t l2util_addr_from_str(const char *str, uint8_t *out);
 
+static uint64_t _now_us(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ((uint64_t)ts.tv_sec * 1000000) + (ts.tv_nsec / 1000);
+}
+
 static char *_fmt_addr(char *out, size_t out_len, const uint8_t *addr, uint8_t addr_len)
 {
     char *start = out;
@@ -82,9 +132,92 @@ static struct node *_find_or_create_node(list_node_t *nodes, const char *name)
     return node;
 }
 
+/* parse a time with an optional unit (us, ms, s), default is µs */
+static uint32_t _parse_time_us(const char *str)
+{
+    char *unit;
+    double val = strtod(str, &unit);
+
+    if (strcmp(unit, "s") == 0) {
+        val *= 1000000;
+    }
+    else if (strcmp(unit, "ms") == 0) {
+        val *= 1000;
+    }
+
+    return val;
+}
+
+/* parse a rate in bit/s with an optional k or M suffix */
+static uint32_t _parse_rate(const char *str)
+{
+    char *unit;
+    double val = strtod(str, &unit);
+
+    if (*unit == 'k') {
+        val *= 1000;
+    }
+    else if (*unit == 'M') {
+        val *= 1000000;
+    }
+
+    return val;
+}
+
+static void _link_init(struct link *l, const char *weight)
+{
+    memset(l, 0, sizeof(*l));
+    l->weight = atof(weight);
+    l->queue_len = LINK_QUEUE_LEN_DEFAULT;
+    l->ge_loss_bad = 1;
+}
+
+/* attributes apply to both directions of an edge */
+static bool _parse_attr(char *attr, struct link *ab, struct link *ba)
+{
+    char *val = strchr(attr, '=');
+    struct link l = *ab;
+
+    *val++ = '\0';
+
+    if (strcmp(attr, "delay") == 0) {
+        l.delay_us = _parse_time_us(val);
+    }
+    else if (strcmp(attr, "jitter") == 0) {
+        l.jitter_us = _parse_time_us(val);
+    }
+    else if (strcmp(attr, "rate") == 0) {
+        l.rate_bps = _parse_rate(val);
+    }
+    else if (strcmp(attr, "queue") == 0) {
+        l.queue_len = atoi(val);
+    }
+    else if (strcmp(attr, "ge") == 0) {
+        if (sscanf(val, "%f,%f,%f,%f", &l.ge_p, &l.ge_r,
+                   &l.ge_loss_bad, &l.ge_loss_good) < 2) {
+            fprintf(stderr, "invalid Gilbert-Elliott parameters '%s'\n", val);
+            return false;
+        }
+    }
+    else {
+        fprintf(stderr, "unknown link attribute '%s'\n", attr);
+        return false;
+    }
+
+    /* keep the weights */
+    l.weight = ab->weight;
+    *ab = l;
+    l.weight = ba->weight;
+    *ba = l;
+
+    return true;
+}
+
 static bool _parse_line(char *line, list_node_t *nodes, list_node_t *edges)
 {
     struct edge *e;
+    struct link a_b, b_a;
+    char *tok;
 
     if (*line == '#') {
         return true;
@@ -92,8 +225,10 @@ static bool _parse_line(char *line, list_node_t *nodes, list_node_t *edges)
 
     char *a     = strtok(line, "\n\t ");
     char *b     = strtok(NULL, "\n\t ");
-    char *e_ab  = strtok(NULL, "\n\t ");
-    char *e_ba  = strtok(NULL, "\n\t ");
+    char *e_ab  = NULL;
+    char *e_ba  = NULL;
+    char *attrs[8];
+    unsigned attrs_numof = 0;
 
     if (a == NULL) {
         return false;
@@ -111,10 +246,28 @@ static bool _parse_line(char *line, list_node_t *nodes, list_node_t *edges)
             return false;
         }
 
-        n->mac_len = l2util_addr_from_str(e_ab, n->mac);
+        n->mac_len = l2util_addr_from_str(strtok(NULL, "\n\t "), n->mac);
         return true;
     }
 
+    /* weights come first, link attributes are key=value */
+    while ((tok = strtok(NULL, "\n\t ")) != NULL) {
+        if (strchr(tok, '=')) {
+            if (attrs_numof == ARRAY_SIZE(attrs)) {
+                fprintf(stderr, "ignoring link %s %s: more than %u attributes\n",
+                        a, b, (unsigned)ARRAY_SIZE(attrs));
+                return false;
+            }
+            attrs[attrs_numof++] = tok;
+        }
+        else if (e_ab == NULL) {
+            e_ab = tok;
+        }
+        else if (e_ba == NULL) {
+            e_ba = tok;
+        }
+    }
+
     if (e_ab == NULL) {
         e_ab = "1";
     }
@@ -123,12 +276,22 @@ static bool _parse_line(char *line, list_node_t *nodes, list_node_t *edges)
         e_ba = e_ab;
     }
 
+    _link_init(&a_b, e_ab);
+    _link_init(&b_a, e_ba);
+
+    for (unsigned i = 0; i < attrs_numof; i++) {
+        if (!_parse_attr(attrs[i], &a_b, &b_a)) {
+            fprintf(stderr, "ignoring link %s %s\n", a, b);
+            return false;
+        }
+    }
+
     e = malloc(sizeof(*e));
 
     e->a = _find_or_create_node(nodes, a);
     e->b = _find_or_create_node(nodes, b);
-    e->weight_a_b = atof(e_ab);
-    e->weight_b_a = atof(e_ba);
+    e->a_b = a_b;
+    e->b_a = b_a;
 
     list_add(edges, &e->next);
 
@@ -170,13 +333,13 @@ int topology_print(const char *file, const topology_t *t)
 
     for (list_node_t *edge = t->edges.next; edge; edge = edge->next) {
         struct edge *super = container_of(edge, struct edge, next);
-        if (super->weight_a_b) {
+        if (super->a_b.weight) {
             fprintf(out, "\t%s -> %s [ label = \"%.2f\" ]\n",
-                    super->a->name, super->b->name, super->weight_a_b);
+                    super->a->name, super->b->name, super->a_b.weight);
         }
-        if (super->weight_b_a) {
+        if (super->b_a.weight) {
             fprintf(out, "\t%s -> %s [ label = \"%.2f\" ]\n",
-                    super->b->name, super->a->name, super->weight_b_a);
+                    super->b->name, super->a->name, super->b_a.weight);
         }
     }
 
@@ -189,9 +352,35 @@ int topology_print(const char *file, const topology_t *t)
     return 0;
 }
 
-void topology_print_stats(const topology_t *t, bool reset)
+static void _print_link_stats(const struct node *from, const struct node *to,
+                              struct link *l, uint64_t elapsed_us, bool reset,
+                              bool last)
+{
+    printf("\t{ from: %s, to: %s, tx: %u, kbit_s: %" PRIu64 ", lost: %u, "
+           "overflow: %u, queue_us_avg: %" PRIu64 ", queue_us_max: %u, "
+           "latency_us_avg: %" PRIu64 " }%c\n",
+           from->name, to->name, l->num_tx,
+           elapsed_us ? (l->bytes_tx * 8 * 1000) / elapsed_us : 0,
+           l->num_lost, l->num_overflow,
+           l->num_tx ? l->queue_us_sum / l->num_tx : 0, l->queue_us_max,
+           l->num_tx ? l->latency_us_sum / l->num_tx : 0,
+           last ? ' ' : ',');
+
+    if (reset) {
+        l->num_tx = 0;
+        l->bytes_tx = 0;
+        l->num_lost = 0;
+        l->num_overflow = 0;
+        l->queue_us_sum = 0;
+        l->queue_us_max = 0;
+        l->latency_us_sum = 0;
+    }
+}
+
+void topology_print_stats(topology_t *t, bool reset)
 {
     uint32_t tx_total = 0;
+    uint64_t now = _now_us();
 
     puts("{ nodes: [");
     for (list_node_t *node = t->nodes.next; node; node = node->next) {
@@ -206,7 +395,20 @@ void topology_print_stats(const topology_t *t, bool reset)
             super->num_rx = 0;
         }
     }
+    puts("], links: [");
+    for (list_node_t *edge = t->edges.next; edge; edge = edge->next) {
+        struct edge *super = container_of(edge, struct edge, next);
+
+        _print_link_stats(super->a, super->b, &super->a_b,
+                          now - t->stats_since, reset, false);
+        _print_link_stats(super->b, super->a, &super->b_a,
+                          now - t->stats_since, reset, edge->next == NULL);
+    }
     printf("], tx_total: %u }\n", tx_total);
+
+    if (reset) {
+        t->stats_since = now;
+    }
 }
 
 int topology_parse(const char *file, topology_t *out)
@@ -237,18 +439,145 @@ int topology_parse(const char *file, topology_t *out)
         free(line);
     }
 
+    out->stats_since = _now_us();
+
     return 0;
 }
 
-void topology_send(const topology_t *t, int sock,
+static void _event_push(topology_t *t, struct event *ev)
+{
+    if (t->events_numof == t->events_max) {
+        t->events_max = t->events_max ? 2 * t->events_max : 64;
+        t->events = realloc(t->events, t->events_max * sizeof(*t->events));
+    }
+
+    /* sift up */
+    size_t i = t->events_numof++;
+    while (i > 0 && t->events[(i - 1) / 2]->due > ev->due) {
+        t->events[i] = t->events[(i - 1) / 2];
+        i = (i - 1) / 2;
+    }
+    t->events[i] = ev;
+}
+
+static struct event *_event_pop(topology_t *t)
+{
+    struct event *head = t->events[0];
+    struct event *last = t->events[--t->events_numof];
+
+    /* sift down */
+    size_t i = 0;
+    while (2 * i + 1 < t->events_numof) {
+        size_t child = 2 * i + 1;
+        if (child + 1 < t->events_numof &&
+            t->events[child + 1]->due < t->events[child]->due) {
+            child++;
+        }
+        if (last->due <= t->events[child]->due) {
+            break;
+        }
+        t->events[i] = t->events[child];
+        i = child;
+    }
+    t->events[i] = last;
+
+    return head;
+}
+
+static bool _link_lost(struct link *l)
+{
+    if (random() > l->weight * RAND_MAX) {
+        return true;
+    }
+
+    if (l->ge_p == 0) {
+        return false;
+    }
+
+    /* Gilbert-Elliott: change state, then drop with the loss of the state */
+    if (random() < (l->ge_bad ? l->ge_r : l->ge_p) * RAND_MAX) {
+        l->ge_bad = !l->ge_bad;
+    }
+
+    return random() < (l->ge_bad ? l->ge_loss_bad : l->ge_loss_good) * RAND_MAX;
+}
+
+static void _link_send(topology_t *t, int sock, struct link *l, struct node *dst,
+                       void *buffer, size_t len, uint64_t now)
+{
+    if (_link_lost(l)) {
+        l->num_lost++;
+        return;
+    }
+
+    zep_set_lqi(buffer, l->weight * 0xFF);
+
+    /* ideal link */
+    if (!l->delay_us && !l->jitter_us && !l->rate_bps) {
+        lockstep_sendto(sock, buffer, len, &dst->addr);
+        dst->num_rx++;
+        l->num_tx++;
+        l->bytes_tx += len;
+        return;
+    }
+
+    if (l->queued >= l->queue_len) {
+        l->num_overflow++;
+        return;
+    }
+
+    struct event *ev = malloc(sizeof(*ev) + len);
+    if (ev == NULL) {
+        l->num_overflow++;
+        return;
+    }
+
+    /* frames are serialized one after the other, only the 802.15.4 frame
+     * takes air time */
+    size_t frame_len = len;
+    if (zep_get_payload(buffer, &frame_len) == NULL) {
+        frame_len = len;
+    }
+
+    uint64_t start = l->busy_until > now ? l->busy_until : now;
+    l->busy_until = start;
+    if (l->rate_bps) {
+        l->busy_until += ((uint64_t)frame_len * 8 * 1000000) / l->rate_bps;
+    }
+    l->queue_us_sum += start - now;
+    if (start - now > l->queue_us_max) {
+        l->queue_us_max = start - now;
+    }
+
+    ev->due = l->busy_until + l->delay_us;
+    if (l->jitter_us) {
+        ev->due += random() % (l->jitter_us + 1);
+    }
+    /* jitter does not reorder frames */
+    if (ev->due < l->last_due) {
+        ev->due = l->last_due;
+    }
+    l->last_due = ev->due;
+
+    ev->received = now;
+    ev->link = l;
+    ev->dst = dst;
+    ev->len = len;
+    memcpy(ev->buffer, buffer, len);
+
+    l->queued++;
+    _event_push(t, ev);
+}
+
+void topology_send(topology_t *t, int sock,
                    const struct sockaddr_in6 *src_addr,
                    void *buffer, size_t len)
 {
     struct node *sender = NULL;
+    uint64_t now = _now_us();
 
     if (t->has_sniffer) {
-        sendto(sock, buffer, len, 0,
-               (struct sockaddr *)&t->sniffer_addr, sizeof(t->sniffer_addr));
+        lockstep_sendto(sock, buffer, len, &t->sniffer_addr);
     }
 
     for (list_node_t *edge = t->edges.next; edge; edge = edge->next) {
@@ -264,15 +593,7 @@ void topology_send(const topology_t *t, int sock,
                 sender->num_tx++;
             }
 
-            /* packet loss */
-            if (random() > super->weight_a_b * RAND_MAX) {
-                continue;
-            }
-            zep_set_lqi(buffer, super->weight_a_b * 0xFF);
-            sendto(sock, buffer, len, 0,
-                   (struct sockaddr *)&super->b->addr,
-                   sizeof(super->b->addr));
-            super->b->num_rx++;
+            _link_send(t, sock, &super->a_b, super->b, buffer, len, now);
         }
         else if (memcmp(&super->b->addr, src_addr, sizeof(*src_addr)) == 0) {
             if (sender == NULL) {
@@ -280,19 +601,41 @@ void topology_send(const topology_t *t, int sock,
                 sender->num_tx++;
             }
 
-            /* packet loss */
-            if (random() > super->weight_b_a * RAND_MAX) {
-                continue;
-            }
-            zep_set_lqi(buffer, super->weight_b_a * 0xFF);
-            sendto(sock, buffer, len, 0,
-                   (struct sockaddr *)&super->a->addr,
-                   sizeof(super->a->addr));
-            super->a->num_rx++;
+            _link_send(t, sock, &super->b_a, super->a, buffer, len, now);
         }
     }
 }
 
+int64_t topology_next_due(const topology_t *t)
+{
+    if (t->events_numof == 0) {
+        return -1;
+    }
+
+    uint64_t now = _now_us();
+
+    return t->events[0]->due > now ? (int64_t)(t->events[0]->due - now) : 0;
+}
+
+void topology_deliver(topology_t *t, int sock)
+{
+    uint64_t now = _now_us();
+
+    while (t->events_numof && t->events[0]->due <= now) {
+        struct event *ev = _event_pop(t);
+        struct link *l = ev->link;
+
+        lockstep_sendto(sock, ev->buffer, ev->len, &ev->dst->addr);
+        ev->dst->num_rx++;
+        l->queued--;
+        l->num_tx++;
+        l->bytes_tx += ev->len;
+        l->latency_us_sum += now - ev->received;
+
+        free(ev);
+    }
+}
+
 bool topology_add(topology_t *t, const uint8_t *mac, uint8_t mac_len,
                   struct sockaddr_in6 *addr)
 {
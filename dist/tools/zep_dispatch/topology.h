@@ -10,6 +10,7 @@
 
 #include "list.h"
 #include <netinet/in.h>
+#include <stdint.h>
 
 #ifdef __cplusplus
 extern "C" {
@@ -24,6 +25,10 @@ typedef struct {
     struct sockaddr_in6 sniffer_addr;   /**< address of sniffer node. Unused if topology is flat */
     bool has_sniffer;   /**< true if a sniffer node is connected. Unused if topology is flat */
     bool flat;          /**< flat topology, all nodes are connected to each other */
+    struct event **events;  /**< frames delayed by links, heap ordered by due time */
+    size_t events_numof;    /**< number of delayed frames */
+    size_t events_max;      /**< size of @p events */
+    uint64_t stats_since;   /**< start of the statistics period in µs */
 } topology_t;
 
 /**
@@ -49,11 +54,17 @@ int topology_parse(const char *file, topology_t *out);
 int topology_print(const char *file_out, const topology_t *t);
 
 /**
- * @brief   Print send / receive statistics
+ * @brief   Print send / receive statistics of nodes and links
+ *
+ * For every link, this prints the frames delivered, the throughput in kbit/s,
+ * the frames dropped by the loss models or on a full queue, the average and
+ * largest time frames waited for serialization and their average latency in
+ * the dispatcher.
  *
  * @param[in] t         The topology to render
+ * @param[in] reset     reset the statistics
  */
-void topology_print_stats(const topology_t *t, bool reset);
+void topology_print_stats(topology_t *t, bool reset);
 
 /**
  * @brief   Populate a spot in the topology with a connected node
@@ -81,16 +92,36 @@ void topology_set_sniffer(topology_t *t, struct sockaddr_in6 *addr);
 /**
  * @brief   Send a buffer to all nodes connected to a source node
  *
+ * Frames over links with a delay, jitter or rate are queued and later sent by
+ * @ref topology_deliver.
+ *
  * @param[in] t             topology to use
  * @param[in] sock          socket to use for sending
  * @param[in] src_addr      source node address
  * @param[in] buffer        ZEP frame to send
  * @param[in] len           ZEP frame length
  */
-void topology_send(const topology_t *t, int sock,
+void topology_send(topology_t *t, int sock,
                    const struct sockaddr_in6 *src_addr,
                    void *buffer, size_t len);
 
+/**
+ * @brief   Get the time until the next frame delayed by a link is due
+ *
+ * @param[in] t             topology to use
+ *
+ * @return time in µs, -1 if no frame is delayed
+ */
+int64_t topology_next_due(const topology_t *t);
+
+/**
+ * @brief   Send all frames delayed by links that are due
+ *
+ * @param[in] t             topology to use
+ * @param[in] sock          socket to use for sending
+ */
+void topology_deliver(topology_t *t, int sock);
+
 #ifdef __cplusplus
 }
 #endif
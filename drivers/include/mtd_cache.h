@@ -0,0 +1,132 @@
+/*
+ * Copyright (C) 2026 Mesotic SAS
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @defgroup    drivers_mtd_cache  MTD write-back sector cache
+ * @ingroup     drivers_storage
+ * @brief       Write-back LRU sector cache on top of another MTD device
+ *
+ * This MTD module keeps a small number of sectors of a backing MTD device in
+ * RAM. Writes only modify the cached copy of a sector, which is written back
+ * with a single erase and program cycle when the sector is evicted, when the
+ * device is powered down with @ref mtd_power or when @ref mtd_cache_flush is
+ * called. Many small writes to the same sector, e.g. file system metadata
+ * updates, thus cost one erase instead of one erase each.
+ *
+ * Erasing a sector through the cache erases it on the backing device right
+ * away and keeps the erased sector cached, so the data written afterwards is
+ * programmed without a second erase. Reads of sectors that are not cached
+ * are passed on to the backing device and do not allocate a cache line.
+ *
+ * The cache presents itself as a device that can be written without erasing,
+ * see @ref MTD_DRIVER_FLAG_DIRECT_WRITE.
+ *
+ * @warning Data that was written but not yet flushed is lost on power loss.
+ *
+ * ## Usage
+ *
+ * To use this module include it in your makefile:
+ *
+ * ```
+ * USEMODULE += mtd_cache
+ * ```
+ *
+ * A cache with two lines on top of an existing MTD device with 4096 byte
+ * sectors is defined as follows:
+ *
+ * ```
+ * static mtd_cache_line_t lines[2];
+ * static uint8_t buf[2 * 4096];
+ *
+ * mtd_cache_t cache = {
+ *     .mtd.driver = &mtd_cache_driver,
+ *     .parent = MTD_0,
+ *     .lines = lines,
+ *     .buf = buf,
+ *     .lines_numof = ARRAY_SIZE(lines),
+ * };
+ *
+ * mtd_dev_t *dev = &cache.mtd;
+ * ```
+ *
+ * The geometry of the cache device is taken from the backing device.
+ *
+ * @{
+ *
+ * @file
+ * @brief       Interface definitions for the MTD sector cache
+ */
+
+#ifndef MTD_CACHE_H
+#define MTD_CACHE_H
+
+#include <stdint.h>
+
+#include "mtd.h"
+#include "mutex.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   State of a cache line
+ */
+typedef struct {
+    uint32_t sector;            /**< sector of the backing device */
+    uint32_t used;              /**< time of the last access, for LRU */
+    uint8_t flags;              /**< valid, dirty and erased flags */
+} mtd_cache_line_t;
+
+/**
+ * @brief   Cache statistics
+ */
+typedef struct {
+    uint32_t hits;              /**< accesses to a cached sector */
+    uint32_t misses;            /**< accesses to a sector that was not cached */
+    uint32_t writebacks;        /**< dirty sectors written to the backing device */
+    uint32_t erases;            /**< sectors erased on the backing device */
+} mtd_cache_stats_t;
+
+/**
+ * @brief   MTD sector cache
+ */
+typedef struct {
+    mtd_dev_t mtd;              /**< MTD context */
+    mtd_dev_t *parent;          /**< backing MTD device */
+    mtd_cache_line_t *lines;    /**< cache line states */
+    uint8_t *buf;               /**< RAM for @ref lines_numof sectors */
+    uint8_t lines_numof;        /**< number of cache lines */
+    uint32_t clock;             /**< access counter for LRU */
+    mutex_t lock;               /**< lock for the cache and the backing device */
+    mtd_cache_stats_t stats;    /**< cache statistics */
+} mtd_cache_t;
+
+/**
+ * @brief   Cache MTD device operations table
+ */
+extern const mtd_desc_t mtd_cache_driver;
+
+/**
+ * @brief   Write all modified sectors back to the backing device
+ *
+ * The sectors stay cached.
+ *
+ * @param[in] cache     cache device
+ *
+ * @retval 0 on success
+ * @retval <0 error of the backing device
+ */
+int mtd_cache_flush(mtd_cache_t *cache);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* MTD_CACHE_H */
+/** @} */
@@ -0,0 +1,310 @@
+/*
+ * Copyright (C) 2026 Mesotic SAS
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     drivers_mtd_cache
+ * @{
+ *
+ * @file
+ * @brief       Write-back LRU sector cache for MTD devices
+ *
+ * @}
+ */
+
+#include <assert.h>
+#include <errno.h>
+#include <inttypes.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "container.h"
+#include "macros/utils.h"
+#include "mtd.h"
+#include "mtd_cache.h"
+#include "mutex.h"
+
+#define ENABLE_DEBUG 0
+#include "debug.h"
+
+#define LINE_VALID      (1 << 0)    /**< line holds a sector */
+#define LINE_DIRTY      (1 << 1)    /**< line was modified */
+#define LINE_ERASED     (1 << 2)    /**< sector is erased on the backing device */
+
+static uint32_t _sector_size(const mtd_cache_t *cache)
+{
+    return cache->mtd.pages_per_sector * cache->mtd.page_size;
+}
+
+static uint8_t *_line_buf(const mtd_cache_t *cache, const mtd_cache_line_t *line)
+{
+    return cache->buf + (line - cache->lines) * _sector_size(cache);
+}
+
+static mtd_cache_line_t *_find(mtd_cache_t *cache, uint32_t sector)
+{
+    for (unsigned i = 0; i < cache->lines_numof; i++) {
+        mtd_cache_line_t *line = &cache->lines[i];
+
+        if ((line->flags & LINE_VALID) && line->sector == sector) {
+            line->used = ++cache->clock;
+            return line;
+        }
+    }
+
+    return NULL;
+}
+
+static int _writeback(mtd_cache_t *cache, mtd_cache_line_t *line)
+{
+    mtd_dev_t *parent = cache->parent;
+    int res;
+
+    if (!(line->flags & LINE_DIRTY)) {
+        return 0;
+    }
+
+    DEBUG("mtd_cache: write back sector %" PRIu32 "%s\n", line->sector,
+          (line->flags & LINE_ERASED) ? " (erased)" : "");
+
+    if (line->flags & LINE_ERASED) {
+        res = mtd_write_page_raw(parent, _line_buf(cache, line),
+                                 line->sector * parent->pages_per_sector, 0,
+                                 _sector_size(cache));
+    }
+    else {
+        res = mtd_write_sector(parent, _line_buf(cache, line), line->sector, 1);
+        if (!(parent->driver->flags & MTD_DRIVER_FLAG_DIRECT_WRITE)) {
+            cache->stats.erases++;
+        }
+    }
+    if (res < 0) {
+        return res;
+    }
+
+    cache->stats.writebacks++;
+    line->flags &= ~(LINE_DIRTY | LINE_ERASED);
+    return 0;
+}
+
+/* frees the least recently used line and assigns it to sector */
+static mtd_cache_line_t *_alloc(mtd_cache_t *cache, uint32_t sector, int *res)
+{
+    mtd_cache_line_t *victim = &cache->lines[0];
+
+    for (unsigned i = 0; i < cache->lines_numof; i++) {
+        mtd_cache_line_t *line = &cache->lines[i];
+
+        if (!(line->flags & LINE_VALID)) {
+            victim = line;
+            break;
+        }
+        if (line->used < victim->used) {
+            victim = line;
+        }
+    }
+
+    *res = _writeback(cache, victim);
+    if (*res < 0) {
+        return NULL;
+    }
+
+    victim->sector = sector;
+    victim->used = ++cache->clock;
+    victim->flags = 0;
+    return victim;
+}
+
+static int _load(mtd_cache_t *cache, mtd_cache_line_t *line)
+{
+    int res = mtd_read_page(cache->parent, _line_buf(cache, line),
+                            line->sector * cache->mtd.pages_per_sector, 0,
+                            _sector_size(cache));
+    if (res < 0) {
+        line->flags = 0;
+        return res;
+    }
+
+    line->flags = LINE_VALID;
+    return 0;
+}
+
+/* returns the line for sector, loads it unless it will be overwritten */
+static mtd_cache_line_t *_get(mtd_cache_t *cache, uint32_t sector, bool load,
+                              int *res)
+{
+    mtd_cache_line_t *line = _find(cache, sector);
+
+    if (line) {
+        cache->stats.hits++;
+        return line;
+    }
+
+    cache->stats.misses++;
+    line = _alloc(cache, sector, res);
+    if (line == NULL) {
+        return NULL;
+    }
+
+    if (load) {
+        *res = _load(cache, line);
+        if (*res < 0) {
+            return NULL;
+        }
+    }
+
+    line->flags = LINE_VALID;
+    return line;
+}
+
+static int _init(mtd_dev_t *mtd)
+{
+    mtd_cache_t *cache = container_of(mtd, mtd_cache_t, mtd);
+    mtd_dev_t *parent = cache->parent;
+
+    assert(cache->lines_numof > 0);
+
+    int res = mtd_init(parent);
+    if (res < 0) {
+        return res;
+    }
+
+    /* inherit physical properties, any write size is absorbed by the cache */
+    mtd->sector_count = parent->sector_count;
+    mtd->pages_per_sector = parent->pages_per_sector;
+    mtd->page_size = parent->page_size;
+    mtd->write_size = 1;
+
+    mutex_init(&cache->lock);
+    memset(cache->lines, 0, cache->lines_numof * sizeof(*cache->lines));
+    memset(&cache->stats, 0, sizeof(cache->stats));
+    cache->clock = 0;
+
+    return 0;
+}
+
+static int _read_page(mtd_dev_t *mtd, void *dest, uint32_t page,
+                      uint32_t offset, uint32_t size)
+{
+    mtd_cache_t *cache = container_of(mtd, mtd_cache_t, mtd);
+    uint32_t sector = page / mtd->pages_per_sector;
+    uint32_t pos = (page % mtd->pages_per_sector) * mtd->page_size + offset;
+    int res;
+
+    size = MIN(size, _sector_size(cache) - pos);
+
+    mutex_lock(&cache->lock);
+    mtd_cache_line_t *line = _find(cache, sector);
+    if (line) {
+        cache->stats.hits++;
+        memcpy(dest, _line_buf(cache, line) + pos, size);
+        res = size;
+    }
+    else {
+        cache->stats.misses++;
+        res = mtd_read_page(cache->parent, dest, page, offset, size);
+    }
+    mutex_unlock(&cache->lock);
+
+    return (res < 0) ? res : (int)size;
+}
+
+static int _write_page(mtd_dev_t *mtd, const void *src, uint32_t page,
+                       uint32_t offset, uint32_t size)
+{
+    mtd_cache_t *cache = container_of(mtd, mtd_cache_t, mtd);
+    uint32_t sector = page / mtd->pages_per_sector;
+    uint32_t pos = (page % mtd->pages_per_sector) * mtd->page_size + offset;
+    int res = 0;
+
+    size = MIN(size, _sector_size(cache) - pos);
+
+    mutex_lock(&cache->lock);
+    mtd_cache_line_t *line = _get(cache, sector, size < _sector_size(cache), &res);
+    if (line) {
+        memcpy(_line_buf(cache, line) + pos, src, size);
+        line->flags |= LINE_DIRTY;
+    }
+    mutex_unlock(&cache->lock);
+
+    return (res < 0) ? res : (int)size;
+}
+
+static int _erase_sector(mtd_dev_t *mtd, uint32_t sector, uint32_t count)
+{
+    mtd_cache_t *cache = container_of(mtd, mtd_cache_t, mtd);
+    int res = 0;
+
+    mutex_lock(&cache->lock);
+    for (; count; count--, sector++) {
+        mtd_cache_line_t *line = _find(cache, sector);
+
+        /* pending data of the sector is discarded */
+        if (line) {
+            line->flags &= ~LINE_DIRTY;
+        }
+
+        res = mtd_erase_sector(cache->parent, sector, 1);
+        if (res < 0) {
+            break;
+        }
+        cache->stats.erases++;
+
+        /* keep the erased sector, data written to it next needs no erase */
+        if (line == NULL) {
+            line = _alloc(cache, sector, &res);
+            if (line == NULL) {
+                break;
+            }
+        }
+        res = _load(cache, line);
+        if (res < 0) {
+            break;
+        }
+        line->flags |= LINE_ERASED;
+    }
+    mutex_unlock(&cache->lock);
+
+    return (res < 0) ? res : 0;
+}
+
+static int _power(mtd_dev_t *mtd, enum mtd_power_state power)
+{
+    mtd_cache_t *cache = container_of(mtd, mtd_cache_t, mtd);
+
+    if (power == MTD_POWER_DOWN) {
+        int res = mtd_cache_flush(cache);
+        if (res < 0) {
+            return res;
+        }
+    }
+
+    int res = mtd_power(cache->parent, power);
+    return (res == -ENOTSUP) ? 0 : res;
+}
+
+int mtd_cache_flush(mtd_cache_t *cache)
+{
+    int res = 0;
+
+    mutex_lock(&cache->lock);
+    for (unsigned i = 0; i < cache->lines_numof && res == 0; i++) {
+        res = _writeback(cache, &cache->lines[i]);
+    }
+    mutex_unlock(&cache->lock);
+
+    return res;
+}
+
+const mtd_desc_t mtd_cache_driver = {
+    .init = _init,
+    .read_page = _read_page,
+    .write_page = _write_page,
+    .erase_sector = _erase_sector,
+    .power = _power,
+    .flags = MTD_DRIVER_FLAG_DIRECT_WRITE,
+};
@@ -67,6 +67,7 @@ FEATURES_EXISTING := \
     cpu_core_atmega \
     cpu_core_atxmega \
     cpu_core_cortexm \
+    cpu_cycle_counter \
     cpu_efm32 \
     cpu_esp32 \
     cpu_esp8266 \
@@ -60,6 +60,7 @@ PSEUDOMODULES += cpp
 PSEUDOMODULES += cpu_check_address
 PSEUDOMODULES += crc16_fast
 PSEUDOMODULES += crc32_fast
+PSEUDOMODULES += crc32_slice8
 PSEUDOMODULES += credman_load
 PSEUDOMODULES += dbgpin
 PSEUDOMODULES += devfs_%
@@ -131,6 +132,7 @@ PSEUDOMODULES += gnrc_netif_ipv6
 PSEUDOMODULES += gnrc_netif_mac
 PSEUDOMODULES += gnrc_netif_single
 PSEUDOMODULES += gnrc_netif_dedup
+PSEUDOMODULES += gnrc_netif_rx_batch
 
 
 ## @addtogroup 	net_gnrc_nettype
@@ -208,6 +210,7 @@ PSEUDOMODULES += gnrc_nettype_udp
 ## @}
 
 
+PSEUDOMODULES += gnrc_pktbuf_static_sizeclass
 PSEUDOMODULES += gnrc_sixloenc
 PSEUDOMODULES += gnrc_sixlowpan_border_router_default
 PSEUDOMODULES += gnrc_sixlowpan_default
@@ -247,11 +250,30 @@ PSEUDOMODULES += gnrc_sixlowpan_frag_sfr_congure_quic
 PSEUDOMODULES += gnrc_sixlowpan_frag_sfr_congure_sfr
 ## @}
 ## @}
+## @defgroup net_gnrc_sixlowpan_iphc_cache gnrc_sixlowpan_iphc_cache: IPHC flow cache
+## @ingroup net_gnrc_sixlowpan_iphc
+## @brief   Caches the compressed IPv6 header of recently sent flows
+## @see     @ref CONFIG_GNRC_SIXLOWPAN_IPHC_CACHE_SIZE
+## @{
+PSEUDOMODULES += gnrc_sixlowpan_iphc_cache
+## @}
 PSEUDOMODULES += gnrc_sixlowpan_iphc_nhc
 PSEUDOMODULES += gnrc_sixlowpan_nd_border_router
 PSEUDOMODULES += gnrc_sixlowpan_router_default
 PSEUDOMODULES += gnrc_sock_async
 PSEUDOMODULES += gnrc_sock_check_reuse
+## @defgroup net_gnrc_tcp_ooo gnrc_tcp_ooo: Out-of-order reassembly for GNRC TCP
+## @ingroup net_gnrc_tcp
+## @brief   Holds segments received ahead of a gap and acknowledges them selectively
+##
+## Without this module, GNRC TCP drops every segment that does not start at
+## the next expected sequence number. With it, up to
+## @ref CONFIG_GNRC_TCP_OOO_QUEUE_SIZE such segments per connection stay in
+## the packet buffer until the gap is filled, and are reported to the peer in
+## a SACK option (RFC 2018) if the peer permitted it during the handshake.
+## @{
+PSEUDOMODULES += gnrc_tcp_ooo
+## @}
 PSEUDOMODULES += gnrc_txtsnd
 PSEUDOMODULES += ieee802154_security
 PSEUDOMODULES += ieee802154_submac
@@ -311,6 +333,9 @@ PSEUDOMODULES += nanocoap_%
 PSEUDOMODULES += nanocoap_fileserver_callback
 PSEUDOMODULES += nanocoap_fileserver_delete
 PSEUDOMODULES += nanocoap_fileserver_put
+## @defgroup pseudomodule_native_vtime native_vtime
+## @brief Skip idle time on native, see @ref cpu_native_vtime
+PSEUDOMODULES += native_vtime
 PSEUDOMODULES += netdev_default
 PSEUDOMODULES += netdev_ieee802154_%
 PSEUDOMODULES += netdev_ieee802154_rx_timestamp
@@ -320,6 +345,7 @@ PSEUDOMODULES += netdev_layer
 PSEUDOMODULES += netdev_legacy_api
 PSEUDOMODULES += netdev_new_api
 PSEUDOMODULES += netdev_register
+PSEUDOMODULES += netdev_tap_rx_ring
 PSEUDOMODULES += netstats
 PSEUDOMODULES += netstats_l2
 PSEUDOMODULES += netstats_neighbor_etx
@@ -383,6 +409,9 @@ PSEUDOMODULES += saul_pwm
 PSEUDOMODULES += scanf_float
 PSEUDOMODULES += sched_cb
 PSEUDOMODULES += sched_runq_callback
+PSEUDOMODULES += sched_wakeup_callback
+PSEUDOMODULES += schedstatistics_cycles
+PSEUDOMODULES += schedstatistics_hist
 ## @defgroup pseudomodule_sema_deprecated sema_deprecated
 ## @ingroup sys_sema
 ## @{
@@ -454,6 +483,7 @@ PSEUDOMODULES += shell_cmd_random
 PSEUDOMODULES += shell_cmd_rtc
 PSEUDOMODULES += shell_cmd_rtt
 PSEUDOMODULES += shell_cmd_saul_reg
+PSEUDOMODULES += shell_cmd_schedstatistics
 PSEUDOMODULES += shell_cmd_semtech-loramac
 PSEUDOMODULES += shell_cmd_sha1sum
 PSEUDOMODULES += shell_cmd_sha256sum
@@ -508,6 +538,7 @@ PSEUDOMODULES += suit_storage_%
 PSEUDOMODULES += sys_bus_%
 PSEUDOMODULES += tiny_strerror_as_strerror
 PSEUDOMODULES += tiny_strerror_minimal
+PSEUDOMODULES += trace_%
 PSEUDOMODULES += usbus_urb
 PSEUDOMODULES += vdd_lc_filter_%
 ## @defgroup pseudomodule_vfs_auto_format vfs_auto_format
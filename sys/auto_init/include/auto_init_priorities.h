@@ -59,6 +59,12 @@ extern "C" {
  */
 #define AUTO_INIT_PRIO_MOD_SCHEDSTATISTICS              1050
 #endif
+#ifndef AUTO_INIT_PRIO_MOD_TRACE_SCHED
+/**
+ * @brief   trace scheduler events priority
+ */
+#define AUTO_INIT_PRIO_MOD_TRACE_SCHED                  1055
+#endif
 #ifndef AUTO_INIT_PRIO_MOD_SCHED_ROUND_ROBIN
 /**
  * @brief   round robin scheduling priority
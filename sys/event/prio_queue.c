@@ -0,0 +1,125 @@
+/*
+ * Copyright (C) 2026 Mesotic SAS
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     sys_event
+ * @{
+ *
+ * @file
+ * @brief       Priority event queue implementation
+ *
+ * @}
+ */
+
+#include <assert.h>
+
+#include "bitarithm.h"
+#include "event/prio_queue.h"
+#include "irq.h"
+#include "thread_flags.h"
+
+static_assert(CONFIG_EVENT_PRIO_QUEUE_LEVELS <= (8 * sizeof(unsigned)),
+              "CONFIG_EVENT_PRIO_QUEUE_LEVELS exceeds bits of pending mask");
+
+static inline event_prio_t *_next(const event_prio_t *event)
+{
+    /* list_node is the first member of event_t, which is the first member of
+     * event_prio_t */
+    return (event_prio_t *)event->super.list_node.next;
+}
+
+static inline void _set_next(event_prio_t *event, event_prio_t *next)
+{
+    event->super.list_node.next = &next->super.list_node;
+}
+
+void event_prio_post(event_prio_queue_t *queue, event_prio_t *event)
+{
+    assert(queue && event);
+    assert(event->super.handler);
+    assert(event->level < CONFIG_EVENT_PRIO_QUEUE_LEVELS);
+
+    unsigned state = irq_disable();
+    if (!event_prio_is_queued(event)) {
+        event_prio_t *head = queue->head[event->level];
+
+        if (head == NULL) {
+            _set_next(event, event);
+            event->prev = event;
+            queue->head[event->level] = event;
+            queue->pending |= 1U << event->level;
+        }
+        else {
+            /* the oldest event's predecessor is the newest one */
+            _set_next(event, head);
+            event->prev = head->prev;
+            _set_next(head->prev, event);
+            head->prev = event;
+        }
+    }
+    thread_t *waiter = queue->waiter;
+    irq_restore(state);
+
+    if (waiter) {
+        thread_flags_set(waiter, THREAD_FLAG_EVENT);
+    }
+}
+
+static void _remove(event_prio_queue_t *queue, event_prio_t *event)
+{
+    event_prio_t *next = _next(event);
+
+    if (next == event) {
+        queue->head[event->level] = NULL;
+        queue->pending &= ~(1U << event->level);
+    }
+    else {
+        _set_next(event->prev, next);
+        next->prev = event->prev;
+        if (queue->head[event->level] == event) {
+            queue->head[event->level] = next;
+        }
+    }
+    event->super.list_node.next = NULL;
+}
+
+void event_prio_cancel(event_prio_queue_t *queue, event_prio_t *event)
+{
+    assert(queue && event);
+
+    unsigned state = irq_disable();
+    if (event_prio_is_queued(event)) {
+        _remove(queue, event);
+    }
+    irq_restore(state);
+}
+
+event_prio_t *event_prio_get(event_prio_queue_t *queue)
+{
+    event_prio_t *result = NULL;
+
+    assert(queue);
+    unsigned state = irq_disable();
+    if (queue->pending) {
+        result = queue->head[bitarithm_lsb(queue->pending)];
+        _remove(queue, result);
+    }
+    irq_restore(state);
+    return result;
+}
+
+event_prio_t *event_prio_wait(event_prio_queue_t *queue)
+{
+    event_prio_t *result;
+
+    assert(queue && queue->waiter);
+    while ((result = event_prio_get(queue)) == NULL) {
+        thread_flags_wait_any(THREAD_FLAG_EVENT);
+    }
+    return result;
+}
@@ -33,7 +33,9 @@ extern "C" {
  * Uses the `0xedb88320` polynomial
  *
  * @note enable the `crc32_fast` module for a look-up table based implementation
- *       that trades code size for speed.
+ *       that trades code size for speed. The `crc32_slice8` module
+ *       additionally processes eight bytes per iteration using 8 KiB of
+ *       tables, which pays off on cores with fast memory access.
  *
  * @param[in] buf   The data to checksum
  * @param[in] size  Length of the data in bytes
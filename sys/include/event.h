@@ -271,6 +271,7 @@ void event_post(event_queue_t *queue, event_t *event);
  * This will remove a queued event from an event queue.
  *
  * @note    Due to the underlying list implementation, this will run in O(n).
+ *          See @ref event_prio_cancel() for an O(1) alternative.
  *
  * @param[in]   queue   event queue to remove event from
  * @param[in]   event   event to remove from queue
@@ -0,0 +1,228 @@
+/*
+ * Copyright (C) 2026 Mesotic SAS
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser General
+ * Public License v2.1. See the file LICENSE in the top level directory for
+ * more details.
+ */
+
+/**
+ * @ingroup     sys_event
+ * @brief       Event queue with priority levels and O(1) cancellation
+ *
+ * An @ref event_prio_queue_t holds @ref CONFIG_EVENT_PRIO_QUEUE_LEVELS FIFO
+ * lists of events, one per priority level, and is served by a single thread.
+ * @ref event_prio_wait() returns the oldest event of the highest priority
+ * level that has any, so a burst of low priority events only delays an urgent
+ * one by the handler that is already running. Unlike with
+ * @ref event_wait_multi() on an array of @ref event_queue_t, posting, getting
+ * and cancelling an event take constant time, regardless of the number of
+ * levels and of events queued.
+ *
+ * Each event keeps its level in @ref event_prio_t::level. Lower levels run
+ * first, level 0 being the most urgent one. The levels are strict: events of a
+ * level only run when no event of a more urgent level is queued.
+ *
+ * Example:
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~ {.c}
+ * static void _tx_done(event_t *event) { ... }
+ * static void _sense(event_t *event) { ... }
+ *
+ * static event_prio_t _tx_done_ev = EVENT_PRIO_INIT(_tx_done, 0);
+ * static event_prio_t _sense_ev = EVENT_PRIO_INIT(_sense, 2);
+ * static event_prio_queue_t _queue;
+ *
+ * void *_thread(void *arg)
+ * {
+ *     event_prio_queue_init(&_queue);
+ *     event_prio_loop(&_queue);
+ * }
+ *
+ * [...] event_prio_post(&_queue, &_tx_done_ev);
+ * ~~~~~~~~~~~~~~~~~~~~~~~~
+ *
+ * @{
+ *
+ * @file
+ * @brief       Priority event queue API
+ */
+
+#ifndef EVENT_PRIO_QUEUE_H
+#define EVENT_PRIO_QUEUE_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "event.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Number of priority levels of an @ref event_prio_queue_t
+ *
+ * At most the number of bits of `unsigned`.
+ */
+#ifndef CONFIG_EVENT_PRIO_QUEUE_LEVELS
+#define CONFIG_EVENT_PRIO_QUEUE_LEVELS  (4U)
+#endif
+
+/**
+ * @brief   Static initializer for an @ref event_prio_t
+ *
+ * @param[in]   _handler    event handler
+ * @param[in]   _level      priority level, 0 is the most urgent
+ */
+#define EVENT_PRIO_INIT(_handler, _level) \
+    { .super.handler = (_handler), .level = (_level) }
+
+/**
+ * @brief   Event for an @ref event_prio_queue_t
+ *
+ * The handler of @p super is called with a pointer to @p super. As with
+ * @ref event_t, the structure can be extended to provide context to the
+ * handler.
+ */
+typedef struct event_prio {
+    /**
+     * @brief   Event, `super.list_node.next` links to the next event of the
+     *          same level and is NULL while the event is not queued
+     */
+    event_t super;
+    struct event_prio *prev;    /**< previous event of the same level */
+    uint8_t level;              /**< priority level, 0 is the most urgent */
+} event_prio_t;
+
+/**
+ * @brief   Event queue with priority levels
+ */
+typedef struct {
+    /**
+     * @brief   Oldest event per level, the events of a level form a circular
+     *          list
+     */
+    event_prio_t *head[CONFIG_EVENT_PRIO_QUEUE_LEVELS];
+    unsigned pending;           /**< bit per level with events queued */
+    thread_t *waiter;           /**< thread owning the queue */
+} event_prio_queue_t;
+
+/**
+ * @brief   Initialize a priority event queue
+ *
+ * This will set the calling thread as owner of @p queue.
+ *
+ * @param[out]  queue   queue to initialize
+ */
+static inline void event_prio_queue_init(event_prio_queue_t *queue)
+{
+    memset(queue, 0, sizeof(*queue));
+    queue->waiter = thread_get_active();
+}
+
+/**
+ * @brief   Initialize a priority event queue not binding it to a thread
+ *
+ * @param[out]  queue   queue to initialize
+ */
+static inline void event_prio_queue_init_detached(event_prio_queue_t *queue)
+{
+    memset(queue, 0, sizeof(*queue));
+}
+
+/**
+ * @brief   Bind a priority event queue to the calling thread
+ *
+ * @pre     (queue->waiter == NULL)
+ *
+ * @param[out]  queue   queue to bind to the calling thread
+ */
+static inline void event_prio_queue_claim(event_prio_queue_t *queue)
+{
+    assert(queue->waiter == NULL);
+    queue->waiter = thread_get_active();
+}
+
+/**
+ * @brief   Queue an event at the end of its level
+ *
+ * If the event is already queued, it is not touched and keeps its position.
+ *
+ * @pre     event->level < CONFIG_EVENT_PRIO_QUEUE_LEVELS
+ *
+ * @param[in]   queue   queue to post @p event to
+ * @param[in]   event   event to queue
+ */
+void event_prio_post(event_prio_queue_t *queue, event_prio_t *event);
+
+/**
+ * @brief   Remove a queued event from a priority event queue
+ *
+ * This runs in O(1). Nothing happens if @p event is not queued.
+ *
+ * @param[in]   queue   queue @p event was posted to
+ * @param[in]   event   event to remove
+ */
+void event_prio_cancel(event_prio_queue_t *queue, event_prio_t *event);
+
+/**
+ * @brief   Check if an event is queued
+ *
+ * @param[in]   event   event to check
+ *
+ * @returns true if @p event is in a queue
+ * @returns false otherwise
+ */
+static inline bool event_prio_is_queued(const event_prio_t *event)
+{
+    return event->super.list_node.next != NULL;
+}
+
+/**
+ * @brief   Get the next event of the most urgent level, non-blocking
+ *
+ * @param[in]   queue   queue to get the event from
+ *
+ * @returns     the oldest event of the most urgent level with events
+ * @returns     NULL if no event is queued
+ */
+event_prio_t *event_prio_get(event_prio_queue_t *queue);
+
+/**
+ * @brief   Get the next event of the most urgent level, blocking
+ *
+ * @warning There can only be a single waiter on a queue!
+ *
+ * @pre     The queue must have a waiter (i.e. it should have been claimed, or
+ *          initialized using @ref event_prio_queue_init)
+ *
+ * @param[in]   queue   queue to get the event from
+ *
+ * @returns     the oldest event of the most urgent level with events
+ */
+event_prio_t *event_prio_wait(event_prio_queue_t *queue);
+
+/**
+ * @brief   Wait for events and run their handlers, forever
+ *
+ * @pre     The queue must have a waiter (i.e. it should have been claimed, or
+ *          initialized using @ref event_prio_queue_init)
+ *
+ * @param[in]   queue   queue to process
+ */
+static inline void event_prio_loop(event_prio_queue_t *queue)
+{
+    event_prio_t *event;
+
+    while ((event = event_prio_wait(queue))) {
+        event->super.handler(&event->super);
+    }
+}
+
+#ifdef __cplusplus
+}
+#endif
+#endif /* EVENT_PRIO_QUEUE_H */
+/** @} */
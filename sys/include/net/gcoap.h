@@ -849,6 +849,9 @@ struct gcoap_request_memo {
     /**
      * @brief   Cache key for the request
      *
+     * The key is generated once when the request is sent and reused for
+     * the cache lookup and for processing the response.
+     *
      * @note    Only available with module ['nanocoap_cache'](@ref net_nanocoap_cache)
      */
     uint8_t cache_key[CONFIG_NANOCOAP_CACHE_KEY_LENGTH];
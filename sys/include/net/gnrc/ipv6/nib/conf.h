@@ -303,6 +303,27 @@ extern "C" {
 #define CONFIG_GNRC_IPV6_NIB_OFFL_NUMOF              (8)
 #endif
 
+/**
+ * @brief   Number of hash buckets to look up NIB entries by address
+ *
+ * If not 0, on-link entries are indexed by their IPv6 address and off-link
+ * entries by their prefix, so they are found without comparing against
+ * every entry of the NIB. Routes are then resolved by looking up the
+ * destination once per prefix length in use, longest first. Of two
+ * matching routes the one with the longer prefix is then always taken,
+ * while the linear search takes the first one in the NIB if the
+ * destination shares as many bits with the shorter prefix, e.g.
+ * 2001:db8::1 with 2001:db8::/32 and 2001:db8::/64. This costs
+ * 2 bytes per bucket and 4 bytes per entry for each table, plus about
+ * 280 bytes for the prefix lengths, and pays off for large values of
+ * @ref CONFIG_GNRC_IPV6_NIB_NUMOF and @ref CONFIG_GNRC_IPV6_NIB_OFFL_NUMOF,
+ * e.g. on a border router. A value close to the larger one of both is a
+ * good choice.
+ */
+#ifndef CONFIG_GNRC_IPV6_NIB_HASH_NUMOF
+#define CONFIG_GNRC_IPV6_NIB_HASH_NUMOF              (0)
+#endif
+
 #if CONFIG_GNRC_IPV6_NIB_MULTIHOP_P6C || defined(DOXYGEN)
 /**
  * @brief   Number of authoritative border router entries in NIB
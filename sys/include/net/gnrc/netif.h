@@ -52,6 +52,9 @@
 #if defined(MODULE_GNRC_NETIF_DEDUP) && (GNRC_NETIF_L2ADDR_MAXLEN > 0)
 #include "net/gnrc/netif/dedup.h"
 #endif
+#if IS_USED(MODULE_GNRC_NETIF_RX_BATCH)
+#include "net/gnrc/netif/rx_batch.h"
+#endif
 #include "net/gnrc/netif/flags.h"
 #if IS_USED(MODULE_GNRC_NETIF_IPV6)
 #include "net/gnrc/netif/ipv6.h"
@@ -216,6 +219,21 @@ typedef struct {
      * @note    Only available with @ref net_gnrc_netif_pktq.
      */
     gnrc_netif_pktq_t send_queue;
+#endif
+#if IS_USED(MODULE_GNRC_NETIF_RX_BATCH) || defined(DOXYGEN)
+    /**
+     * @brief   Event to continue draining the device once the receive budget
+     *          is exhausted
+     *
+     * @note    Only available with @ref net_gnrc_netif_rx_batch.
+     */
+    event_t event_rx;
+    /**
+     * @brief   Batch reception statistics
+     *
+     * @note    Only available with @ref net_gnrc_netif_rx_batch.
+     */
+    gnrc_netif_rx_batch_stats_t rx_batch;
 #endif
     /**
      * @brief   Message queue for the netif thread
@@ -769,6 +787,21 @@ bool gnrc_netif_ipv6_wait_for_global_address(gnrc_netif_t *netif,
                                              uint32_t timeout_ms);
 #endif /* MODULE_GNRC_NETIF_BUS */
 
+#if IS_USED(MODULE_GNRC_NETIF_RX_BATCH) || defined(DOXYGEN)
+/**
+ * @brief   Get the batch reception statistics of an interface
+ *
+ * @note    Only available with @ref net_gnrc_netif_rx_batch.
+ *
+ * @param[in] netif     pointer to the interface
+ * @param[out] stats    the statistics
+ * @param[in] reset     reset the statistics after reading them
+ */
+void gnrc_netif_rx_batch_stats(gnrc_netif_t *netif,
+                               gnrc_netif_rx_batch_stats_t *stats, bool reset);
+#endif
+
+
 #ifdef __cplusplus
 }
 #endif
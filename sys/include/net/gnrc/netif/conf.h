@@ -163,6 +163,18 @@ extern "C" {
 #define CONFIG_GNRC_NETIF_DEFAULT_HL      (64U)   /**< default hop limit */
 #endif
 
+/**
+ * @brief   Maximum number of frames received per RX event
+ *
+ * With @ref net_gnrc_netif_rx_batch the interface keeps reading frames as
+ * long as the device reports @ref NETOPT_RX_PENDING, up to this budget. If
+ * frames are still pending after that, the interface handles its other events
+ * first and continues draining afterwards.
+ */
+#ifndef CONFIG_GNRC_NETIF_RX_BUDGET
+#define CONFIG_GNRC_NETIF_RX_BUDGET                 (8U)
+#endif
+
 /**
  * @brief   Minimum wait time in microseconds after a send operation
  *
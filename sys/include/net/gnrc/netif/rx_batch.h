@@ -0,0 +1,74 @@
+/*
+ * Copyright (C) 2026 Mesotic SAS
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @defgroup    net_gnrc_netif_rx_batch    Batched frame reception
+ * @ingroup     net_gnrc_netif
+ * @brief       Receives several frames per device event
+ *
+ * To activate, use `USEMODULE += gnrc_netif_rx_batch` in your applications
+ * Makefile.
+ *
+ * Without this module the interface reads a single frame for each
+ * @ref NETDEV_EVENT_RX_COMPLETE. With it, the interface keeps reading frames
+ * while the device reports @ref NETOPT_RX_PENDING, up to
+ * @ref CONFIG_GNRC_NETIF_RX_BUDGET frames. The frames of such a batch are
+ * passed to the upper layer back-to-back once the device is drained. If the
+ * budget is exhausted while frames are still pending, the remaining frames
+ * are read from a new low priority event, so sending and other events are not
+ * starved by a receive burst.
+ *
+ * Devices that do not support @ref NETOPT_RX_PENDING behave as without this
+ * module.
+ *
+ * The batch size distribution is available with
+ * @ref gnrc_netif_rx_batch_stats and printed by `ifconfig`.
+ *
+ * @{
+ *
+ * @file
+ * @brief   Definitions for batched frame reception
+ */
+#ifndef NET_GNRC_NETIF_RX_BATCH_H
+#define NET_GNRC_NETIF_RX_BATCH_H
+
+#include <stdint.h>
+
+#include "net/gnrc/netif/conf.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Number of buckets of the batch size histogram
+ *
+ * Bucket `i` counts batches of `2^i` to `2^(i+1) - 1` frames, the last bucket
+ * counts all larger batches.
+ */
+#define GNRC_NETIF_RX_BATCH_HIST_NUMOF  (5U)
+
+/**
+ * @brief   Batch reception statistics of an interface
+ */
+typedef struct {
+    uint32_t events;            /**< receive events handled */
+    uint32_t frames;            /**< frames received */
+    uint32_t budget_exhausted;  /**< batches that ended with frames pending */
+    /**
+     * @brief   Batch size histogram, see @ref GNRC_NETIF_RX_BATCH_HIST_NUMOF
+     */
+    uint32_t hist[GNRC_NETIF_RX_BATCH_HIST_NUMOF];
+} gnrc_netif_rx_batch_stats_t;
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* NET_GNRC_NETIF_RX_BATCH_H */
+/** @} */
@@ -18,6 +18,15 @@
  *          this *will* lead to alignment problems and can potentially result
  *          in segmentation/hard faults and other unexpected behaviour.
  *
+ * The static packet buffer keeps its free space in a first-fit list by
+ * default. With the module `gnrc_pktbuf_static_sizeclass` free chunks are
+ * instead kept in segregated lists of size classes (four per power of two)
+ * indexed by a bitmap, and neighbouring free chunks are coalesced via
+ * boundary tags. Allocation and release then take constant time and
+ * long-lived large packets cause less fragmentation, at the cost of about
+ * 130 bytes of RAM for the class lists and one bit per 8 (or 16) bytes of
+ * packet buffer.
+ *
  * @{
  *
  * @file
@@ -302,7 +311,9 @@ int gnrc_pktbuf_merge(gnrc_pktsnip_t *pkt);
  *
  * @note    Only available with DEVELHELP defined.
  *
- * @details Statistics include maximum number of reserved bytes.
+ * @details Statistics include maximum number of reserved bytes, the number
+ *          of free bytes and chunks, the fragmentation of the free space and
+ *          the number of failed allocations.
  */
 void gnrc_pktbuf_stats(void);
 #endif
@@ -125,6 +125,22 @@ extern "C" {
 #define CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_DEL_TIMER              (0U)
 #endif
 
+/**
+ * @brief   Number of buckets in the hash index of the reassembly buffer
+ *
+ * @note    Only applicable with
+ *          [gnrc_sixlowpan_frag_rb](@ref net_gnrc_sixlowpan_frag_rb) module
+ *
+ * When not 0, entries of the reassembly buffer are indexed by their source
+ * and tag, so looking up the entry of a received fragment no longer checks
+ * every entry of the buffer. This pays off from about 8 concurrent datagrams
+ * on; set it to about @ref CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_SIZE then. With 0,
+ * the buffer is searched linearly.
+ */
+#ifndef CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_HASH_SIZE
+#define CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_HASH_SIZE              (0U)
+#endif
+
 /**
  * @brief   Registration lifetime in minutes for the address registration option
  *
@@ -169,6 +185,36 @@ extern "C" {
 #define CONFIG_GNRC_SIXLOWPAN_FRAG_VRB_TIMEOUT_US  (CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_TIMEOUT_US)
 #endif  /* CONFIG_GNRC_SIXLOWPAN_FRAG_VRB_TIMEOUT_US */
 
+/**
+ * @brief   Number of buckets in the hash index of the VRB
+ *
+ * @note    Only applicable with
+ *          [gnrc_sixlowpan_frag_vrb](@ref net_gnrc_sixlowpan_frag_vrb) module.
+ *
+ * When not 0, VRB entries are indexed by their incoming source and tag, so
+ * forwarding a fragment no longer checks every entry of the VRB. With 0, the
+ * VRB is searched linearly.
+ */
+#ifndef CONFIG_GNRC_SIXLOWPAN_FRAG_VRB_HASH_SIZE
+#define CONFIG_GNRC_SIXLOWPAN_FRAG_VRB_HASH_SIZE   (0U)
+#endif  /* CONFIG_GNRC_SIXLOWPAN_FRAG_VRB_HASH_SIZE */
+
+/**
+ * @brief   Number of flows in the IPHC compression cache
+ *
+ * Each entry keeps the compressed IPv6 header of one flow, i.e. one
+ * combination of IPv6 header fields (except the payload length), interface,
+ * and link-layer destination, so that repeated packets of that flow skip the
+ * context lookups and address compression.
+ *
+ * @note    Only applicable with
+ *          [gnrc_sixlowpan_iphc_cache](@ref net_gnrc_sixlowpan_iphc_cache)
+ *          module.
+ */
+#ifndef CONFIG_GNRC_SIXLOWPAN_IPHC_CACHE_SIZE
+#define CONFIG_GNRC_SIXLOWPAN_IPHC_CACHE_SIZE      (4U)
+#endif  /* CONFIG_GNRC_SIXLOWPAN_IPHC_CACHE_SIZE */
+
 /**
  * @name Selective fragment recovery configuration
  * @see  [RFC 8931, section 7.1]
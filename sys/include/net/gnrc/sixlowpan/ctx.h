@@ -118,14 +118,28 @@ gnrc_sixlowpan_ctx_t *gnrc_sixlowpan_ctx_update(uint8_t id, const ipv6_addr_t *p
 /**
  * @brief   Removes context.
  *
+ * @note    Does not lock the context buffer, so it may be called from
+ *          interrupt context.
+ *
  * @param[in] id    A context ID.
  */
-static inline void gnrc_sixlowpan_ctx_remove(uint8_t id)
-{
-    if (IS_USED(MODULE_GNRC_SIXLOWPAN_CTX)) {
-        gnrc_sixlowpan_ctx_lookup_id(id)->prefix_len = 0;
-    }
-}
+void gnrc_sixlowpan_ctx_remove(uint8_t id);
+
+/**
+ * @brief   Gets the generation of the context buffer.
+ *
+ * The generation changes whenever a context is added, updated, removed or
+ * loses its compression flag because its lifetime expired. Users that cache
+ * results derived from the contexts, like the IPHC flow cache, compare it
+ * to detect stale entries.
+ *
+ * @note    Lifetime expiry is only detected by the lookup functions, so
+ *          users need to look up the contexts their cached results depend
+ *          on before comparing the generation.
+ *
+ * @return  The current generation.
+ */
+uint32_t gnrc_sixlowpan_ctx_generation(void);
 
 /**
  * @brief   Check if a prefix matches a compression context
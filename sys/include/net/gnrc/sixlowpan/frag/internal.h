@@ -0,0 +1,63 @@
+/*
+ * Copyright (C) 2026 Mesotic SAS
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup net_gnrc_sixlowpan_frag
+ * @{
+ *
+ * @file
+ * @brief   6LoWPAN fragmentation internal functions
+ */
+#ifndef NET_GNRC_SIXLOWPAN_FRAG_INTERNAL_H
+#define NET_GNRC_SIXLOWPAN_FRAG_INTERNAL_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Hashes the source and the tag of a datagram to a bucket
+ *
+ * Used by the reassembly buffer and the virtual reassembly buffer to look up
+ * their entries. The destination is the address of the interface for nearly
+ * all datagrams, so it is not hashed.
+ *
+ * @param[in] src       Link-layer source address of the datagram
+ * @param[in] src_len   Length of @p src
+ * @param[in] tag       Tag of the datagram
+ * @param[in] size      Number of buckets, must not be 0
+ *
+ * @return  The bucket of the datagram, smaller than @p size
+ */
+static inline unsigned gnrc_sixlowpan_frag_hash(const uint8_t *src,
+                                                size_t src_len, unsigned tag,
+                                                unsigned size)
+{
+    uint32_t hash = tag;
+
+    for (unsigned i = 0; i < src_len; i++) {
+        hash = (hash ^ src[i]) * 0x9e3779b1;
+    }
+    /* finalizer of MurmurHash3, so all bits matter for the bucket */
+    hash ^= hash >> 16;
+    hash *= 0x85ebca6b;
+    hash ^= hash >> 13;
+    hash *= 0xc2b2ae35;
+    hash ^= hash >> 16;
+    return hash % size;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* NET_GNRC_SIXLOWPAN_FRAG_INTERNAL_H */
+/** @} */
@@ -21,7 +21,9 @@
 #define NET_GNRC_SIXLOWPAN_IPHC_H
 
 #include <stdbool.h>
+#include <stdint.h>
 
+#include "modules.h"
 #include "net/gnrc/pkt.h"
 #include "net/sixlowpan.h"
 
@@ -63,6 +65,39 @@ void gnrc_sixlowpan_iphc_recv(gnrc_pktsnip_t *pkt, void *ctx, unsigned page);
  */
 void gnrc_sixlowpan_iphc_send(gnrc_pktsnip_t *pkt, void *ctx, unsigned page);
 
+#if IS_USED(MODULE_GNRC_SIXLOWPAN_IPHC_CACHE) || defined(DOXYGEN)
+/**
+ * @brief   Statistics of the IPHC flow cache
+ *
+ * @note    Only available with module
+ *          [gnrc_sixlowpan_iphc_cache](@ref net_gnrc_sixlowpan_iphc_cache).
+ */
+typedef struct {
+    uint32_t hits;          /**< compressed headers copied from the cache */
+    uint32_t misses;        /**< compressed headers computed */
+    uint32_t stale;         /**< misses because contexts changed */
+    uint32_t evictions;     /**< entries replaced by another flow */
+} gnrc_sixlowpan_iphc_cache_stats_t;
+
+/**
+ * @brief   Gets the statistics of the IPHC flow cache
+ *
+ * @param[out] stats    The statistics.
+ * @param[in] reset     Reset the statistics after copying them.
+ */
+void gnrc_sixlowpan_iphc_cache_stats(gnrc_sixlowpan_iphc_cache_stats_t *stats,
+                                     bool reset);
+
+/**
+ * @brief   Removes all flows from the IPHC flow cache
+ *
+ * Changes to the compression contexts or to the link-layer address of an
+ * interface are detected by the cache itself, so this is not needed for
+ * correctness.
+ */
+void gnrc_sixlowpan_iphc_cache_flush(void);
+#endif
+
 #ifdef __cplusplus
 }
 #endif
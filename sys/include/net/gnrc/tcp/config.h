@@ -108,6 +108,16 @@ extern "C" {
 #define GNRC_TCP_RCV_BUF_SIZE (CONFIG_GNRC_TCP_DEFAULT_WINDOW)
 #endif
 
+/**
+ * @brief Number of out-of-order segments held per connection
+ *
+ * With module `gnrc_tcp_ooo`, segments that arrive ahead of a gap stay in
+ * the packet buffer until the gap is filled, instead of being dropped.
+ */
+#ifndef CONFIG_GNRC_TCP_OOO_QUEUE_SIZE
+#define CONFIG_GNRC_TCP_OOO_QUEUE_SIZE (4U)
+#endif
+
 /**
  * @brief Lower bound for RTO in milliseconds. Default is 1 sec (see RFC 6298)
  *
@@ -27,6 +27,7 @@
 #include "evtimer_mbox.h"
 #include "msg.h"
 #include "mbox.h"
+#include "modules.h"
 #include "net/gnrc/pkt.h"
 #include "config.h"
 
@@ -38,6 +39,15 @@
 extern "C" {
 #endif
 
+/**
+ * @brief Segment held in the out-of-order queue of a TCB.
+ */
+typedef struct {
+    gnrc_pktsnip_t *pkt;   /**< Received packet, held in the packet buffer */
+    uint32_t seq;          /**< Sequence number of the first payload byte */
+    uint16_t len;          /**< Payload length */
+} gnrc_tcp_ooo_seg_t;
+
 /**
  * @brief Transmission control block of GNRC TCP.
  */
@@ -74,6 +84,12 @@ typedef struct sock_tcp {
     mbox_t *mbox;            /**< TCB mbox for synchronization */
     uint8_t *rcv_buf_raw;    /**< Pointer to the receive buffer */
     ringbuffer_t rcv_buf;    /**< Receive buffer data structure */
+#if IS_USED(MODULE_GNRC_TCP_OOO) || defined(DOXYGEN)
+    gnrc_tcp_ooo_seg_t ooo_queue[CONFIG_GNRC_TCP_OOO_QUEUE_SIZE]; /**< Out-of-order segments,
+                                                                       sorted by sequence number */
+    uint8_t ooo_numof;       /**< Number of segments in ooo_queue */
+    uint32_t ooo_recent;     /**< Sequence number of the latest queued segment */
+#endif
     mutex_t fsm_lock;        /**< Mutex for FSM access synchronization */
     mutex_t function_lock;   /**< Mutex for function call synchronization */
     struct sock_tcp *next;   /**< Pointer next TCB */
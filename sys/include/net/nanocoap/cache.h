@@ -11,6 +11,12 @@
  * @ingroup     net_nanocoap
  * @brief       A cache implementation for nanocoap response messages
  *
+ * Cache keys are derived from the cacheable options (and the payload of
+ * FETCH requests) of a request using SHA-256. If the cache is not security
+ * relevant, i.e. no adversary can craft requests that collide with the cache
+ * key of another request, the cheaper 64-bit FNV-1a hash can be used instead
+ * by selecting the pseudo-module `nanocoap_cache_key_fnv`.
+ *
  * @{
  *
  * @file
@@ -48,6 +54,17 @@ extern "C" {
 #define CONFIG_NANOCOAP_CACHE_KEY_LENGTH       (8)
 #endif
 
+/**
+ * @brief The number of slots in the hash index over the cache entries.
+ *
+ * The index uses open addressing, so this value must be larger than
+ * @ref CONFIG_NANOCOAP_CACHE_ENTRIES. Choosing a power of two avoids a
+ * division when mapping a cache key to its slot.
+ */
+#ifndef CONFIG_NANOCOAP_CACHE_INDEX_SIZE
+#define CONFIG_NANOCOAP_CACHE_INDEX_SIZE       (2 * CONFIG_NANOCOAP_CACHE_ENTRIES)
+#endif
+
 /**
  * @brief Size of the buffer to store responses in the cache.
  */
@@ -216,7 +233,7 @@ int nanocoap_cache_del(const nanocoap_cache_entry_t *ce);
  * @brief   Generates a cache key based on the request @p req.
  *
  * @param[in] req           The request to generate the cache key from
- * @param[out] cache_key    The generated cache key
+ * @param[out] cache_key    The generated cache key of SHA256_DIGEST_LENGTH bytes
  */
 void nanocoap_cache_key_generate(const coap_pkt_t *req, uint8_t *cache_key);
 
@@ -190,6 +190,27 @@ extern "C" {
 #define CONFIG_NANOCOAP_SOCK_BLOCK_TOKEN        (0)
 #endif
 
+/**
+ * @brief   Number of Block2 requests kept in flight by the block-wise GET
+ *          functions
+ *
+ * With the default of 1, @ref nanocoap_sock_get_blockwise and
+ * @ref nanocoap_sock_get_slice request the next block only after the previous
+ * one was received. Larger values request up to this many blocks ahead, which
+ * makes downloads over links with a long round trip time bound by bandwidth
+ * rather than by latency. Blocks received out of order are buffered and
+ * handed to the callback in order, so larger block sizes are reduced to
+ * 2^@ref CONFIG_NANOCOAP_BLOCK_SIZE_EXP_MAX bytes.
+ *
+ * The window is kept on the stack of the calling thread. It takes about
+ * (2^@ref CONFIG_NANOCOAP_BLOCK_SIZE_EXP_MAX + 24) bytes per slot, e.g.
+ * 352 bytes for a window of 4 with the default maximum block size of
+ * 64 bytes. The window is limited to 8 requests.
+ */
+#ifndef CONFIG_NANOCOAP_SOCK_BLOCK_WINDOW
+#define CONFIG_NANOCOAP_SOCK_BLOCK_WINDOW       (1)
+#endif
+
 /**
  * @brief   NanoCoAP socket types
  */
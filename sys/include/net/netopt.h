@@ -871,6 +871,18 @@ typedef enum {
      */
     NETOPT_GTS_TX,
 
+    /**
+     * @brief   (@ref netopt_enable_t) Check if more received frames are
+     *          waiting to be read
+     *
+     * Read-only. Devices that buffer several frames return
+     * @ref NETOPT_ENABLE when another frame can be fetched with
+     * @ref netdev_driver_t::recv right away, without waiting for a further
+     * @ref NETDEV_EVENT_RX_COMPLETE. Used by @ref net_gnrc_netif_rx_batch to
+     * drain the device in one go.
+     */
+    NETOPT_RX_PENDING,
+
     /**
      * @brief   maximum number of options defined here.
      *
@@ -16,6 +16,31 @@
  *
  * @note        If auto_init is disabled `init_schedstatistics()` needs to be
  *              called as well as xtimer_init().
+ *
+ * ## Cycle counter
+ *
+ * By default, the time of each context switch is read from `ZTIMER_USEC`.
+ * With the pseudomodule `schedstatistics_cycles`, the free running cycle
+ * counter of the CPU is read instead, see feature `cpu_cycle_counter`. This
+ * is cheaper and has a resolution of a core clock cycle, or a nanosecond on
+ * native. The counter does not run while the CPU sleeps, so the statistics
+ * show the share of the CPU time actually used by each thread and the idle
+ * thread gets little of it. All times of @ref schedstat_t are then given in
+ * cycles, @ref SCHEDSTATISTICS_FREQ converts them.
+ *
+ * ## Histograms
+ *
+ * With the pseudomodule `schedstatistics_hist`, two histograms are kept for
+ * each thread:
+ *
+ * - run length: how long the thread ran each time it got the CPU
+ * - wake latency: how long it took from the thread becoming ready to run,
+ *   e.g. by receiving a message or getting a mutex, until it got the CPU
+ *
+ * Both use @ref CONFIG_SCHEDSTATISTICS_HIST_BINS bins of power of two widths,
+ * see @ref schedstatistics_hist_bin. `ps` prints them and the shell command
+ * `schedstat` of module `shell_cmd_schedstatistics` prints all statistics as
+ * one JSON object per thread.
  * @{
  *
  * @file
@@ -29,12 +54,57 @@
 #ifndef SCHEDSTATISTICS_H
 #define SCHEDSTATISTICS_H
 
+#include <stdbool.h>
 #include <stdint.h>
 
+#include "cpu.h"
+#include "modules.h"
+#include "sched.h"
+#if IS_USED(MODULE_SCHEDSTATISTICS_CYCLES)
+#include "periph_conf.h"
+#endif
+
 #ifdef __cplusplus
  extern "C" {
 #endif
 
+/**
+ * @defgroup schedstatistics_conf Schedstatistics compile time configuration
+ * @ingroup config
+ * @{
+ */
+/**
+ * @brief   Number of bins of the histograms of module `schedstatistics_hist`
+ */
+#ifndef CONFIG_SCHEDSTATISTICS_HIST_BINS
+#define CONFIG_SCHEDSTATISTICS_HIST_BINS        16
+#endif
+
+/**
+ * @brief   Width of the first histogram bin, as power of two ticks
+ *
+ * Bin 0 counts durations shorter than `1 << CONFIG_SCHEDSTATISTICS_HIST_SHIFT`
+ * ticks, every following bin twice as long durations as the previous one.
+ * Defaults to 1 µs, or 64 cycles with module `schedstatistics_cycles`.
+ */
+#ifndef CONFIG_SCHEDSTATISTICS_HIST_SHIFT
+#if IS_USED(MODULE_SCHEDSTATISTICS_CYCLES)
+#define CONFIG_SCHEDSTATISTICS_HIST_SHIFT       6
+#else
+#define CONFIG_SCHEDSTATISTICS_HIST_SHIFT       0
+#endif
+#endif
+/** @} */
+
+/**
+ * @brief   Frequency of the times of @ref schedstat_t in Hz
+ */
+#if IS_USED(MODULE_SCHEDSTATISTICS_CYCLES) || defined(DOXYGEN)
+#define SCHEDSTATISTICS_FREQ    (CPU_CYCLES_FREQ)
+#else
+#define SCHEDSTATISTICS_FREQ    (1000000LU)
+#endif
+
 /**
  *  Scheduler statistics
  */
@@ -42,7 +112,22 @@ typedef struct {
     uint32_t laststart;      /**< Time stamp of the last time this thread was
                                   scheduled to run */
     unsigned int schedules;  /**< How often the thread was scheduled to run */
+#if IS_USED(MODULE_SCHEDSTATISTICS_CYCLES) || defined(DOXYGEN)
+    uint64_t runtime_cycles; /**< The total runtime of this thread in cycles,
+                                  with module `schedstatistics_cycles` */
+#endif
+#if !IS_USED(MODULE_SCHEDSTATISTICS_CYCLES) || defined(DOXYGEN)
     uint64_t runtime_us;     /**< The total runtime of this thread in microseconds */
+#endif
+#if IS_USED(MODULE_SCHEDSTATISTICS_HIST) || defined(DOXYGEN)
+    uint32_t lastwake;       /**< Time stamp of the thread becoming ready to
+                                  run, if @p woken */
+    bool woken;              /**< Thread is waiting to run since @p lastwake */
+    /** Number of times the thread ran for the durations of each bin */
+    uint32_t run_hist[CONFIG_SCHEDSTATISTICS_HIST_BINS];
+    /** Number of wake latencies falling in each bin */
+    uint32_t latency_hist[CONFIG_SCHEDSTATISTICS_HIST_BINS];
+#endif
 } schedstat_t;
 
 /**
@@ -56,6 +141,42 @@ extern schedstat_t sched_pidlist[KERNEL_PID_LAST + 1];
  */
 void init_schedstatistics(void);
 
+/**
+ *  @brief  The sched statistics callback
+ *
+ *  Registered by @ref init_schedstatistics. Exposed for modules that need to
+ *  register their own callback and chain this one.
+ *
+ *  @param[in]  active_thread   thread leaving the CPU
+ *  @param[in]  next_thread     thread getting the CPU
+ */
+void sched_statistics_cb(kernel_pid_t active_thread, kernel_pid_t next_thread);
+
+/**
+ *  @brief  Get the total runtime of a thread
+ *
+ *  @param[in]  pid     thread, or KERNEL_PID_UNDEF for the time spent idle
+ *                      without idle thread
+ *
+ *  @return runtime in microseconds
+ */
+uint64_t schedstatistics_runtime_us(kernel_pid_t pid);
+
+/**
+ *  @brief  Get the lower bound of a histogram bin
+ *
+ *  Bin @p bin counts durations from the returned value up to the one of the
+ *  next bin, the last bin counts all longer durations.
+ *
+ *  @param[in]  bin     histogram bin
+ *
+ *  @return duration in ticks of @ref SCHEDSTATISTICS_FREQ
+ */
+static inline uint32_t schedstatistics_hist_bin(unsigned bin)
+{
+    return bin ? (1LU << (CONFIG_SCHEDSTATISTICS_HIST_SHIFT + bin - 1)) : 0;
+}
+
 #ifdef __cplusplus
 }
 #endif
@@ -129,6 +129,74 @@ int suit_handle_url(const char *url);
  */
 int suit_handle_manifest_buf(const uint8_t *buffer, size_t size);
 
+/**
+ * @name    Download pipeline
+ *
+ * With the `suit_transport_worker_pipeline` module, fetched payload blocks are
+ * copied into one of two buffers and written to storage by a separate thread,
+ * so the next block is fetched while the previous one is erased or programmed.
+ * @{
+ */
+
+/**
+ * @brief   Throughput statistics of the last download through the pipeline
+ *
+ * The transport and the writer thread update their fields without locking
+ * while a download is running, so the statistics are only consistent once
+ * @ref suit_worker_pipeline_finish returned.
+ */
+typedef struct {
+    uint32_t bytes;             /**< bytes passed to the storage backend */
+    uint32_t elapsed_us;        /**< duration of the download */
+    uint32_t fetch_stall_us;    /**< time the transport waited for a free buffer */
+    uint32_t write_stall_us;    /**< time the writer waited for a full buffer */
+    uint32_t write_us;          /**< time spent in the storage backend */
+} suit_worker_stats_t;
+
+/**
+ * @brief   Start passing blocks on to @p cb through the pipeline
+ *
+ * @param[in] cb        callback writing a block to storage, called from the
+ *                      writer thread
+ * @param[in] arg       argument for @p cb
+ *
+ * @return  0 on success
+ * @return  -ENOMEM if the writer thread could not be created
+ */
+int suit_worker_pipeline_start(coap_blockwise_cb_t cb, void *arg);
+
+/**
+ * @brief   Block-wise callback that queues a block for the writer thread
+ *
+ * Blocks only while both buffers are still waiting to be written.
+ *
+ * @return  0 on success
+ * @return  <0 if the storage callback of an earlier block failed
+ */
+int suit_worker_pipeline_cb(void *arg, size_t offset, uint8_t *buf,
+                            size_t len, int more);
+
+/**
+ * @brief   Wait until all queued blocks are written and log the statistics
+ *
+ * @param[in] res       result of the transport
+ *
+ * @return  @p res if it is an error, otherwise the first error of the
+ *          storage callback or 0
+ */
+int suit_worker_pipeline_finish(int res);
+
+/**
+ * @brief   Get the statistics of the last download through the pipeline
+ *
+ * @pre     No download is running, i.e. @ref suit_worker_pipeline_finish
+ *          returned after the last call to @ref suit_worker_pipeline_start
+ *
+ * @param[out] stats    statistics
+ */
+void suit_worker_pipeline_stats(suit_worker_stats_t *stats);
+/** @} */
+
 #ifdef __cplusplus
 }
 #endif
@@ -41,6 +41,47 @@
  * trace_dump();
  * ~~~~~~~~~~~~~~~~~~~~~~~~
  *
+ * ## Kernel events
+ *
+ * Besides the values given to `trace()`, the following pseudomodules record
+ * typed events of the kernel into the same buffer:
+ *
+ * | module         | events                                               |
+ * |----------------|------------------------------------------------------|
+ * | `trace_sched`  | @ref TRACE_SCHED, a thread being scheduled           |
+ * | `trace_msg`    | @ref TRACE_MSG_SEND, @ref TRACE_MSG_RECV             |
+ * | `trace_mutex`  | @ref TRACE_MUTEX_BLOCK, @ref TRACE_MUTEX_UNBLOCK     |
+ * | `trace_isr`    | @ref TRACE_ISR_ENTER, @ref TRACE_ISR_EXIT            |
+ * | `trace_ztimer` | @ref TRACE_ZTIMER_FIRE, a ztimer callback being run  |
+ *
+ * Each event takes 12 bytes. `trace_sched` uses @ref sched_register_cb and
+ * keeps calling the callback of `schedstatistics`, if used. The reply of
+ * @ref msg_send_receive is recorded as @ref TRACE_MSG_RECV from the thread the
+ * message was sent to. Recording can be limited to some event types at run
+ * time using @ref trace_set_mask.
+ *
+ * @warning ISR events are only recorded by CPUs calling @ref trace_isr_enter
+ *          and @ref trace_isr_exit, which currently is native only. Other
+ *          CPUs, e.g. Cortex-M, enter their ISRs straight from the vector
+ *          table and record no @ref TRACE_ISR_ENTER or @ref TRACE_ISR_EXIT
+ *          with `trace_isr`.
+ *
+ * ## Export
+ *
+ * `trace_export_json()` writes the buffer as JSON in the Chrome trace event
+ * format, which e.g. https://ui.perfetto.dev and `chrome://tracing` open.
+ * Threads show up as tracks with their run times as slices, ISRs on an own
+ * track, all other events as instants.
+ *
+ * `trace_export_ctf()` writes a Common Trace Format (CTF 1.8) trace, made of
+ * a metadata text and a binary stream, which e.g. `babeltrace2` and Trace
+ * Compass read. Written to the files `metadata` and `stream` of a directory,
+ * e.g. using `trace_export_ctf_vfs()`, they form a complete CTF trace.
+ *
+ * Both take a write function, so the output can go to stdio using
+ * @ref trace_write_stdio, to a file using the `_vfs()` variants, or anywhere
+ * else. Recording is paused while exporting.
+ *
  * @{
  *
  * @brief       Execution tracing module API
@@ -53,12 +94,60 @@
 #ifndef TRACE_H
 #define TRACE_H
 
+#include <stdbool.h>
+#include <stddef.h>
 #include <stdint.h>
 
+#include "modules.h"
+#include "thread.h"
+
 #ifdef __cplusplus
 extern "C" {
 #endif
 
+/**
+ * @brief   Types of trace events
+ *
+ * The meaning of @ref trace_event_t::pid and @ref trace_event_t::arg depends
+ * on the type.
+ */
+typedef enum {
+    TRACE_USER,             /**< `trace()` call, arg: user value */
+    TRACE_SCHED,            /**< pid: thread scheduled, arg: unused */
+    TRACE_MSG_SEND,         /**< pid: receiver, arg: message type */
+    TRACE_MSG_RECV,         /**< pid: sender, arg: message type */
+    TRACE_MUTEX_BLOCK,      /**< pid: thread blocking, arg: mutex address */
+    TRACE_MUTEX_UNBLOCK,    /**< pid: thread woken up, arg: mutex address */
+    TRACE_ISR_ENTER,        /**< pid: interrupted thread, arg: IRQ number */
+    TRACE_ISR_EXIT,         /**< pid: interrupted thread, arg: IRQ number */
+    TRACE_ZTIMER_FIRE,      /**< pid: unused, arg: callback address */
+    TRACE_TYPE_NUMOF,       /**< number of event types */
+} trace_type_t;
+
+/**
+ * @brief   Mask enabling all event types for @ref trace_set_mask
+ */
+#define TRACE_MASK_ALL      ((1LU << TRACE_TYPE_NUMOF) - 1)
+
+/**
+ * @brief   Trace buffer entry
+ */
+typedef struct {
+    uint32_t time;          /**< time of the event in µs */
+    uint32_t arg;           /**< argument, depending on @p type */
+    kernel_pid_t pid;       /**< thread, depending on @p type */
+    uint8_t type;           /**< type of the event, see @ref trace_type_t */
+} trace_event_t;
+
+/**
+ * @brief   Function writing exported data
+ *
+ * @param[in]   ctx     context given to the export function
+ * @param[in]   data    data to write
+ * @param[in]   len     number of bytes to write
+ */
+typedef void (*trace_write_t)(void *ctx, const void *data, size_t len);
+
 /**
  * @brief   Add entry to trace buffer
  *
@@ -73,12 +162,34 @@ extern "C" {
  */
 void trace(uint32_t val);
 
+/**
+ * @brief   Add a typed event to the trace buffer
+ *
+ * Safe to call from anywhere, including ISRs. Does nothing if @p type is
+ * disabled by @ref trace_set_mask.
+ *
+ * @param[in]   type    type of the event
+ * @param[in]   pid     thread, depending on @p type
+ * @param[in]   arg     argument, depending on @p type
+ */
+void trace_event(trace_type_t type, kernel_pid_t pid, uint32_t arg);
+
+/**
+ * @brief   Select the event types to record
+ *
+ * @param[in]   mask    bit `1 << type` set for each type to record,
+ *                      @ref TRACE_MASK_ALL by default
+ *
+ * @return  the previous mask
+ */
+uint32_t trace_set_mask(uint32_t mask);
+
 /**
  * @brief   Print the current trace buffer
  *
  * Will print the number of the trace log entry, the timestamp (first entry) or
  * relative time since last entry, and the value supplied to the `trace()` call
- * of each entry.
+ * of each entry. Other events are printed with their type and thread.
  *
  * Example output (after adding two traces, 3us apart, with values 0 and 1):
  *
@@ -92,6 +203,198 @@ void trace_dump(void);
  */
 void trace_reset(void);
 
+/**
+ * @brief   Get the number of events in the trace buffer
+ *
+ * @return  number of events, at most CONFIG_TRACE_BUFSIZE
+ */
+size_t trace_numof(void);
+
+/**
+ * @brief   Get the number of events overwritten since the last reset
+ *
+ * @return  number of events lost
+ */
+uint32_t trace_lost(void);
+
+/**
+ * @brief   Get an event from the trace buffer
+ *
+ * @param[in]   idx     index of the event, 0 is the oldest one
+ * @param[out]  event   event
+ *
+ * @return  true if @p idx is smaller than @ref trace_numof()
+ */
+bool trace_get(size_t idx, trace_event_t *event);
+
+/**
+ * @brief   Get the name of an event type
+ *
+ * @param[in]   type    event type
+ *
+ * @return  name, as used by the exports
+ */
+const char *trace_type_name(trace_type_t type);
+
+/**
+ * @brief   Write the trace buffer as JSON in the Chrome trace event format
+ *
+ * @param[in]   write   function to write the output with
+ * @param[in]   ctx     context for @p write
+ */
+void trace_export_json(trace_write_t write, void *ctx);
+
+/**
+ * @brief   Write the trace buffer in Common Trace Format
+ *
+ * @param[in]   write_metadata  function to write the TSDL metadata with
+ * @param[in]   metadata_ctx    context for @p write_metadata
+ * @param[in]   write_stream    function to write the binary stream with
+ * @param[in]   stream_ctx      context for @p write_stream
+ */
+void trace_export_ctf(trace_write_t write_metadata, void *metadata_ctx,
+                      trace_write_t write_stream, void *stream_ctx);
+
+/**
+ * @brief   Write function writing to stdio using @ref stdio_write
+ *
+ * Binary safe, so it can also write a CTF stream.
+ *
+ * @param[in]   ctx     unused
+ * @param[in]   data    data to print
+ * @param[in]   len     number of bytes to print
+ */
+void trace_write_stdio(void *ctx, const void *data, size_t len);
+
+#if IS_USED(MODULE_VFS) || DOXYGEN
+/**
+ * @brief   Write the trace buffer as JSON to a file
+ *
+ * @param[in]   path    file to create or overwrite
+ *
+ * @return  0 on success
+ * @return  negative errno on failure
+ */
+int trace_export_json_vfs(const char *path);
+
+/**
+ * @brief   Write the trace buffer as CTF trace to a directory
+ *
+ * Writes the files `metadata` and `stream`.
+ *
+ * @param[in]   dir     existing directory to write the trace to
+ *
+ * @return  0 on success
+ * @return  negative errno on failure
+ */
+int trace_export_ctf_vfs(const char *dir);
+#endif
+
+/**
+ * @brief   Record a message being sent
+ *
+ * Called by the kernel, only records with module `trace_msg`.
+ *
+ * @param[in]   target  receiver of the message
+ * @param[in]   type    message type
+ */
+static inline void trace_msg_send(kernel_pid_t target, uint16_t type)
+{
+    if (IS_USED(MODULE_TRACE_MSG)) {
+        trace_event(TRACE_MSG_SEND, target, type);
+    }
+}
+
+/**
+ * @brief   Record a message being received
+ *
+ * Called by the kernel, only records with module `trace_msg`.
+ *
+ * @param[in]   sender  sender of the message
+ * @param[in]   type    message type
+ */
+static inline void trace_msg_recv(kernel_pid_t sender, uint16_t type)
+{
+    if (IS_USED(MODULE_TRACE_MSG)) {
+        trace_event(TRACE_MSG_RECV, sender, type);
+    }
+}
+
+/**
+ * @brief   Record the running thread blocking on a mutex
+ *
+ * Called by the kernel, only records with module `trace_mutex`.
+ *
+ * @param[in]   mutex   mutex blocked on
+ */
+static inline void trace_mutex_block(const void *mutex)
+{
+    if (IS_USED(MODULE_TRACE_MUTEX)) {
+        trace_event(TRACE_MUTEX_BLOCK, thread_getpid(),
+                    (uint32_t)(uintptr_t)mutex);
+    }
+}
+
+/**
+ * @brief   Record a thread blocked on a mutex being woken up
+ *
+ * Called by the kernel, only records with module `trace_mutex`.
+ *
+ * @param[in]   mutex   mutex unlocked
+ * @param[in]   pid     thread woken up
+ */
+static inline void trace_mutex_unblock(const void *mutex, kernel_pid_t pid)
+{
+    if (IS_USED(MODULE_TRACE_MUTEX)) {
+        trace_event(TRACE_MUTEX_UNBLOCK, pid, (uint32_t)(uintptr_t)mutex);
+    }
+}
+
+/**
+ * @brief   Record a ztimer callback being run
+ *
+ * Called by ztimer, only records with module `trace_ztimer`.
+ *
+ * @param[in]   callback    callback of the timer
+ */
+static inline void trace_ztimer_fire(void (*callback)(void *))
+{
+    if (IS_USED(MODULE_TRACE_ZTIMER)) {
+        trace_event(TRACE_ZTIMER_FIRE, KERNEL_PID_UNDEF,
+                    (uint32_t)(uintptr_t)callback);
+    }
+}
+
+/**
+ * @brief   Record an interrupt being entered
+ *
+ * Called by the CPU, only records with module `trace_isr`. Currently only
+ * called on native.
+ *
+ * @param[in]   irq     IRQ number
+ */
+static inline void trace_isr_enter(unsigned irq)
+{
+    if (IS_USED(MODULE_TRACE_ISR)) {
+        trace_event(TRACE_ISR_ENTER, thread_getpid(), irq);
+    }
+}
+
+/**
+ * @brief   Record an interrupt being left
+ *
+ * Called by the CPU, only records with module `trace_isr`. Currently only
+ * called on native.
+ *
+ * @param[in]   irq     IRQ number
+ */
+static inline void trace_isr_exit(unsigned irq)
+{
+    if (IS_USED(MODULE_TRACE_ISR)) {
+        trace_event(TRACE_ISR_EXIT, thread_getpid(), irq);
+    }
+}
+
 #ifdef __cplusplus
 }
 #endif
@@ -192,6 +192,59 @@ int tsrb_add_one(tsrb_t *rb, uint8_t c);
  */
 int tsrb_add(tsrb_t *rb, const uint8_t *src, size_t n);
 
+/**
+ * @brief       Get the largest contiguous region of bytes available for
+ *              reading, without removing them
+ *
+ * This allows e.g. a DMA transfer out of the ringbuffer without copying the
+ * data first. Once the bytes have been processed, they are removed by calling
+ * @ref tsrb_consume. If the available bytes wrap around the end of the buffer,
+ * only the bytes up to the end are returned.
+ *
+ * @note        The region stays valid until it is consumed, as long as there
+ *              is only a single reader.
+ *
+ * @param[in]   rb      Ringbuffer to operate on
+ * @param[out]  region  start of the region
+ * @return      nr of bytes in @p region, 0 if the ringbuffer is empty
+ */
+size_t tsrb_peek_region(tsrb_t *rb, uint8_t **region);
+
+/**
+ * @brief       Remove bytes obtained by @ref tsrb_peek_region from ringbuffer
+ * @param[in]   rb  Ringbuffer to operate on
+ * @param[in]   n   max number of bytes to remove
+ * @return      nr of bytes removed
+ */
+int tsrb_consume(tsrb_t *rb, size_t n);
+
+/**
+ * @brief       Get the largest contiguous region of free space for writing
+ *
+ * This allows e.g. a DMA transfer into the ringbuffer without an intermediate
+ * buffer. Bytes written to the region are added by calling @ref tsrb_commit.
+ * If the free space wraps around the end of the buffer, only the space up to
+ * the end is returned.
+ *
+ * @note        The region stays valid until it is committed, as long as there
+ *              is only a single writer.
+ *
+ * @param[in]   rb      Ringbuffer to operate on
+ * @param[out]  region  start of the region
+ * @return      nr of bytes that can be written to @p region, 0 if the
+ *              ringbuffer is full
+ */
+size_t tsrb_reserve_region(tsrb_t *rb, uint8_t **region);
+
+/**
+ * @brief       Add bytes written into a region obtained by
+ *              @ref tsrb_reserve_region to ringbuffer
+ * @param[in]   rb  Ringbuffer to operate on
+ * @param[in]   n   max number of bytes to add
+ * @return      nr of bytes added
+ */
+int tsrb_commit(tsrb_t *rb, size_t n);
+
 #ifdef __cplusplus
 }
 #endif
@@ -152,10 +152,36 @@
  * made a constant operation, at the price of another pointer per timer object
  * (for "previous" element).
  *
- * If deemed necessary, the linked list can be exchanged our augmented with
- * another data structure providing better algorithmic guarantees. It remains
- * to be shown whether the increased complexity would lead to better
- * performance for any reasonable amount of active timers.
+ * For use cases with hundreds of active timers on a single clock, the module
+ * `ztimer_wheel` replaces the list with a hierarchical timing wheel, providing
+ * constant time insertion and removal at the cost of more memory per clock.
+ * See @ref sys_ztimer_wheel for details.
+ *
+ *
+ * ## Wakeup coalescing
+ *
+ * Timers set with @ref ztimer_set fire at their exact target. Unrelated
+ * periodic timers thus wake the CPU at scattered instants, each with its own
+ * interrupt. With module `ztimer_slack`, @ref ztimer_set_slack sets a timer
+ * that may fire anywhere within a window of `slack` ticks after its target,
+ * and the clock tries to serve it with an interrupt it needs anyway:
+ *
+ * - if a timer is already set to a target within the window, the new timer is
+ *   given the same target,
+ * - else, if the window of a timer set with slack before overlaps with the
+ *   new window, that timer is moved to the end of the new window, and the new
+ *   timer joins it there,
+ * - else, the timer is set to the end of its window, leaving the most room
+ *   for timers set later.
+ *
+ * Timers set with @ref ztimer_set never move, but timers set with slack
+ * before are moved to their target if it is within their window. Timers that
+ * share a target fire in a single call of the clock's interrupt handler.
+ * With module `ztimer_wheel`, only the next target the clock is armed for is
+ * considered, and timers are not moved.
+ *
+ * Each clock counts the coalesced timers and the interrupts that fired timers
+ * in @ref ztimer_clock::slack_stats.
  *
  *
  * ## Clock extension
@@ -268,6 +294,9 @@
 #include "msg.h"
 #include "mutex.h"
 #include "rmutex.h"
+#if MODULE_ZTIMER_WHEEL || DOXYGEN
+#include "ztimer/wheel.h"
+#endif
 
 #ifdef __cplusplus
 extern "C" {
@@ -298,7 +327,17 @@ typedef void (*ztimer_callback_t)(void *arg);
  */
 struct ztimer_base {
     ztimer_base_t *next;        /**< next timer in list */
-    uint32_t offset;            /**< offset from last timer in list */
+    uint32_t offset;            /**< offset from last timer in list, absolute
+                                     target with module `ztimer_wheel` */
+#if MODULE_ZTIMER_WHEEL || DOXYGEN
+    ztimer_base_t *prev;        /**< previous timer in list, only with module
+                                     `ztimer_wheel` */
+#endif
+#if MODULE_ZTIMER_SLACK || DOXYGEN
+    uint32_t slack;             /**< ticks the timer may still be moved
+                                     before its target, only with module
+                                     `ztimer_slack` */
+#endif
 };
 
 /**
@@ -363,11 +402,24 @@ typedef struct {
 #endif
 } ztimer_ops_t;
 
+/**
+ * @brief   Wakeup coalescing statistics of a clock
+ */
+typedef struct {
+    uint32_t coalesced;     /**< timers given the target of another timer */
+    uint32_t fired;         /**< timer callbacks run */
+    uint32_t wakeups;       /**< interrupts that ran at least one callback */
+} ztimer_slack_stats_t;
+
 /**
  * @brief   ztimer device structure
  */
 struct ztimer_clock {
     ztimer_base_t list;             /**< list of active timers              */
+#if MODULE_ZTIMER_WHEEL || DOXYGEN
+    ztimer_wheel_t wheel;           /**< timing wheel of active timers, only
+                                         with module `ztimer_wheel`         */
+#endif
     const ztimer_ops_t *ops;        /**< pointer to methods structure       */
     ztimer_base_t *last;            /**< last timer in queue, for _is_set() */
     uint16_t adjust_set;            /**< will be subtracted on every set()  */
@@ -389,6 +441,14 @@ struct ztimer_clock {
     uint8_t block_pm_mode;          /**< min. pm mode to block for the clock to run
                                          don't use in combination with ztimer_ondemand! */
 #endif
+#if MODULE_ZTIMER_SLACK || DOXYGEN
+    /**
+     * @brief   Wakeup coalescing statistics, only with module `ztimer_slack`
+     *
+     * `fired - wakeups` interrupts were saved by timers sharing a target.
+     */
+    ztimer_slack_stats_t slack_stats;
+#endif
 };
 
 /**
@@ -459,6 +519,37 @@ static inline bool ztimer_release(ztimer_clock_t *clock)
  */
 uint32_t ztimer_set(ztimer_clock_t *clock, ztimer_t *timer, uint32_t val);
 
+/**
+ * @brief   Set a timer on a clock, allowing it to fire late
+ *
+ * @p timer fires between @p val and `val + slack` ticks from now, at a target
+ * shared with other timers if possible, so that fewer interrupts are needed.
+ * Without module `ztimer_slack`, this is @ref ztimer_set.
+ *
+ * @note The memory pointed to by @p timer is not copied and must
+ *       remain in scope until the callback is fired or the timer
+ *       is removed via @ref ztimer_remove
+ *
+ * @param[in]   clock       ztimer clock to operate on
+ * @param[in]   timer       timer entry to set
+ * @param[in]   val         earliest timer target (relative ticks from now)
+ * @param[in]   slack       ticks @p timer may fire after @p val
+ *
+ * @return The value of @ref ztimer_now() that @p timer was set against
+ */
+#if MODULE_ZTIMER_SLACK || DOXYGEN
+uint32_t ztimer_set_slack(ztimer_clock_t *clock, ztimer_t *timer, uint32_t val,
+                          uint32_t slack);
+#else
+static inline uint32_t ztimer_set_slack(ztimer_clock_t *clock,
+                                        ztimer_t *timer, uint32_t val,
+                                        uint32_t slack)
+{
+    (void)slack;
+    return ztimer_set(clock, timer, val);
+}
+#endif
+
 /**
  * @brief   Check if a timer is currently active
  *
@@ -0,0 +1,169 @@
+/*
+ * Copyright (C) 2026 Mesotic SAS
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser General
+ * Public License v2.1. See the file LICENSE in the top level directory for more
+ * details.
+ */
+
+/**
+ * @defgroup    sys_ztimer_wheel  ztimer hierarchical timing wheel
+ * @ingroup     sys_ztimer
+ * @brief       Constant time timer storage for ztimer clocks
+ *
+ * By default, every ztimer clock keeps its timers in a sorted list of
+ * relative offsets. Setting or removing a timer thus walks that list with
+ * interrupts disabled, which becomes noticeable once hundreds of timers are
+ * active on a single clock.
+ *
+ * With module `ztimer_wheel`, all clocks store their timers in a hierarchical
+ * timing wheel instead:
+ *
+ * - Each timer is sorted into one of @ref ZTIMER_WHEEL_SLOTS slots of one of
+ *   @ref ZTIMER_WHEEL_LEVELS levels, depending on its absolute target and the
+ *   time the wheel was last advanced to. Level 0 slots cover exactly one tick,
+ *   level @c n slots cover `ZTIMER_WHEEL_SLOTS ^ n` ticks.
+ * - Timers are doubly linked, so setting and removing a timer takes constant
+ *   time.
+ * - When time advances, slots of higher levels are moved ("cascaded") to
+ *   lower levels. The underlying timer is armed either for the exact target
+ *   of the earliest level 0 slot or for the begin of the earliest higher level
+ *   slot. This bounds the time spent with interrupts disabled, at the cost of
+ *   up to one additional interrupt per level for long running timers.
+ *
+ * The API of ztimer is not changed. Each @ref ztimer_t grows by one pointer,
+ * each clock by `ZTIMER_WHEEL_LEVELS * (ZTIMER_WHEEL_SLOTS + 1) + 3` words.
+ *
+ * The functions in this header are used internally by the ztimer core.
+ *
+ * @{
+ *
+ * @file
+ * @brief       ztimer timing wheel internal API
+ */
+
+#ifndef ZTIMER_WHEEL_H
+#define ZTIMER_WHEEL_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Number of bits of a target consumed per wheel level
+ *
+ * Valid values are 1 to 4, the bitmap of non-empty slots of each level has
+ * to fit into an `unsigned int`.
+ */
+#ifndef CONFIG_ZTIMER_WHEEL_SLOT_BITS
+#define CONFIG_ZTIMER_WHEEL_SLOT_BITS   (4U)
+#endif
+
+/**
+ * @brief   Number of slots per wheel level
+ */
+#define ZTIMER_WHEEL_SLOTS      (1U << CONFIG_ZTIMER_WHEEL_SLOT_BITS)
+
+/**
+ * @brief   Number of wheel levels needed to cover 32 bit targets
+ */
+#define ZTIMER_WHEEL_LEVELS     ((32U + CONFIG_ZTIMER_WHEEL_SLOT_BITS - 1) / \
+                                 CONFIG_ZTIMER_WHEEL_SLOT_BITS)
+
+/**
+ * @brief   Index of the list of timers whose target lies behind the next
+ *          wrap around of the clock
+ */
+#define ZTIMER_WHEEL_OVERFLOW   (ZTIMER_WHEEL_LEVELS * ZTIMER_WHEEL_SLOTS)
+
+/**
+ * @brief   Index of the list of expired timers, sorted by their target
+ */
+#define ZTIMER_WHEEL_EXPIRED    (ZTIMER_WHEEL_OVERFLOW + 1)
+
+/**
+ * @brief   Timing wheel state of a ztimer clock
+ */
+typedef struct {
+    /**
+     * @brief   Heads of all timer lists
+     *
+     * The slot lists are stored level by level, followed by the overflow and
+     * the expired list. The `prev` pointer of the first timer in a list
+     * points to the list head inside this array.
+     */
+    struct ztimer_base *lists[ZTIMER_WHEEL_EXPIRED + 1];
+    struct ztimer_base *expired_tail;       /**< last timer in expired list */
+    unsigned pending[ZTIMER_WHEEL_LEVELS];  /**< non-empty slots per level  */
+    uint32_t base;                          /**< time the wheel was last
+                                                 advanced to                */
+} ztimer_wheel_t;
+
+/**
+ * @brief   Add a timer to the wheel
+ *
+ * @param[in,out]   wheel   wheel to operate on
+ * @param[in,out]   entry   timer to add, must not be set
+ * @param[in]       val     target relative to the current wheel base
+ */
+void ztimer_wheel_add(ztimer_wheel_t *wheel, struct ztimer_base *entry,
+                      uint32_t val);
+
+/**
+ * @brief   Remove a timer from the wheel
+ *
+ * @param[in,out]   wheel   wheel to operate on
+ * @param[in,out]   entry   timer to remove, must be set
+ */
+void ztimer_wheel_del(ztimer_wheel_t *wheel, struct ztimer_base *entry);
+
+/**
+ * @brief   Advance the wheel to @p now
+ *
+ * Moves all timers with a target up to @p now to the expired list.
+ *
+ * @param[in,out]   wheel   wheel to operate on
+ * @param[in]       now     current time of the clock
+ */
+void ztimer_wheel_advance(ztimer_wheel_t *wheel, uint32_t now);
+
+/**
+ * @brief   Remove and return the earliest expired timer
+ *
+ * @param[in,out]   wheel   wheel to operate on
+ *
+ * @return  earliest expired timer
+ * @return  NULL if no timer has expired
+ */
+struct ztimer_base *ztimer_wheel_pop_expired(ztimer_wheel_t *wheel);
+
+/**
+ * @brief   Get the time until the wheel needs to be advanced next
+ *
+ * @pre     The wheel is not empty
+ *
+ * @param[in]       wheel   wheel to operate on
+ *
+ * @return  ticks relative to the wheel base until the next timer expires or
+ *          the next slot needs to be cascaded
+ */
+uint32_t ztimer_wheel_next(const ztimer_wheel_t *wheel);
+
+/**
+ * @brief   Check if the wheel holds no timers
+ *
+ * @param[in]       wheel   wheel to operate on
+ *
+ * @return  true if no timer is set
+ */
+bool ztimer_wheel_is_empty(const ztimer_wheel_t *wheel);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZTIMER_WHEEL_H */
+/** @} */
@@ -1514,6 +1514,8 @@ static bool _cache_lookup(gcoap_request_memo_t *memo,
         uint8_t cache_key[SHA256_DIGEST_LENGTH];
         ztimer_now_t now = ztimer_now(ZTIMER_SEC);
 
+        /* the key is only generated once per request, the copy in the memo
+         * is reused when the response is processed */
         nanocoap_cache_key_generate(pdu, cache_key);
         *ce = nanocoap_cache_key_lookup(cache_key);
 
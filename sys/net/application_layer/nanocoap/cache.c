@@ -20,7 +20,9 @@
 
 #include <string.h>
 
+#include "byteorder.h"
 #include "kernel_defines.h"
+#include "macros/utils.h"
 #include "net/nanocoap/cache.h"
 #include "hashes/sha256.h"
 
@@ -35,6 +37,33 @@ static clist_node_t _empty_list_head = { NULL };
 
 static nanocoap_cache_entry_t _cache_entries[CONFIG_NANOCOAP_CACHE_ENTRIES];
 
+static_assert(CONFIG_NANOCOAP_CACHE_INDEX_SIZE > CONFIG_NANOCOAP_CACHE_ENTRIES,
+              "CONFIG_NANOCOAP_CACHE_INDEX_SIZE must exceed CONFIG_NANOCOAP_CACHE_ENTRIES");
+
+#if CONFIG_NANOCOAP_CACHE_ENTRIES < UINT8_MAX
+typedef uint8_t _index_slot_t;
+#else
+typedef uint16_t _index_slot_t;
+#endif
+
+/**
+ * @brief   Open-addressed (linear probing) index over all used cache entries
+ *
+ * Each slot holds the position of an entry in @ref _cache_entries plus one,
+ * 0 marks an empty slot. Slots are addressed by a prefix of the cache key,
+ * which is already uniformly distributed as it is the output of a hash
+ * function, either SHA-256 or FNV-1a with `nanocoap_cache_key_fnv`.
+ */
+static _index_slot_t _cache_index[CONFIG_NANOCOAP_CACHE_INDEX_SIZE];
+
+/**
+ * @brief   Predecessor of each used entry in @ref _cache_list_head
+ *
+ * @ref _cache_list_head is singly linked, so this lets an entry be moved or
+ * removed without walking the list. NULL marks an entry not in the list.
+ */
+static clist_node_t *_cache_list_prev[CONFIG_NANOCOAP_CACHE_ENTRIES];
+
 static const nanocoap_cache_replacement_strategy_t _replacement_strategy = _cache_replacement_lru;
 static const nanocoap_cache_update_strategy_t _update_strategy = _cache_update_lru;
 
@@ -51,12 +80,119 @@ static int _cache_replacement_lru(void)
     return nanocoap_cache_del(lru_ce);
 }
 
+static unsigned _index_home(const uint8_t *cache_key)
+{
+    uint32_t prefix = 0;
+
+    for (unsigned i = 0; i < MIN(sizeof(prefix), CONFIG_NANOCOAP_CACHE_KEY_LENGTH); i++) {
+        prefix = (prefix << 8) | cache_key[i];
+    }
+    return prefix % CONFIG_NANOCOAP_CACHE_INDEX_SIZE;
+}
+
+static inline unsigned _index_next(unsigned slot)
+{
+    return (slot + 1) % CONFIG_NANOCOAP_CACHE_INDEX_SIZE;
+}
+
+static int _index_find(const uint8_t *cache_key)
+{
+    unsigned slot = _index_home(cache_key);
+
+    /* the index is never full, so an empty slot terminates every probe */
+    while (_cache_index[slot]) {
+        nanocoap_cache_entry_t *ce = &_cache_entries[_cache_index[slot] - 1];
+        if (!memcmp(ce->cache_key, cache_key, CONFIG_NANOCOAP_CACHE_KEY_LENGTH)) {
+            return slot;
+        }
+        slot = _index_next(slot);
+    }
+    return -1;
+}
+
+static void _index_add(const nanocoap_cache_entry_t *ce)
+{
+    unsigned slot = _index_home(ce->cache_key);
+
+    while (_cache_index[slot]) {
+        slot = _index_next(slot);
+    }
+    _cache_index[slot] = (ce - _cache_entries) + 1;
+}
+
+static void _index_del(unsigned hole)
+{
+    /* backward shift deletion: move succeeding entries of the probe
+     * sequence into the hole, so no tombstones are needed */
+    for (unsigned slot = _index_next(hole); _cache_index[slot]; slot = _index_next(slot)) {
+        nanocoap_cache_entry_t *ce = &_cache_entries[_cache_index[slot] - 1];
+        unsigned home = _index_home(ce->cache_key);
+        unsigned dist_home = (slot + CONFIG_NANOCOAP_CACHE_INDEX_SIZE - home)
+                           % CONFIG_NANOCOAP_CACHE_INDEX_SIZE;
+        unsigned dist_hole = (slot + CONFIG_NANOCOAP_CACHE_INDEX_SIZE - hole)
+                           % CONFIG_NANOCOAP_CACHE_INDEX_SIZE;
+
+        if (dist_home >= dist_hole) {
+            _cache_index[hole] = _cache_index[slot];
+            hole = slot;
+        }
+    }
+    _cache_index[hole] = 0;
+}
+
+static inline clist_node_t **_lru_prev(const clist_node_t *node)
+{
+    const nanocoap_cache_entry_t *ce = container_of(node, nanocoap_cache_entry_t, node);
+
+    return &_cache_list_prev[ce - _cache_entries];
+}
+
+static void _lru_push(clist_node_t *node)
+{
+    clist_node_t *last = _cache_list_head.next;
+
+    if (last) {
+        /* the list is circular, the last node points to the first one */
+        *_lru_prev(last->next) = node;
+        *_lru_prev(node) = last;
+        node->next = last->next;
+        last->next = node;
+    }
+    else {
+        *_lru_prev(node) = node;
+        node->next = node;
+    }
+    _cache_list_head.next = node;
+}
+
+static bool _lru_remove(clist_node_t *node)
+{
+    clist_node_t *prev = *_lru_prev(node);
+
+    if (!prev) {
+        return false;
+    }
+    if (prev == node) {
+        _cache_list_head.next = NULL;
+    }
+    else {
+        prev->next = node->next;
+        *_lru_prev(node->next) = prev;
+        if (_cache_list_head.next == node) {
+            _cache_list_head.next = prev;
+        }
+    }
+    *_lru_prev(node) = NULL;
+    node->next = NULL;
+    return true;
+}
+
 static int _cache_update_lru(clist_node_t *node)
 {
-    if (clist_remove(&_cache_list_head, node)) {
+    if (_lru_remove(node)) {
         /* Move an accessed node to the end of the list. Least
          * recently used nodes are at the beginning of this list */
-        clist_rpush(&_cache_list_head, node);
+        _lru_push(node);
         return 0;
     }
     return -1;
@@ -67,6 +203,8 @@ void nanocoap_cache_init(void)
     _cache_list_head.next = NULL;
     _empty_list_head.next = NULL;
     memset(_cache_entries, 0, sizeof(_cache_entries));
+    memset(_cache_index, 0, sizeof(_cache_index));
+    memset(_cache_list_prev, 0, sizeof(_cache_list_prev));
     /* construct list of empty entries */
     for (unsigned i = 0; i < CONFIG_NANOCOAP_CACHE_ENTRIES; i++) {
         clist_rpush(&_empty_list_head, &_cache_entries[i].node);
@@ -83,7 +221,56 @@ size_t nanocoap_cache_free_count(void)
     return clist_count(&_empty_list_head);
 }
 
-static void _cache_key_digest_opts(const coap_pkt_t *req, sha256_context_t *ctx,
+#if IS_USED(MODULE_NANOCOAP_CACHE_KEY_FNV)
+#define FNV1A_64_OFFSET_BASIS   (0xcbf29ce484222325ULL)
+#define FNV1A_64_PRIME          (0x100000001b3ULL)
+
+typedef uint64_t _key_ctx_t;
+
+static inline void _key_init(_key_ctx_t *ctx)
+{
+    *ctx = FNV1A_64_OFFSET_BASIS;
+}
+
+static void _key_update(_key_ctx_t *ctx, const void *data, size_t len)
+{
+    const uint8_t *bytes = data;
+    uint64_t hash = *ctx;
+
+    for (size_t i = 0; i < len; i++) {
+        hash ^= bytes[i];
+        hash *= FNV1A_64_PRIME;
+    }
+    *ctx = hash;
+}
+
+static void _key_final(_key_ctx_t *ctx, void *cache_key)
+{
+    /* callers provide room for a SHA-256 digest, pad with zeros so the
+     * output does not depend on CONFIG_NANOCOAP_CACHE_KEY_LENGTH */
+    memset(cache_key, 0, SHA256_DIGEST_LENGTH);
+    byteorder_htobebufll(cache_key, *ctx);
+}
+#else
+typedef sha256_context_t _key_ctx_t;
+
+static inline void _key_init(_key_ctx_t *ctx)
+{
+    sha256_init(ctx);
+}
+
+static inline void _key_update(_key_ctx_t *ctx, const void *data, size_t len)
+{
+    sha256_update(ctx, data, len);
+}
+
+static inline void _key_final(_key_ctx_t *ctx, void *cache_key)
+{
+    sha256_final(ctx, cache_key);
+}
+#endif
+
+static void _cache_key_digest_opts(const coap_pkt_t *req, _key_ctx_t *ctx,
         bool include_etag,
         bool include_blockwise)
 {
@@ -111,42 +298,42 @@ static void _cache_key_digest_opts(const coap_pkt_t *req, sha256_context_t *ctx,
                     )) {
                 continue;
             }
-            sha256_update(ctx, &opt.opt_num, sizeof(opt.opt_num));
-            sha256_update(ctx, value, optlen);
+            _key_update(ctx, &opt.opt_num, sizeof(opt.opt_num));
+            _key_update(ctx, value, optlen);
         }
     }
 }
 
 void nanocoap_cache_key_options_generate(const coap_pkt_t *req, void *cache_key)
 {
-    sha256_context_t ctx;
-    sha256_init(&ctx);
+    _key_ctx_t ctx;
+    _key_init(&ctx);
     _cache_key_digest_opts(req, &ctx, true, true);
-    sha256_final(&ctx, cache_key);
+    _key_final(&ctx, cache_key);
 }
 
 void nanocoap_cache_key_blockreq_options_generate(const coap_pkt_t *req, void *cache_key)
 {
-    sha256_context_t ctx;
-    sha256_init(&ctx);
+    _key_ctx_t ctx;
+    _key_init(&ctx);
     _cache_key_digest_opts(req, &ctx, true, false);
-    sha256_final(&ctx, cache_key);
+    _key_final(&ctx, cache_key);
 }
 
 void nanocoap_cache_key_generate(const coap_pkt_t *req, uint8_t *cache_key)
 {
-    sha256_context_t ctx;
-    sha256_init(&ctx);
+    _key_ctx_t ctx;
+    _key_init(&ctx);
 
     _cache_key_digest_opts(req, &ctx, !(IS_USED(MODULE_GCOAP_FORWARD_PROXY)), true);
     switch (req->hdr->code) {
         case COAP_METHOD_FETCH:
-            sha256_update(&ctx, req->payload, req->payload_len);
+            _key_update(&ctx, req->payload, req->payload_len);
             break;
         default:
             break;
     }
-    sha256_final(&ctx, cache_key);
+    _key_final(&ctx, cache_key);
 }
 
 ssize_t nanocoap_cache_key_compare(uint8_t *cache_key1, uint8_t *cache_key2)
@@ -154,31 +341,18 @@ ssize_t nanocoap_cache_key_compare(uint8_t *cache_key1, uint8_t *cache_key2)
     return memcmp(cache_key1, cache_key2, CONFIG_NANOCOAP_CACHE_KEY_LENGTH);
 }
 
-static int _compare_cache_keys(clist_node_t *ce, void *arg)
-{
-    nanocoap_cache_entry_t *iterator = container_of(ce, nanocoap_cache_entry_t, node);
-    uint8_t *cache_key = (uint8_t *) arg;
-
-    if (!memcmp(iterator->cache_key, cache_key, CONFIG_NANOCOAP_CACHE_KEY_LENGTH)) {
-        return 1;
-    }
-    return 0;
-}
-
-static clist_node_t *_nanocoap_cache_foreach(const uint8_t *key)
-{
-    return clist_foreach(&_cache_list_head, _compare_cache_keys, (uint8_t *)key);
-}
-
 nanocoap_cache_entry_t *nanocoap_cache_key_lookup(const uint8_t *key)
 {
-    clist_node_t *node = _nanocoap_cache_foreach(key);
+    int slot = _index_find(key);
 
-    if (node) {
-        _update_strategy(node);
+    if (slot < 0) {
+        return NULL;
     }
 
-    return container_of(node, nanocoap_cache_entry_t, node);
+    nanocoap_cache_entry_t *ce = &_cache_entries[_cache_index[slot] - 1];
+    _update_strategy(&ce->node);
+
+    return ce;
 }
 
 nanocoap_cache_entry_t *nanocoap_cache_request_lookup(const coap_pkt_t *req)
@@ -321,7 +495,8 @@ nanocoap_cache_entry_t *nanocoap_cache_add_by_key(const uint8_t *cache_key,
     ce->max_age = ztimer_now(ZTIMER_SEC) + max_age;
 
     if (add_to_cache) {
-        clist_rpush(&_cache_list_head, &ce->node);
+        _lru_push(&ce->node);
+        _index_add(ce);
     }
 
     return ce;
@@ -344,10 +519,13 @@ nanocoap_cache_entry_t *nanocoap_cache_add_by_req(const coap_pkt_t *req,
 
 int nanocoap_cache_del(const nanocoap_cache_entry_t *ce)
 {
-    clist_node_t *entry = clist_find(&_cache_list_head, &ce->node);
+    clist_node_t *entry = (clist_node_t *)&ce->node;
 
-    if (entry) {
-        clist_remove(&_cache_list_head, entry);
+    if (_lru_remove(entry)) {
+        int slot = _index_find(ce->cache_key);
+        if (slot >= 0) {
+            _index_del(slot);
+        }
         memset(entry, 0, sizeof(nanocoap_cache_entry_t));
         clist_rpush(&_empty_list_head, entry);
         return 0;
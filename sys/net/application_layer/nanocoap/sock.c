@@ -26,6 +26,7 @@
 #include <stdio.h>
 
 #include "atomic_utils.h"
+#include "container.h"
 #include "net/credman.h"
 #include "net/nanocoap.h"
 #include "net/nanocoap_sock.h"
@@ -669,6 +670,379 @@ static int _fetch_block(nanocoap_sock_t *sock, uint8_t *buf, size_t len,
     return nanocoap_sock_request_cb(sock, &pkt, _block_cb, ctx);
 }
 
+enum {
+    SLOT_FREE,              /**< slot is not in use */
+    SLOT_SENT,              /**< request was sent, waiting for the response */
+    SLOT_ACKED,             /**< empty ACK received, waiting for separate response */
+    SLOT_DONE,              /**< response received ahead of order, buffered */
+};
+
+typedef struct {
+    uint32_t blknum;        /**< requested block */
+    uint32_t timeout;       /**< current retransmission timeout */
+    uint32_t deadline;      /**< deadline for the next retransmission */
+    int res;                /**< payload length or error of the response */
+    uint16_t id;            /**< message ID of the request */
+    uint8_t state;          /**< slot state */
+    uint8_t tries_left;     /**< transmissions left for this request */
+    bool more;              /**< more flag of the response */
+    uint8_t payload[1 << CONFIG_NANOCOAP_BLOCK_SIZE_EXP_MAX];
+} _block_slot_t;
+
+typedef struct {
+    nanocoap_sock_t *sock;
+    const char *path;
+    _block_ctx_t *ctx;      /**< ctx->blknum is the next block to deliver */
+    size_t end;             /**< end offset of the requested range */
+    uint32_t next;          /**< next block to request */
+    uint32_t last;          /**< last block to deliver */
+    uint32_t token;         /**< token base, XORed with the block number */
+    coap_blksize_t blksize;
+    bool blksize_known;     /**< the server confirmed the block size */
+    _block_slot_t slots[CONFIG_NANOCOAP_SOCK_BLOCK_WINDOW];
+} _block_window_t;
+
+static_assert((CONFIG_NANOCOAP_SOCK_BLOCK_WINDOW >= 1) &&
+              (CONFIG_NANOCOAP_SOCK_BLOCK_WINDOW <= 8),
+              "CONFIG_NANOCOAP_SOCK_BLOCK_WINDOW must be in [1, 8]");
+
+static uint32_t _window_blknum(const _block_window_t *win, size_t offset)
+{
+    return offset >> (win->blksize + 4);
+}
+
+static void _window_token(const _block_window_t *win, uint32_t blknum,
+                          uint8_t *token)
+{
+    uint32_t tmp = win->token ^ blknum;
+
+    memcpy(token, &tmp, sizeof(tmp));
+}
+
+static int _window_send(_block_window_t *win, _block_slot_t *slot)
+{
+    uint8_t buf[CONFIG_NANOCOAP_BLOCK_HEADER_MAX];
+    uint8_t token[sizeof(win->token)];
+    uint8_t *pos = buf;
+    uint16_t lastonum = 0;
+
+    _window_token(win, slot->blknum, token);
+    pos += coap_build_hdr((void *)buf, COAP_TYPE_CON, token, sizeof(token),
+                          COAP_METHOD_GET, slot->id);
+    pos += coap_opt_put_uri_pathquery(pos, &lastonum, win->path);
+    pos += coap_opt_put_uint(pos, lastonum, COAP_OPT_BLOCK2,
+                             (slot->blknum << 4) | win->blksize);
+    assert((size_t)(pos - buf) < sizeof(buf));
+
+    const iolist_t snip = {
+        .iol_base = buf,
+        .iol_len  = pos - buf,
+    };
+
+    DEBUG("nanocoap: request block %"PRIu32" (%u tries left)\n",
+          slot->blknum, slot->tries_left - 1);
+
+    --slot->tries_left;
+    slot->deadline = _deadline_from_interval(slot->timeout);
+
+    int res = _sock_sendv(win->sock, &snip);
+    return (res < 0) ? res : 0;
+}
+
+/* keeps up to CONFIG_NANOCOAP_SOCK_BLOCK_WINDOW requests in flight, but only
+ * one until the first response told us whether the block size is accepted */
+static int _window_fill(_block_window_t *win)
+{
+    unsigned window = win->blksize_known ? CONFIG_NANOCOAP_SOCK_BLOCK_WINDOW : 1;
+    unsigned used = 0;
+
+    for (unsigned i = 0; i < ARRAY_SIZE(win->slots); i++) {
+        used += (win->slots[i].state != SLOT_FREE);
+    }
+
+    for (unsigned i = 0; i < ARRAY_SIZE(win->slots); i++) {
+        _block_slot_t *slot = &win->slots[i];
+
+        if (used >= window || win->next > win->last) {
+            break;
+        }
+        if (slot->state != SLOT_FREE) {
+            continue;
+        }
+
+        slot->blknum = win->next++;
+        slot->id = nanocoap_sock_next_msg_id(win->sock);
+        slot->timeout = random_uint32_range(
+                (uint32_t)CONFIG_COAP_ACK_TIMEOUT_MS * US_PER_MS,
+                (uint32_t)CONFIG_COAP_ACK_TIMEOUT_MS * CONFIG_COAP_RANDOM_FACTOR_1000);
+        slot->tries_left = CONFIG_COAP_MAX_RETRANSMIT + 1;
+        slot->state = SLOT_SENT;
+        ++used;
+
+        int res = _window_send(win, slot);
+        if (res < 0) {
+            return res;
+        }
+    }
+
+    return 0;
+}
+
+static int _window_deliver(_block_window_t *win, _block_slot_t *slot,
+                           uint8_t *payload, int len, bool more)
+{
+    _block_ctx_t *ctx = win->ctx;
+    size_t offset = (size_t)slot->blknum << (win->blksize + 4);
+
+    slot->state = SLOT_FREE;
+    if (len < 0) {
+        return len;
+    }
+
+    ctx->blknum += 1;
+    ctx->more = more;
+    return ctx->callback(ctx->arg, offset, payload, len, more);
+}
+
+static _block_slot_t *_window_buffered(_block_window_t *win)
+{
+    for (unsigned i = 0; i < ARRAY_SIZE(win->slots); i++) {
+        _block_slot_t *slot = &win->slots[i];
+
+        if (slot->state == SLOT_DONE && slot->blknum == win->ctx->blknum) {
+            return slot;
+        }
+    }
+
+    return NULL;
+}
+
+static int _window_response(_block_window_t *win, _block_slot_t *slot,
+                            coap_pkt_t *pkt)
+{
+    coap_block1_t block2;
+    int res = _get_error(pkt);
+
+    /* response was not block-wise */
+    if (!coap_get_block2(pkt, &block2)) {
+        block2.blknum = 0;
+        block2.szx = win->blksize;
+        block2.more = false;
+    }
+
+    if (!res && !win->blksize_known) {
+        /* the server may answer the first request with a smaller block size,
+         * this is the only request in flight */
+        if (block2.szx < win->blksize) {
+            win->blksize = block2.szx;
+            slot->blknum = block2.blknum;
+            win->ctx->blknum = block2.blknum;
+            win->next = block2.blknum + 1;
+            if (win->end != SIZE_MAX) {
+                win->last = _window_blknum(win, win->end - 1);
+            }
+        }
+        win->blksize_known = true;
+    }
+
+    if (!res && (block2.szx != win->blksize || block2.blknum != slot->blknum)) {
+        DEBUG("nanocoap: got block %"PRIu32", expected %"PRIu32"\n",
+              block2.blknum, slot->blknum);
+        res = -EBADMSG;
+    }
+
+    if (!res && !block2.more && block2.blknum < win->last) {
+        /* drop the requests for blocks past the end of the resource */
+        win->last = block2.blknum;
+        for (unsigned i = 0; i < ARRAY_SIZE(win->slots); i++) {
+            if (win->slots[i].blknum > win->last) {
+                win->slots[i].state = SLOT_FREE;
+            }
+        }
+    }
+
+    if (!res) {
+        res = pkt->payload_len;
+    }
+
+    DEBUG("nanocoap: got block %"PRIu32" (%d)\n", slot->blknum, res);
+
+    /* hand the next block in order to the callback without copying it */
+    if (slot->blknum == win->ctx->blknum) {
+        return _window_deliver(win, slot, pkt->payload, res, block2.more);
+    }
+
+    if (res > (int)sizeof(slot->payload)) {
+        res = -EBADMSG;
+    }
+    else if (res > 0) {
+        memcpy(slot->payload, pkt->payload, res);
+    }
+    slot->res = res;
+    slot->more = block2.more;
+    slot->state = SLOT_DONE;
+
+    return 0;
+}
+
+/* checks whether the token of pkt belongs to a block requested before */
+static bool _window_requested(const _block_window_t *win, const coap_pkt_t *pkt)
+{
+    uint32_t blknum;
+
+    if (coap_get_token_len(pkt) != sizeof(blknum)) {
+        return false;
+    }
+    memcpy(&blknum, coap_get_token(pkt), sizeof(blknum));
+    return (blknum ^ win->token) < win->next;
+}
+
+static int _window_handle(_block_window_t *win, coap_pkt_t *pkt)
+{
+    uint8_t token[sizeof(win->token)];
+
+    for (unsigned i = 0; i < ARRAY_SIZE(win->slots); i++) {
+        _block_slot_t *slot = &win->slots[i];
+
+        if (slot->state != SLOT_SENT && slot->state != SLOT_ACKED) {
+            continue;
+        }
+        _window_token(win, slot->blknum, token);
+        if (_id_or_token_missmatch(pkt, slot->id, token, sizeof(token))) {
+            continue;
+        }
+
+        switch (coap_get_type(pkt)) {
+        case COAP_TYPE_RST:
+            return -EBADMSG;
+        case COAP_TYPE_ACK:
+            if (coap_get_code_raw(pkt) == COAP_CODE_EMPTY) {
+                /* empty ACK, wait for separate response */
+                slot->state = SLOT_ACKED;
+                slot->deadline = _deadline_from_interval(
+                        CONFIG_COAP_SEPARATE_RESPONSE_TIMEOUT_MS * US_PER_MS);
+                slot->tries_left = 0;
+                return 0;
+            }
+            break;
+        case COAP_TYPE_CON:
+            _send_ack(win->sock, pkt);
+            break;
+        default:
+            break;
+        }
+
+        return _window_response(win, slot, pkt);
+    }
+
+    /* the server did not get our ACK of a response to a block that was
+     * already received, acknowledge the duplicate again */
+    if (coap_get_type(pkt) == COAP_TYPE_CON && _window_requested(win, pkt)) {
+        DEBUG("nanocoap: duplicate response %u\n", coap_get_id(pkt));
+        _send_ack(win->sock, pkt);
+        return 0;
+    }
+
+    DEBUG("nanocoap: no request for message %u\n", coap_get_id(pkt));
+    return 0;
+}
+
+static int _window_recv(_block_window_t *win)
+{
+    uint32_t timeout = UINT32_MAX;
+
+    /* retransmit expired requests, wait for the earliest deadline */
+    for (unsigned i = 0; i < ARRAY_SIZE(win->slots); i++) {
+        _block_slot_t *slot = &win->slots[i];
+
+        if (slot->state != SLOT_SENT && slot->state != SLOT_ACKED) {
+            continue;
+        }
+
+        uint32_t left = _deadline_left_us(slot->deadline);
+        if (left == 0) {
+            if (slot->tries_left == 0) {
+                DEBUG("nanocoap: maximum retries reached\n");
+                return -ETIMEDOUT;
+            }
+            slot->timeout *= 2;
+
+            int res = _window_send(win, slot);
+            if (res < 0) {
+                return res;
+            }
+            left = slot->timeout;
+        }
+        timeout = MIN(timeout, left);
+    }
+
+    void *payload, *ctx = NULL;
+    coap_pkt_t pkt;
+    int res = _sock_recv_buf(win->sock, &payload, &ctx, timeout);
+    if (res == -ETIMEDOUT) {
+        return 0;
+    }
+    if (res < 0) {
+        DEBUG("nanocoap: error receiving CoAP response, %d\n", res);
+        return res;
+    }
+
+    if (coap_parse(&pkt, payload, res) < 0) {
+        DEBUG("nanocoap: error parsing packet\n");
+        res = 0;
+    }
+    else {
+        res = _window_handle(win, &pkt);
+    }
+
+    while (ctx) {
+        /* release the packet */
+        _sock_recv_buf(win->sock, &payload, &ctx, 0);
+    }
+
+    return res;
+}
+
+static int _fetch_window(nanocoap_sock_t *sock, const char *path,
+                         coap_blksize_t blksize, _block_ctx_t *ctx,
+                         size_t offset, size_t end)
+{
+    _block_window_t win = {
+        .sock = sock,
+        .path = path,
+        .ctx = ctx,
+        .end = end,
+        .blksize = MIN(blksize, CONFIG_NANOCOAP_BLOCK_SIZE_EXP_MAX - 4),
+    };
+
+    random_bytes(&win.token, sizeof(win.token));
+
+    ctx->blknum = _window_blknum(&win, offset);
+    win.next = ctx->blknum;
+    win.last = (end == SIZE_MAX) ? UINT32_MAX : _window_blknum(&win, end - 1);
+
+    while (ctx->blknum <= win.last) {
+        int res = _window_fill(&win);
+        if (res == 0) {
+            res = _window_recv(&win);
+        }
+
+        /* pass on blocks that were received ahead of order */
+        _block_slot_t *slot;
+        while (res >= 0 && (slot = _window_buffered(&win))) {
+            res = _window_deliver(&win, slot, slot->payload, slot->res, slot->more);
+        }
+
+        if (res < 0) {
+            DEBUG("nanocoap: error fetching block %"PRIu32": %d\n",
+                  ctx->blknum, res);
+            return res;
+        }
+    }
+
+    return 0;
+}
+
 int nanocoap_sock_block_request(coap_block_request_t *req,
                                 const void *data, size_t len, bool more,
                                 coap_request_cb_t callback, void *arg)
@@ -728,6 +1102,10 @@ int nanocoap_sock_get_blockwise(nanocoap_sock_t *sock, const char *path,
         .more = true,
     };
 
+    if (CONFIG_NANOCOAP_SOCK_BLOCK_WINDOW > 1) {
+        return _fetch_window(sock, path, blksize, &ctx, 0, SIZE_MAX);
+    }
+
 #if CONFIG_NANOCOAP_SOCK_BLOCK_TOKEN
     random_bytes(ctx.token, sizeof(ctx.token));
 #endif
@@ -837,6 +1215,11 @@ int nanocoap_sock_get_slice(nanocoap_sock_t *sock, const char *path,
         .more = true,
     };
 
+    if (CONFIG_NANOCOAP_SOCK_BLOCK_WINDOW > 1 && len) {
+        int res = _fetch_window(sock, path, blksize, &ctx, offset, offset + len);
+        return (res < 0) ? res : (int)dst_ctx.res;
+    }
+
 #if CONFIG_NANOCOAP_SOCK_BLOCK_TOKEN
     random_bytes(ctx.token, sizeof(ctx.token));
 #endif
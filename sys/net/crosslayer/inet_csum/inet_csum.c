@@ -14,7 +14,9 @@
 
 #include <inttypes.h>
 #include <stdio.h>
+#include <string.h>
 
+#include "byteorder.h"
 #include "modules.h"
 #include "od.h"
 #include "net/inet_csum.h"
@@ -22,6 +24,64 @@
 #define ENABLE_DEBUG 0
 #include "debug.h"
 
+/**
+ * @brief   Add @p words 16-bit big-endian words in @p buf to @p csum
+ */
+static uint32_t _sum_words(uint32_t csum, const uint8_t *buf, unsigned words)
+{
+    for (unsigned i = 0; i < words; buf += 2, i++) {
+        csum += (uint16_t)(*buf << 8) + *(buf + 1); /* group bytes by 16-byte words */
+                                                    /* and add them */
+    }
+    return csum;
+}
+
+/**
+ * @brief   Load the 32-bit word at aligned @p buf
+ *
+ * Going through memcpy() keeps the access to the packet bytes legal under
+ * strict aliasing, the alignment hint makes it a single load.
+ */
+static inline uint32_t _load_u32(const uint8_t *buf)
+{
+    uint32_t word;
+
+    memcpy(&word, __builtin_assume_aligned(buf, sizeof(uint32_t)), sizeof(word));
+    return word;
+}
+
+/**
+ * @brief   Sum @p n 32-bit aligned words in @p buf
+ *
+ * The one's complement sum does not depend on the byte order (RFC 1071,
+ * section 2), so the words are added in host byte order into a 64-bit
+ * accumulator. The carries are only folded back once at the end.
+ *
+ * @return  folded sum in host byte order
+ */
+static uint16_t _sum_aligned(const uint8_t *buf, unsigned n)
+{
+    uint64_t acc = 0;
+
+    for (; n >= 4; buf += 4 * sizeof(uint32_t), n -= 4) {
+        acc += _load_u32(buf);
+        acc += _load_u32(buf + 4);
+        acc += _load_u32(buf + 8);
+        acc += _load_u32(buf + 12);
+    }
+    for (; n; buf += sizeof(uint32_t), n--) {
+        acc += _load_u32(buf);
+    }
+
+    acc = (acc & 0xffffffff) + (acc >> 32);
+    acc = (acc & 0xffffffff) + (acc >> 32);
+    acc = (acc & 0xffff) + (acc >> 16);
+    acc = (acc & 0xffff) + (acc >> 16);
+    acc = (acc & 0xffff) + (acc >> 16);
+
+    return acc;
+}
+
 uint16_t inet_csum_slice(uint16_t sum, const uint8_t *buf, uint16_t len, size_t accum_len)
 {
     uint32_t csum = sum;
@@ -47,11 +107,27 @@ uint16_t inet_csum_slice(uint16_t sum, const uint8_t *buf, uint16_t len, size_t
         accum_len++;
     }
 
-    for (unsigned i = 0; i < (len >> 1); buf += 2, i++) {
-        csum += (uint16_t)(*buf << 8) + *(buf + 1); /* group bytes by 16-byte words */
-                                                    /* and add them */
+    unsigned words = len >> 1;
+
+    /* the 32-bit loads need the 16-bit words to be aligned */
+    if (!((uintptr_t)buf & 1)) {
+        if (((uintptr_t)buf & 2) && words) {
+            csum = _sum_words(csum, buf, 1);
+            buf += 2;
+            words--;
+        }
+
+        unsigned n = words >> 1;
+        if (n) {
+            csum += ntohs(_sum_aligned(buf, n));
+            buf += n * sizeof(uint32_t);
+            words -= n * 2;
+        }
     }
 
+    csum = _sum_words(csum, buf, words);
+    buf += words * 2;
+
     if ((accum_len + len) & 1)          /* if accumulated length is odd */
         csum += (uint16_t)(*buf << 8);  /* add last byte as top half of 16-byte word */
 
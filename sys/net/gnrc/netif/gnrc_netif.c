@@ -54,6 +54,9 @@ static void _update_l2addr_from_dev(gnrc_netif_t *netif);
 static void _check_netdev_capabilities(netdev_t *dev, bool legacy);
 static void *_gnrc_netif_thread(void *args);
 static void _event_cb(netdev_t *dev, netdev_event_t event);
+#if IS_USED(MODULE_GNRC_NETIF_RX_BATCH)
+static void _event_handler_rx(event_t *evp);
+#endif
 
 typedef struct {
     gnrc_netif_t *netif;
@@ -1946,6 +1949,9 @@ static void *_gnrc_netif_thread(void *args)
     netif->pid = thread_getpid();
 
     netif->event_isr.handler = _event_handler_isr;
+#if IS_USED(MODULE_GNRC_NETIF_RX_BATCH)
+    netif->event_rx.handler = _event_handler_rx;
+#endif
 #if IS_USED(MODULE_NETDEV_NEW_API)
     netif->event_tx_done.handler = _event_handler_tx_done;
 #endif
@@ -2058,6 +2064,95 @@ static void _pass_on_packet(gnrc_pktsnip_t *pkt)
     }
 }
 
+#if IS_USED(MODULE_GNRC_NETIF_RX_BATCH)
+static bool _rx_pending(gnrc_netif_t *netif)
+{
+    netdev_t *dev = netif->dev;
+    netopt_enable_t pending = NETOPT_DISABLE;
+
+    return (dev->driver->get(dev, NETOPT_RX_PENDING, &pending,
+                             sizeof(pending)) > 0) &&
+           (pending == NETOPT_ENABLE);
+}
+
+static void _rx_batch_count(gnrc_netif_t *netif, unsigned frames, bool pending)
+{
+    gnrc_netif_rx_batch_stats_t *stats = &netif->rx_batch;
+    unsigned bucket = 0;
+
+    while ((frames >> (bucket + 1)) &&
+           (bucket < GNRC_NETIF_RX_BATCH_HIST_NUMOF - 1)) {
+        bucket++;
+    }
+
+    stats->events++;
+    stats->frames += frames;
+    stats->hist[bucket]++;
+    if (pending) {
+        stats->budget_exhausted++;
+    }
+}
+
+/**
+ * @brief   Read up to CONFIG_GNRC_NETIF_RX_BUDGET frames from the device and
+ *          pass them on once the device is drained
+ */
+static void _rx_batch(gnrc_netif_t *netif)
+{
+    gnrc_pktsnip_t *batch[CONFIG_GNRC_NETIF_RX_BUDGET];
+    unsigned numof = 0;
+    bool pending = false;
+
+    for (unsigned i = 0; i < CONFIG_GNRC_NETIF_RX_BUDGET; i++) {
+        gnrc_pktsnip_t *pkt = netif->ops->recv(netif);
+
+        if (pkt) {
+            _process_receive_stats(netif, pkt);
+            batch[numof++] = pkt;
+        }
+        pending = _rx_pending(netif);
+        if (!pending) {
+            break;
+        }
+    }
+    _rx_batch_count(netif, numof, pending);
+
+    /* send packet previously queued within netif due to the lower
+     * layer being busy.
+     * Further packets will be sent on later TX_COMPLETE */
+    _send_queued_pkt(netif);
+
+    for (unsigned i = 0; i < numof; i++) {
+        _pass_on_packet(batch[i]);
+    }
+
+    if (pending) {
+        /* let the other events in first, the device won't signal again for
+         * frames it already holds */
+        event_post(&netif->evq[GNRC_NETIF_EVQ_INDEX_PRIO_LOW], &netif->event_rx);
+    }
+}
+
+static void _event_handler_rx(event_t *evp)
+{
+    gnrc_netif_t *netif = container_of(evp, gnrc_netif_t, event_rx);
+
+    _rx_batch(netif);
+}
+
+void gnrc_netif_rx_batch_stats(gnrc_netif_t *netif,
+                               gnrc_netif_rx_batch_stats_t *stats, bool reset)
+{
+    /* the netif thread is updating this, guarantee a consistent copy */
+    unsigned irq_state = irq_disable();
+    *stats = netif->rx_batch;
+    if (reset) {
+        memset(&netif->rx_batch, 0, sizeof(netif->rx_batch));
+    }
+    irq_restore(irq_state);
+}
+#endif
+
 static void _event_cb(netdev_t *dev, netdev_event_t event)
 {
     gnrc_netif_t *netif = (gnrc_netif_t *)dev->context;
@@ -2074,7 +2169,9 @@ static void _event_cb(netdev_t *dev, netdev_event_t event)
 #endif
     else {
         DEBUG("gnrc_netif: event triggered -> %i\n", event);
+#if !IS_USED(MODULE_GNRC_NETIF_RX_BATCH)
         gnrc_pktsnip_t *pkt = NULL;
+#endif
         switch (event) {
             case NETDEV_EVENT_LINK_UP:
                 if (IS_USED(MODULE_GNRC_IPV6)) {
@@ -2091,6 +2188,9 @@ static void _event_cb(netdev_t *dev, netdev_event_t event)
                 }
                 break;
             case NETDEV_EVENT_RX_COMPLETE:
+#if IS_USED(MODULE_GNRC_NETIF_RX_BATCH)
+                _rx_batch(netif);
+#else
                 pkt = netif->ops->recv(netif);
                 /* send packet previously queued within netif due to the lower
                  * layer being busy.
@@ -2100,6 +2200,7 @@ static void _event_cb(netdev_t *dev, netdev_event_t event)
                     _process_receive_stats(netif, pkt);
                     _pass_on_packet(pkt);
                 }
+#endif
                 break;
 #if IS_USED(MODULE_NETDEV_LEGACY_API)
 #  if IS_USED(MODULE_NETSTATS_L2) || IS_USED(MODULE_GNRC_NETIF_PKTQ)
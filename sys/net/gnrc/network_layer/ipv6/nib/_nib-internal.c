@@ -19,6 +19,8 @@
 #include <string.h>
 #include <kernel_defines.h>
 
+#include "bitarithm.h"
+#include "container.h"
 #include "net/gnrc/icmpv6/error.h"
 #include "net/gnrc/ipv6.h"
 #include "net/gnrc/ipv6/nib/conf.h"
@@ -49,12 +51,140 @@ static rmutex_t _nib_mutex = RMUTEX_INIT;
 
 static char addr_str[IPV6_ADDR_MAX_STR_LEN];
 
+#if CONFIG_GNRC_IPV6_NIB_HASH_NUMOF
+#define _HASH_NIL   UINT16_MAX
+
+static_assert((CONFIG_GNRC_IPV6_NIB_NUMOF < _HASH_NIL) &&
+              (CONFIG_GNRC_IPV6_NIB_OFFL_NUMOF < _HASH_NIL),
+              "NIB too large for CONFIG_GNRC_IPV6_NIB_HASH_NUMOF");
+
+/**
+ * @brief   Hash index over the entries of a NIB table
+ *
+ * An entry is chained into the bucket of its key whenever the key is set.
+ * Cleared on-link entries may stay in their old bucket until they are
+ * reused, so every entry found needs to be compared against the key.
+ * Cleared off-link entries are removed from the index, as the prefix
+ * lengths in use are counted over the indexed entries.
+ */
+typedef struct {
+    uint16_t *head;     /**< first entry per bucket */
+    uint16_t *next;     /**< next entry in the same bucket per entry */
+    uint16_t *bucket;   /**< bucket an entry is chained into per entry */
+} _nib_hash_t;
+
+static uint16_t _onl_head[CONFIG_GNRC_IPV6_NIB_HASH_NUMOF];
+static uint16_t _onl_next[CONFIG_GNRC_IPV6_NIB_NUMOF];
+static uint16_t _onl_bucket[CONFIG_GNRC_IPV6_NIB_NUMOF];
+static uint16_t _offl_head[CONFIG_GNRC_IPV6_NIB_HASH_NUMOF];
+static uint16_t _offl_next[CONFIG_GNRC_IPV6_NIB_OFFL_NUMOF];
+static uint16_t _offl_bucket[CONFIG_GNRC_IPV6_NIB_OFFL_NUMOF];
+
+static const _nib_hash_t _onl_hash = { _onl_head, _onl_next, _onl_bucket };
+static const _nib_hash_t _offl_hash = { _offl_head, _offl_next, _offl_bucket };
+
+#define _LENS_BITS  (8 * sizeof(unsigned))
+
+/* prefix length every off-link entry is indexed with */
+static uint8_t _offl_len[CONFIG_GNRC_IPV6_NIB_OFFL_NUMOF];
+/* number of off-link entries indexed per prefix length */
+static uint16_t _offl_len_count[IPV6_ADDR_BIT_LEN + 1];
+/* prefix lengths with at least one off-link entry indexed */
+static unsigned _offl_lens[(IPV6_ADDR_BIT_LEN / _LENS_BITS) + 1];
+#endif  /* CONFIG_GNRC_IPV6_NIB_HASH_NUMOF */
+
 evtimer_msg_t _nib_evtimer;
 
 static void _override_node(const ipv6_addr_t *addr, unsigned iface,
                            _nib_onl_entry_t *node);
 static inline bool _node_unreachable(_nib_onl_entry_t *node);
 
+#if CONFIG_GNRC_IPV6_NIB_HASH_NUMOF
+/* hashes the first pfx_len bits of addr */
+static unsigned _hash(const ipv6_addr_t *addr, unsigned pfx_len)
+{
+    ipv6_addr_t key = IPV6_ADDR_UNSPECIFIED;
+    uint32_t hash = pfx_len;
+
+    ipv6_addr_init_prefix(&key, addr, pfx_len);
+    for (unsigned i = 0; i < ARRAY_SIZE(key.u32); i++) {
+        hash = (hash ^ key.u32[i].u32) * 0x9e3779b1;
+        hash ^= hash >> 15;
+    }
+    /* finalizer of MurmurHash3, so all bits matter for the bucket */
+    hash *= 0x85ebca6b;
+    hash ^= hash >> 13;
+    hash *= 0xc2b2ae35;
+    hash ^= hash >> 16;
+    return hash % CONFIG_GNRC_IPV6_NIB_HASH_NUMOF;
+}
+
+static void _hash_set(const _nib_hash_t *idx, unsigned entry, unsigned bucket)
+{
+    if (idx->bucket[entry] != _HASH_NIL) {
+        uint16_t *ptr = &idx->head[idx->bucket[entry]];
+
+        while (*ptr != entry) {
+            ptr = &idx->next[*ptr];
+        }
+        *ptr = idx->next[entry];
+    }
+    idx->bucket[entry] = bucket;
+    if (bucket != _HASH_NIL) {
+        idx->next[entry] = idx->head[bucket];
+        idx->head[bucket] = entry;
+    }
+}
+
+static void _onl_rehash(const _nib_onl_entry_t *node)
+{
+    unsigned bucket = _HASH_NIL;
+
+    /* entries without address are only searched linearly */
+    if (!ipv6_addr_is_unspecified(&node->ipv6)) {
+        bucket = _hash(&node->ipv6, IPV6_ADDR_BIT_LEN);
+    }
+    _hash_set(&_onl_hash, node - _nodes, bucket);
+}
+
+static void _offl_unhash(const _nib_offl_entry_t *dst)
+{
+    unsigned idx = dst - _dsts;
+
+    if ((_offl_bucket[idx] != _HASH_NIL) &&
+        (--_offl_len_count[_offl_len[idx]] == 0)) {
+        _offl_lens[_offl_len[idx] / _LENS_BITS] &= ~(1U << (_offl_len[idx] % _LENS_BITS));
+    }
+    _hash_set(&_offl_hash, idx, _HASH_NIL);
+}
+
+static void _offl_rehash(const _nib_offl_entry_t *dst)
+{
+    unsigned idx = dst - _dsts;
+
+    _offl_unhash(dst);
+    _hash_set(&_offl_hash, idx, _hash(&dst->pfx, dst->pfx_len));
+    _offl_len[idx] = dst->pfx_len;
+    _offl_len_count[dst->pfx_len]++;
+    _offl_lens[dst->pfx_len / _LENS_BITS] |= 1U << (dst->pfx_len % _LENS_BITS);
+}
+#else   /* CONFIG_GNRC_IPV6_NIB_HASH_NUMOF */
+static inline void _onl_rehash(const _nib_onl_entry_t *node)
+{
+    (void)node;
+}
+
+static inline void _offl_rehash(const _nib_offl_entry_t *dst)
+{
+    (void)dst;
+}
+
+static inline void _offl_unhash(const _nib_offl_entry_t *dst)
+{
+    (void)dst;
+}
+#endif  /* CONFIG_GNRC_IPV6_NIB_HASH_NUMOF */
+
 void _nib_init(void)
 {
 #ifdef TEST_SUITES
@@ -67,6 +197,14 @@ void _nib_init(void)
     memset(_abrs, 0, sizeof(_abrs));
 #endif  /* CONFIG_GNRC_IPV6_NIB_MULTIHOP_P6C */
 #endif  /* TEST_SUITES */
+#if CONFIG_GNRC_IPV6_NIB_HASH_NUMOF
+    memset(_onl_head, 0xff, sizeof(_onl_head));
+    memset(_onl_bucket, 0xff, sizeof(_onl_bucket));
+    memset(_offl_head, 0xff, sizeof(_offl_head));
+    memset(_offl_bucket, 0xff, sizeof(_offl_bucket));
+    memset(_offl_len_count, 0, sizeof(_offl_len_count));
+    memset(_offl_lens, 0, sizeof(_offl_lens));
+#endif  /* CONFIG_GNRC_IPV6_NIB_HASH_NUMOF */
     evtimer_init_msg(&_nib_evtimer);
     /* TODO: load ABR information from persistent memory */
 }
@@ -91,6 +229,37 @@ static inline bool _addr_equals(const ipv6_addr_t *addr,
     }
 }
 
+static inline bool _onl_if_matches(const _nib_onl_entry_t *node,
+                                   unsigned iface)
+{
+    /* either requested or current interface undefined or interfaces equal */
+    return (_nib_onl_get_if(node) == 0) || (iface == 0) ||
+           (_nib_onl_get_if(node) == iface);
+}
+
+#if CONFIG_GNRC_IPV6_NIB_HASH_NUMOF
+/* returns the same entry as a linear search over _nodes */
+static _nib_onl_entry_t *_onl_hash_get(const ipv6_addr_t *addr,
+                                       unsigned iface, bool alloc)
+{
+    _nib_onl_entry_t *res = NULL;
+
+    for (unsigned i = _onl_head[_hash(addr, IPV6_ADDR_BIT_LEN)]; i != _HASH_NIL;
+         i = _onl_next[i]) {
+        _nib_onl_entry_t *node = &_nodes[i];
+        bool match = (alloc) ? (_nib_onl_get_if(node) == iface)
+                             : ((node->mode != _EMPTY) &&
+                                _onl_if_matches(node, iface));
+
+        if (match && ((res == NULL) || (node < res)) &&
+            ipv6_addr_equal(&node->ipv6, addr)) {
+            res = node;
+        }
+    }
+    return res;
+}
+#endif  /* CONFIG_GNRC_IPV6_NIB_HASH_NUMOF */
+
 _nib_onl_entry_t *_nib_onl_alloc(const ipv6_addr_t *addr, unsigned iface)
 {
     _nib_onl_entry_t *node = NULL;
@@ -98,6 +267,18 @@ _nib_onl_entry_t *_nib_onl_alloc(const ipv6_addr_t *addr, unsigned iface)
     DEBUG("nib: Allocating on-link node entry (addr = %s, iface = %u)\n",
           (addr == NULL) ? "NULL" : ipv6_addr_to_str(addr_str, addr,
                                                      sizeof(addr_str)), iface);
+#if CONFIG_GNRC_IPV6_NIB_HASH_NUMOF
+    if ((addr != NULL) && !ipv6_addr_is_unspecified(addr)) {
+        node = _onl_hash_get(addr, iface, true);
+        for (unsigned i = 0; (node == NULL) && (i < CONFIG_GNRC_IPV6_NIB_NUMOF);
+             i++) {
+            if (_nodes[i].mode == _EMPTY) {
+                node = &_nodes[i];
+            }
+        }
+    }
+    else
+#endif  /* CONFIG_GNRC_IPV6_NIB_HASH_NUMOF */
     for (unsigned i = 0; i < CONFIG_GNRC_IPV6_NIB_NUMOF; i++) {
         _nib_onl_entry_t *tmp = &_nodes[i];
 
@@ -223,14 +404,18 @@ _nib_onl_entry_t *_nib_onl_get(const ipv6_addr_t *addr, unsigned iface)
     assert(addr != NULL);
     DEBUG("nib: Getting on-link node entry (addr = %s, iface = %u)\n",
           ipv6_addr_to_str(addr_str, addr, sizeof(addr_str)), iface);
+#if CONFIG_GNRC_IPV6_NIB_HASH_NUMOF
+    if (!ipv6_addr_is_unspecified(addr)) {
+        _nib_onl_entry_t *node = _onl_hash_get(addr, iface, false);
+
+        DEBUG("  Found %p\n", (void *)node);
+        return node;
+    }
+#endif  /* CONFIG_GNRC_IPV6_NIB_HASH_NUMOF */
     for (unsigned i = 0; i < CONFIG_GNRC_IPV6_NIB_NUMOF; i++) {
         _nib_onl_entry_t *node = &_nodes[i];
 
-        if ((node->mode != _EMPTY) &&
-            /* either requested or current interface undefined or
-             * interfaces equal */
-            ((_nib_onl_get_if(node) == 0) || (iface == 0) ||
-             (_nib_onl_get_if(node) == iface)) &&
+        if ((node->mode != _EMPTY) && _onl_if_matches(node, iface) &&
             ipv6_addr_equal(&node->ipv6, addr)) {
             DEBUG("  Found %p\n", (void *)node);
             return node;
@@ -475,10 +660,27 @@ void _nib_drl_ft_get(const _nib_dr_entry_t *drl, gnrc_ipv6_nib_ft_t *fte)
     fte->iface = _nib_onl_get_if(drl->next_hop);
 }
 
+static bool _offl_matches(const _nib_offl_entry_t *dst,
+                          const ipv6_addr_t *next_hop, unsigned iface,
+                          const ipv6_addr_t *pfx, unsigned pfx_len)
+{
+    const _nib_onl_entry_t *node = dst->next_hop;
+
+    if ((dst->mode == _EMPTY) || (dst->pfx_len != pfx_len) ||
+        (ipv6_addr_match_prefix(&dst->pfx, pfx) < pfx_len)) {
+        return false;
+    }
+    /* prefix matches */
+    assert(node);
+    /* next hop matches or is unspecified */
+    return (_nib_onl_get_if(node) == iface) &&
+           (ipv6_addr_is_unspecified(&node->ipv6) || _addr_equals(next_hop, node));
+}
+
 _nib_offl_entry_t *_nib_offl_alloc(const ipv6_addr_t *next_hop, unsigned iface,
                                    const ipv6_addr_t *pfx, unsigned pfx_len)
 {
-    _nib_offl_entry_t *dst = NULL;
+    _nib_offl_entry_t *dst = NULL, *match = NULL;
 
     assert((pfx != NULL) && (!ipv6_addr_is_unspecified(pfx)) &&
            (pfx_len > 0) && (pfx_len <= 128));
@@ -489,9 +691,27 @@ _nib_offl_entry_t *_nib_offl_alloc(const ipv6_addr_t *next_hop, unsigned iface,
           iface);
     DEBUG("pfx = %s/%u)\n", ipv6_addr_to_str(addr_str, pfx,
                                              sizeof(addr_str)), pfx_len);
+#if CONFIG_GNRC_IPV6_NIB_HASH_NUMOF
+    for (unsigned i = _offl_head[_hash(pfx, pfx_len)]; i != _HASH_NIL;
+         i = _offl_next[i]) {
+        _nib_offl_entry_t *tmp = &_dsts[i];
+
+        /* take the same entry as a linear search over _dsts */
+        if (((match == NULL) || (tmp < match)) &&
+            _offl_matches(tmp, next_hop, iface, pfx, pfx_len)) {
+            match = tmp;
+        }
+    }
+    for (unsigned i = 0; (match == NULL) && (i < CONFIG_GNRC_IPV6_NIB_OFFL_NUMOF);
+         i++) {
+        if (_dsts[i].mode == _EMPTY) {
+            dst = &_dsts[i];
+            break;
+        }
+    }
+#else   /* CONFIG_GNRC_IPV6_NIB_HASH_NUMOF */
     for (unsigned i = 0; i < CONFIG_GNRC_IPV6_NIB_OFFL_NUMOF; i++) {
         _nib_offl_entry_t *tmp = &_dsts[i];
-        _nib_onl_entry_t *tmp_node = tmp->next_hop;
 
         if (tmp->mode == _EMPTY) {
             if (dst == NULL) {
@@ -501,23 +721,23 @@ _nib_offl_entry_t *_nib_offl_alloc(const ipv6_addr_t *next_hop, unsigned iface,
         }
 
         /* else: offlink entry not empty, potential match */
-        if (tmp->pfx_len == pfx_len && ipv6_addr_match_prefix(&tmp->pfx, pfx) >= pfx_len) {
-            /* prefix matches */
-            assert(tmp_node);
-            if (_nib_onl_get_if(tmp_node) == iface && (ipv6_addr_is_unspecified(&tmp_node->ipv6)
-                                                       || _addr_equals(next_hop, tmp_node))) {
-                /* next hop matches or is unspecified */
-                DEBUG("  %p is an exact match\n", (void *)tmp);
-                if (next_hop != NULL) {
-                    /* sets next_hop if it was previously unspecified */
-                    memcpy(&tmp_node->ipv6, next_hop, sizeof(tmp_node->ipv6));
-                }
-                /*mark that this NCE is used by an offl_entry*/
-                tmp->next_hop->mode |= _DST;
-                return tmp;
-            }
+        if (_offl_matches(tmp, next_hop, iface, pfx, pfx_len)) {
+            match = tmp;
+            break;
         }
     }
+#endif  /* CONFIG_GNRC_IPV6_NIB_HASH_NUMOF */
+    if (match != NULL) {
+        DEBUG("  %p is an exact match\n", (void *)match);
+        if (next_hop != NULL) {
+            /* sets next_hop if it was previously unspecified */
+            memcpy(&match->next_hop->ipv6, next_hop, sizeof(match->next_hop->ipv6));
+            _onl_rehash(match->next_hop);
+        }
+        /*mark that this NCE is used by an offl_entry*/
+        match->next_hop->mode |= _DST;
+        return match;
+    }
     if (dst != NULL) {
         DEBUG("  using %p\n", (void *)dst);
         if (!dst->next_hop && !(dst->next_hop = _nib_onl_alloc(next_hop, iface))) {
@@ -528,6 +748,7 @@ _nib_offl_entry_t *_nib_offl_alloc(const ipv6_addr_t *next_hop, unsigned iface,
         dst->next_hop->mode |= _DST;
         ipv6_addr_init_prefix(&dst->pfx, pfx, pfx_len);
         dst->pfx_len = pfx_len;
+        _offl_rehash(dst);
     }
     return dst;
 }
@@ -566,6 +787,7 @@ void _nib_offl_clear(_nib_offl_entry_t *dst)
                 _nib_onl_clear(dst->next_hop);
             }
         }
+        _offl_unhash(dst);
         memset(dst, 0, sizeof(_nib_offl_entry_t));
     }
     else {
@@ -594,8 +816,74 @@ bool _nib_offl_is_entry(const _nib_offl_entry_t *entry)
     return (entry >= _dsts) && _in_dsts(entry);
 }
 
+#if CONFIG_GNRC_IPV6_NIB_HASH_NUMOF
+/* looks up the bucket of dst for every prefix length in use, longest first */
+static _nib_offl_entry_t *_offl_hash_lpm(const ipv6_addr_t *dst)
+{
+    for (unsigned i = ARRAY_SIZE(_offl_lens); i > 0; i--) {
+        unsigned lens = _offl_lens[i - 1];
+
+        while (lens) {
+            unsigned bit = bitarithm_msb(lens);
+            unsigned pfx_len = ((i - 1) * _LENS_BITS) + bit;
+            _nib_offl_entry_t *res = NULL;
+
+            lens &= ~(1U << bit);
+            for (unsigned j = _offl_head[_hash(dst, pfx_len)]; j != _HASH_NIL;
+                 j = _offl_next[j]) {
+                _nib_offl_entry_t *entry = &_dsts[j];
+
+                /* take the first entry in _dsts on equal prefixes */
+                if (((res == NULL) || (entry < res)) &&
+                    (entry->mode != _EMPTY) && (entry->pfx_len == pfx_len) &&
+                    (ipv6_addr_match_prefix(&entry->pfx, dst) >= pfx_len)) {
+                    res = entry;
+                }
+            }
+            if (res != NULL) {
+                return res;
+            }
+        }
+    }
+    return NULL;
+}
+#endif  /* CONFIG_GNRC_IPV6_NIB_HASH_NUMOF */
+
+_nib_offl_entry_t *_nib_offl_get_lpm(const ipv6_addr_t *dst)
+{
+#if CONFIG_GNRC_IPV6_NIB_HASH_NUMOF
+    return _offl_hash_lpm(dst);
+#else   /* CONFIG_GNRC_IPV6_NIB_HASH_NUMOF */
+    _nib_offl_entry_t *match = NULL;
+
+    for (_nib_offl_entry_t *entry = _dsts; _in_dsts(entry); entry++) {
+        if ((entry->mode != _EMPTY) &&
+            (ipv6_addr_match_prefix(dst, &entry->pfx) >= entry->pfx_len) &&
+            ((match == NULL) || (entry->pfx_len > match->pfx_len))) {
+            match = entry;
+        }
+    }
+    return match;
+#endif  /* CONFIG_GNRC_IPV6_NIB_HASH_NUMOF */
+}
+
+/*
+ * Without the hash index, the entry whose prefix shares the most bits with
+ * dst wins and ties go to the first entry in _dsts. As prefixes are stored
+ * with their host bits cleared, a shorter prefix can share as many bits as
+ * a longer one, e.g. 2001:db8::/32 and 2001:db8::/64 for 2001:db8::1.
+ * With the hash index, the entry with the longest matching prefix wins, so
+ * the /64 is taken in this example regardless of its position in _dsts.
+ * A longer matching prefix never shares fewer bits with dst, so both only
+ * differ on such ties.
+ */
 static _nib_offl_entry_t *_nib_offl_get_match(const ipv6_addr_t *dst)
 {
+#if CONFIG_GNRC_IPV6_NIB_HASH_NUMOF
+    DEBUG("nib: get match for destination %s from NIB index\n",
+          ipv6_addr_to_str(addr_str, dst, sizeof(addr_str)));
+    return _offl_hash_lpm(dst);
+#else   /* CONFIG_GNRC_IPV6_NIB_HASH_NUMOF */
     _nib_offl_entry_t *res = NULL;
     uint8_t best_match = 0;
 
@@ -621,6 +909,7 @@ static _nib_offl_entry_t *_nib_offl_get_match(const ipv6_addr_t *dst)
         }
     }
     return res;
+#endif  /* CONFIG_GNRC_IPV6_NIB_HASH_NUMOF */
 }
 
 void _nib_ft_get(const _nib_offl_entry_t *dst, gnrc_ipv6_nib_ft_t *fte)
@@ -883,6 +1172,7 @@ static void _override_node(const ipv6_addr_t *addr, unsigned iface,
         memcpy(&node->ipv6, addr, sizeof(node->ipv6));
     }
     _nib_onl_set_if(node, iface);
+    _onl_rehash(node);
 }
 
 static inline bool _node_unreachable(_nib_onl_entry_t *node)
@@ -613,6 +613,21 @@ _nib_offl_entry_t *_nib_offl_iter(const _nib_offl_entry_t *last);
  */
 bool _nib_offl_is_entry(const _nib_offl_entry_t *entry);
 
+/**
+ * @brief   Gets the off-link entry with the longest prefix matching an address
+ *
+ * @note    With @ref CONFIG_GNRC_IPV6_NIB_HASH_NUMOF > 0 this looks up the
+ *          hash index once per prefix length in use instead of comparing
+ *          against every entry.
+ *
+ * @param[in] dst   An IPv6 address.
+ *
+ * @return  The entry with the longest prefix matching @p dst. If multiple
+ *          entries have that prefix, the first one is returned.
+ * @return  NULL, if no entry matches @p dst.
+ */
+_nib_offl_entry_t *_nib_offl_get_lpm(const ipv6_addr_t *dst);
+
 /**
  * @brief   Helper function for view-level add-functions below
  *
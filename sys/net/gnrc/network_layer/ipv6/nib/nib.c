@@ -256,20 +256,13 @@ void gnrc_ipv6_nib_init_iface(gnrc_netif_t *netif)
 
 static bool _on_link(const ipv6_addr_t *dst, unsigned *iface)
 {
-    _nib_offl_entry_t *entry = NULL;
-    _nib_offl_entry_t *match = NULL;
+    _nib_offl_entry_t *match;
 
     if (ipv6_addr_is_link_local(dst)) {
         return true;
     }
 
-    while ((entry = _nib_offl_iter(entry))) {
-        if ((ipv6_addr_match_prefix(dst, &entry->pfx) >= entry->pfx_len) &&
-            ((match == NULL) || (entry->pfx_len > match->pfx_len))) {
-            match = entry;
-        }
-    }
-
+    match = _nib_offl_get_lpm(dst);
     if (match) {
         *iface = _nib_onl_get_if(match->next_hop);
         /* check if prefix is on-link */
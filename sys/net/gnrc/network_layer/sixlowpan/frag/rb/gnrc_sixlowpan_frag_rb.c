@@ -23,6 +23,7 @@
 #include "net/gnrc.h"
 #include "net/gnrc/sixlowpan.h"
 #include "net/gnrc/sixlowpan/config.h"
+#include "net/gnrc/sixlowpan/frag/internal.h"
 #ifdef  MODULE_GNRC_SIXLOWPAN_FRAG_STATS
 #include "net/gnrc/sixlowpan/frag/stats.h"
 #endif  /* MODULE_GNRC_SIXLOWPAN_FRAG_STATS */
@@ -68,6 +69,20 @@ static char l2addr_str[3 * IEEE802154_LONG_ADDRESS_LEN];
 static xtimer_t _gc_timer;
 static msg_t _gc_timer_msg = { .type = GNRC_SIXLOWPAN_FRAG_RB_GC_MSG };
 
+#if CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_HASH_SIZE
+static_assert(CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_SIZE < UINT8_MAX,
+              "reassembly buffer too large for hash index");
+
+/* Hash index over (src, tag). Heads and links hold the entry index + 1,
+ * so 0 ends a chain. An entry is chained in when it is created; removed
+ * entries stay in their chain until they are reused, so every entry found
+ * needs to be compared against the key. */
+static uint8_t _rbuf_head[CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_HASH_SIZE];
+static uint8_t _rbuf_next[CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_SIZE];
+/* bucket + 1 the entry is chained into, 0 if none */
+static uint16_t _rbuf_bucket[CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_SIZE];
+#endif  /* CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_HASH_SIZE */
+
 /* ------------------------------------
  * internal function definitions
  * ------------------------------------*/
@@ -84,6 +99,10 @@ static int _rbuf_get(const void *src, size_t src_len,
                      const void *dst, size_t dst_len,
                      size_t size, uint16_t tag,
                      unsigned page);
+/* finds an entry by its tuple, any datagram size matches if size is NULL */
+static gnrc_sixlowpan_frag_rb_t *_rbuf_find(const void *src, size_t src_len,
+                                            const void *dst, size_t dst_len,
+                                            const size_t *size, uint16_t tag);
 /* gets an entry only by link-layer information and tag */
 static gnrc_sixlowpan_frag_rb_t *_rbuf_get_by_tag(const gnrc_netif_hdr_t *netif_hdr,
                                                   uint16_t tag);
@@ -184,23 +203,10 @@ static gnrc_sixlowpan_frag_rb_t *_rbuf_get_by_tag(const gnrc_netif_hdr_t *netif_
                                                   uint16_t tag)
 {
     assert(netif_hdr != NULL);
-    const uint8_t *src = gnrc_netif_hdr_get_src_addr(netif_hdr);
-    const uint8_t *dst = gnrc_netif_hdr_get_dst_addr(netif_hdr);
-    const uint8_t src_len = netif_hdr->src_l2addr_len;
-    const uint8_t dst_len = netif_hdr->dst_l2addr_len;
-
-    for (unsigned i = 0; i < CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_SIZE; i++) {
-        gnrc_sixlowpan_frag_rb_t *e = &rbuf[i];
-
-        if ((e->pkt != NULL) && (e->super.tag == tag) &&
-            (e->super.src_len == src_len) &&
-            (e->super.dst_len == dst_len) &&
-            (memcmp(e->super.src, src, src_len) == 0) &&
-            (memcmp(e->super.dst, dst, dst_len) == 0)) {
-            return e;
-        }
-    }
-    return NULL;
+    return _rbuf_find(gnrc_netif_hdr_get_src_addr(netif_hdr),
+                      netif_hdr->src_l2addr_len,
+                      gnrc_netif_hdr_get_dst_addr(netif_hdr),
+                      netif_hdr->dst_l2addr_len, NULL, tag);
 }
 
 #ifndef NDEBUG
@@ -612,49 +618,116 @@ static inline void _set_rbuf_timeout(void)
                    &_gc_timer_msg, thread_getpid());
 }
 
+static inline bool _rbuf_match(const gnrc_sixlowpan_frag_rb_t *e,
+                               const void *src, size_t src_len,
+                               const void *dst, size_t dst_len,
+                               const size_t *size, uint16_t tag)
+{
+    return (e->pkt != NULL) && (e->super.tag == tag) &&
+           ((size == NULL) ||
+            /* not all SFR fragments carry the datagram size, so make 0 a
+             * legal value to not compare datagram size */
+            (IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_SFR) && (*size == 0)) ||
+            (e->super.datagram_size == *size)) &&
+           (e->super.src_len == src_len) &&
+           (e->super.dst_len == dst_len) &&
+           (memcmp(e->super.src, src, src_len) == 0) &&
+           (memcmp(e->super.dst, dst, dst_len) == 0);
+}
+
+#if CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_HASH_SIZE
+static inline unsigned _rbuf_hash(const uint8_t *src, size_t src_len,
+                                  uint16_t tag)
+{
+    return gnrc_sixlowpan_frag_hash(src, src_len, tag,
+                                    CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_HASH_SIZE);
+}
+
+static void _rbuf_rehash(const gnrc_sixlowpan_frag_rb_t *e)
+{
+    unsigned idx = e - rbuf;
+    unsigned bucket = _rbuf_hash(e->super.src, e->super.src_len, e->super.tag);
+
+    if (_rbuf_bucket[idx] != 0) {
+        uint8_t *ptr = &_rbuf_head[_rbuf_bucket[idx] - 1];
+
+        while (*ptr != (idx + 1)) {
+            ptr = &_rbuf_next[*ptr - 1];
+        }
+        *ptr = _rbuf_next[idx];
+    }
+    _rbuf_bucket[idx] = bucket + 1;
+    _rbuf_next[idx] = _rbuf_head[bucket];
+    _rbuf_head[bucket] = idx + 1;
+}
+#else   /* CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_HASH_SIZE */
+static inline void _rbuf_rehash(const gnrc_sixlowpan_frag_rb_t *e)
+{
+    (void)e;
+}
+#endif  /* CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_HASH_SIZE */
+
+static gnrc_sixlowpan_frag_rb_t *_rbuf_find(const void *src, size_t src_len,
+                                            const void *dst, size_t dst_len,
+                                            const size_t *size, uint16_t tag)
+{
+#if CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_HASH_SIZE
+    gnrc_sixlowpan_frag_rb_t *res = NULL;
+
+    /* the same tuple may be in the buffer with different datagram sizes, so
+     * return the same entry as a linear search would */
+    for (unsigned i = _rbuf_head[_rbuf_hash(src, src_len, tag)]; i != 0;
+         i = _rbuf_next[i - 1]) {
+        gnrc_sixlowpan_frag_rb_t *e = &rbuf[i - 1];
+
+        if (((res == NULL) || (e < res)) &&
+            _rbuf_match(e, src, src_len, dst, dst_len, size, tag)) {
+            res = e;
+        }
+    }
+    return res;
+#else   /* CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_HASH_SIZE */
+    for (unsigned i = 0; i < CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_SIZE; i++) {
+        if (_rbuf_match(&rbuf[i], src, src_len, dst, dst_len, size, tag)) {
+            return &rbuf[i];
+        }
+    }
+    return NULL;
+#endif  /* CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_HASH_SIZE */
+}
+
 static int _rbuf_get(const void *src, size_t src_len,
                      const void *dst, size_t dst_len,
                      size_t size, uint16_t tag,
                      unsigned page)
 {
-    gnrc_sixlowpan_frag_rb_t *res = NULL, *oldest = NULL;
+    gnrc_sixlowpan_frag_rb_t *res, *oldest = NULL;
     uint32_t now_usec = xtimer_now_usec();
 
-    for (unsigned int i = 0; i < CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_SIZE; i++) {
-        /* check first if entry already available */
-        if ((rbuf[i].pkt != NULL) && (rbuf[i].super.tag == tag) &&
-            ((IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_SFR) &&
-              /* not all SFR fragments carry the datagram size, so make 0 a
-               * legal value to not compare datagram size */
-              ((size == 0) || (rbuf[i].super.datagram_size == size))) ||
-             (!IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_SFR) &&
-              (rbuf[i].super.datagram_size == size))) &&
-            (rbuf[i].super.src_len == src_len) &&
-            (rbuf[i].super.dst_len == dst_len) &&
-            (memcmp(rbuf[i].super.src, src, src_len) == 0) &&
-            (memcmp(rbuf[i].super.dst, dst, dst_len) == 0)) {
-            DEBUG("6lo rfrag: entry %p (%s, ", (void *)(&rbuf[i]),
-                  gnrc_netif_addr_to_str(rbuf[i].super.src,
-                                         rbuf[i].super.src_len,
-                                         l2addr_str));
-            DEBUG("%s, %u, %u) found\n",
-                  gnrc_netif_addr_to_str(rbuf[i].super.dst,
-                                         rbuf[i].super.dst_len,
-                                         l2addr_str),
-                  (unsigned)rbuf[i].super.datagram_size, rbuf[i].super.tag);
+    /* check first if entry already available */
+    res = _rbuf_find(src, src_len, dst, dst_len, &size, tag);
+    if (res != NULL) {
+        DEBUG("6lo rfrag: entry %p (%s, ", (void *)res,
+              gnrc_netif_addr_to_str(res->super.src, res->super.src_len,
+                                     l2addr_str));
+        DEBUG("%s, %u, %u) found\n",
+              gnrc_netif_addr_to_str(res->super.dst, res->super.dst_len,
+                                     l2addr_str),
+              (unsigned)res->super.datagram_size, res->super.tag);
 #if CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_DEL_TIMER > 0
-            if (rbuf[i].super.current_size == 0) {
-                /* ensure that only empty reassembly buffer entries and entries
-                 * scheduled for deletion have `current_size == 0` */
-                DEBUG("6lo rfrag: scheduled for deletion, don't add fragment\n");
-                return -1;
-            }
-#endif
-            rbuf[i].super.arrival = now_usec;
-            _set_rbuf_timeout();
-            return i;
+        if (res->super.current_size == 0) {
+            /* ensure that only empty reassembly buffer entries and entries
+             * scheduled for deletion have `current_size == 0` */
+            DEBUG("6lo rfrag: scheduled for deletion, don't add fragment\n");
+            return -1;
         }
+#endif
+        res->super.arrival = now_usec;
+        _set_rbuf_timeout();
+        return res - &(rbuf[0]);
+    }
 
+    for (unsigned int i = 0; i < CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_SIZE; i++) {
         /* if there is a free spot: remember it */
         if ((res == NULL) && gnrc_sixlowpan_frag_rb_entry_empty(&rbuf[i])) {
             res = &(rbuf[i]);
@@ -746,6 +819,7 @@ static int _rbuf_get(const void *src, size_t src_len,
     res->offset_diff = 0U;
     memset(res->received, 0U, sizeof(res->received));
 #endif  /* IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_SFR) */
+    _rbuf_rehash(res);
 
     DEBUG("6lo rfrag: entry %p (%s, ", (void *)res,
           gnrc_netif_addr_to_str(res->super.src, res->super.src_len,
@@ -772,6 +846,10 @@ void gnrc_sixlowpan_frag_rb_reset(void)
         }
     }
     memset(rbuf, 0, sizeof(rbuf));
+#if CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_HASH_SIZE
+    memset(_rbuf_head, 0, sizeof(_rbuf_head));
+    memset(_rbuf_bucket, 0, sizeof(_rbuf_bucket));
+#endif  /* CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_HASH_SIZE */
 }
 
 const gnrc_sixlowpan_frag_rb_t *gnrc_sixlowpan_frag_rb_array(void)
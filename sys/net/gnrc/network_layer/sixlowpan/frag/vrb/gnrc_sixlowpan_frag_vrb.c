@@ -22,6 +22,7 @@
 #include "xtimer.h"
 
 #include "net/gnrc/sixlowpan/frag/fb.h"
+#include "net/gnrc/sixlowpan/frag/internal.h"
 #ifdef  MODULE_GNRC_SIXLOWPAN_FRAG_STATS
 #include "net/gnrc/sixlowpan/frag/stats.h"
 #endif  /* MODULE_GNRC_SIXLOWPAN_FRAG_STATS */
@@ -37,6 +38,20 @@ static char addr_str[IPV6_ADDR_MAX_STR_LEN];
 static char addr_str[3 * IEEE802154_LONG_ADDRESS_LEN];
 #endif  /* MODULE_GNRC_IPV6_NIB */
 
+#if CONFIG_GNRC_SIXLOWPAN_FRAG_VRB_HASH_SIZE
+static_assert(CONFIG_GNRC_SIXLOWPAN_FRAG_VRB_SIZE < UINT8_MAX,
+              "VRB too large for hash index");
+
+/* Hash index over (src, tag). Heads and links hold the entry index + 1, so 0
+ * ends a chain. An entry is chained in when it is created; removed entries
+ * stay in their chain until they are reused, so every entry found needs to be
+ * compared against the key. */
+static uint8_t _vrb_head[CONFIG_GNRC_SIXLOWPAN_FRAG_VRB_HASH_SIZE];
+static uint8_t _vrb_next[CONFIG_GNRC_SIXLOWPAN_FRAG_VRB_SIZE];
+/* bucket + 1 the entry is chained into, 0 if none */
+static uint16_t _vrb_bucket[CONFIG_GNRC_SIXLOWPAN_FRAG_VRB_SIZE];
+#endif  /* CONFIG_GNRC_SIXLOWPAN_FRAG_VRB_HASH_SIZE */
+
 static inline bool _equal_index(const gnrc_sixlowpan_frag_vrb_t *vrbe,
                                 const uint8_t *src, size_t src_len,
                                 unsigned tag)
@@ -46,22 +61,82 @@ static inline bool _equal_index(const gnrc_sixlowpan_frag_vrb_t *vrbe,
             (memcmp(vrbe->super.src, src, src_len) == 0));
 }
 
+#if CONFIG_GNRC_SIXLOWPAN_FRAG_VRB_HASH_SIZE
+static inline unsigned _hash(const uint8_t *src, size_t src_len, unsigned tag)
+{
+    return gnrc_sixlowpan_frag_hash(src, src_len, tag,
+                                    CONFIG_GNRC_SIXLOWPAN_FRAG_VRB_HASH_SIZE);
+}
+
+static void _rehash(const gnrc_sixlowpan_frag_vrb_t *vrbe)
+{
+    unsigned idx = vrbe - _vrb;
+    unsigned bucket = _hash(vrbe->super.src, vrbe->super.src_len,
+                            vrbe->super.tag);
+
+    if (_vrb_bucket[idx] != 0) {
+        uint8_t *ptr = &_vrb_head[_vrb_bucket[idx] - 1];
+
+        while (*ptr != (idx + 1)) {
+            ptr = &_vrb_next[*ptr - 1];
+        }
+        *ptr = _vrb_next[idx];
+    }
+    _vrb_bucket[idx] = bucket + 1;
+    _vrb_next[idx] = _vrb_head[bucket];
+    _vrb_head[bucket] = idx + 1;
+}
+#else   /* CONFIG_GNRC_SIXLOWPAN_FRAG_VRB_HASH_SIZE */
+static inline void _rehash(const gnrc_sixlowpan_frag_vrb_t *vrbe)
+{
+    (void)vrbe;
+}
+#endif  /* CONFIG_GNRC_SIXLOWPAN_FRAG_VRB_HASH_SIZE */
+
+/* returns the first entry with the given index, NULL if none */
+static gnrc_sixlowpan_frag_vrb_t *_find(const uint8_t *src, size_t src_len,
+                                        unsigned tag)
+{
+#if CONFIG_GNRC_SIXLOWPAN_FRAG_VRB_HASH_SIZE
+    gnrc_sixlowpan_frag_vrb_t *res = NULL;
+
+    for (unsigned i = _vrb_head[_hash(src, src_len, tag)]; i != 0;
+         i = _vrb_next[i - 1]) {
+        gnrc_sixlowpan_frag_vrb_t *vrbe = &_vrb[i - 1];
+
+        if (((res == NULL) || (vrbe < res)) &&
+            _equal_index(vrbe, src, src_len, tag)) {
+            res = vrbe;
+        }
+    }
+    return res;
+#else   /* CONFIG_GNRC_SIXLOWPAN_FRAG_VRB_HASH_SIZE */
+    for (unsigned i = 0; i < CONFIG_GNRC_SIXLOWPAN_FRAG_VRB_SIZE; i++) {
+        if (_equal_index(&_vrb[i], src, src_len, tag)) {
+            return &_vrb[i];
+        }
+    }
+    return NULL;
+#endif  /* CONFIG_GNRC_SIXLOWPAN_FRAG_VRB_HASH_SIZE */
+}
+
 gnrc_sixlowpan_frag_vrb_t *gnrc_sixlowpan_frag_vrb_add(
         const gnrc_sixlowpan_frag_rb_base_t *base,
         gnrc_netif_t *out_netif, const uint8_t *out_dst, size_t out_dst_len)
 {
-    gnrc_sixlowpan_frag_vrb_t *vrbe = NULL;
+    gnrc_sixlowpan_frag_vrb_t *vrbe = NULL, *found;
 
     assert(base != NULL);
     assert(base->src_len != 0);
     assert(out_netif != NULL);
     assert(out_dst != NULL);
     assert(out_dst_len > 0);
+    found = _find(base->src, base->src_len, base->tag);
+    /* an empty entry before the one found is taken as well */
     for (unsigned i = 0; i < CONFIG_GNRC_SIXLOWPAN_FRAG_VRB_SIZE; i++) {
         gnrc_sixlowpan_frag_vrb_t *ptr = &_vrb[i];
 
-        if (gnrc_sixlowpan_frag_vrb_entry_empty(ptr) ||
-            _equal_index(ptr, base->src, base->src_len, base->tag)) {
+        if (gnrc_sixlowpan_frag_vrb_entry_empty(ptr) || (ptr == found)) {
             vrbe = ptr;
             if (gnrc_sixlowpan_frag_vrb_entry_empty(vrbe)) {
                 vrbe->super = *base;
@@ -69,6 +144,7 @@ gnrc_sixlowpan_frag_vrb_t *gnrc_sixlowpan_frag_vrb_add(
                 memcpy(vrbe->super.dst, out_dst, out_dst_len);
                 vrbe->out_tag = gnrc_sixlowpan_frag_fb_next_tag();
                 vrbe->super.dst_len = out_dst_len;
+                _rehash(vrbe);
                 DEBUG("6lo vrb: creating entry (%s, ",
                       gnrc_netif_addr_to_str(vrbe->super.src,
                                              vrbe->super.src_len,
@@ -170,16 +246,14 @@ gnrc_sixlowpan_frag_vrb_t *gnrc_sixlowpan_frag_vrb_get(
     DEBUG("6lo vrb: trying to get entry for (%s, %u)\n",
           gnrc_netif_addr_to_str(src, src_len, addr_str), src_tag);
     assert(src_len != 0);
-    for (unsigned i = 0; i < CONFIG_GNRC_SIXLOWPAN_FRAG_VRB_SIZE; i++) {
-        gnrc_sixlowpan_frag_vrb_t *vrbe = &_vrb[i];
+    gnrc_sixlowpan_frag_vrb_t *vrbe = _find(src, src_len, src_tag);
 
-        if (_equal_index(vrbe, src, src_len, src_tag)) {
-            DEBUG("6lo vrb: got VRB to (%s, %u)\n",
-                  gnrc_netif_addr_to_str(vrbe->super.dst,
-                                         vrbe->super.dst_len,
-                                         addr_str), vrbe->out_tag);
-            return vrbe;
-        }
+    if (vrbe != NULL) {
+        DEBUG("6lo vrb: got VRB to (%s, %u)\n",
+              gnrc_netif_addr_to_str(vrbe->super.dst,
+                                     vrbe->super.dst_len,
+                                     addr_str), vrbe->out_tag);
+        return vrbe;
     }
     DEBUG("6lo vrb: no entry found\n");
     return NULL;
@@ -234,6 +308,10 @@ void gnrc_sixlowpan_frag_vrb_gc(void)
 void gnrc_sixlowpan_frag_vrb_reset(void)
 {
     memset(_vrb, 0, sizeof(_vrb));
+#if CONFIG_GNRC_SIXLOWPAN_FRAG_VRB_HASH_SIZE
+    memset(_vrb_head, 0, sizeof(_vrb_head));
+    memset(_vrb_bucket, 0, sizeof(_vrb_bucket));
+#endif  /* CONFIG_GNRC_SIXLOWPAN_FRAG_VRB_HASH_SIZE */
 }
 #endif
 
@@ -17,6 +17,8 @@
  */
 
 #include <stdbool.h>
+#include <stddef.h>
+#include <string.h>
 
 #include "byteorder.h"
 #include "net/ipv6/hdr.h"
@@ -1614,6 +1616,191 @@ static inline bool _compressible(gnrc_pktsnip_t *hdr)
     }
 }
 
+#if IS_USED(MODULE_GNRC_SIXLOWPAN_IPHC_CACHE)
+/* dispatch, CID extension, traffic class and flow label, next header, hop
+ * limit, and both addresses carried inline */
+#define IPHC_CACHE_HDR_MAX_LEN      (SIXLOWPAN_IPHC_HDR_LEN + \
+                                     SIXLOWPAN_IPHC_CID_EXT_LEN + 4U + 1U + 1U + \
+                                     (2U * sizeof(ipv6_addr_t)))
+
+typedef struct {
+    ipv6_hdr_t ipv6;            /* IPv6 header of the flow, len is ignored */
+    const gnrc_netif_t *iface;  /* interface the flow is sent over */
+    uint32_t ctx_gen;           /* context generation at compression */
+    uint32_t last_used;         /* for LRU replacement */
+#if GNRC_NETIF_L2ADDR_MAXLEN > 0
+    uint8_t l2addr[GNRC_NETIF_L2ADDR_MAXLEN];   /* source of the interface IID */
+    uint8_t l2addr_len;
+#endif
+    uint8_t dst_l2addr[GNRC_NETIF_HDR_L2ADDR_MAX_LEN];
+    uint8_t dst_l2addr_len;
+    uint8_t iphc_len;           /* 0 if entry is unused */
+    uint8_t iphc[IPHC_CACHE_HDR_MAX_LEN];
+} _iphc_cache_t;
+
+static _iphc_cache_t _iphc_cache[CONFIG_GNRC_SIXLOWPAN_IPHC_CACHE_SIZE];
+static gnrc_sixlowpan_iphc_cache_stats_t _iphc_cache_stats;
+static uint32_t _iphc_cache_clock;
+
+static bool _iphc_cache_match(const _iphc_cache_t *entry,
+                              const ipv6_hdr_t *ipv6_hdr,
+                              const gnrc_netif_hdr_t *netif_hdr,
+                              gnrc_netif_t *iface)
+{
+    bool res;
+
+    if ((entry->iphc_len == 0) || (entry->iface != iface) ||
+        (entry->dst_l2addr_len != netif_hdr->dst_l2addr_len) ||
+        (memcmp(&entry->ipv6.v_tc_fl, &ipv6_hdr->v_tc_fl,
+                sizeof(ipv6_hdr->v_tc_fl)) != 0) ||
+        (memcmp(&entry->ipv6.nh, &ipv6_hdr->nh,
+                sizeof(ipv6_hdr_t) - offsetof(ipv6_hdr_t, nh)) != 0) ||
+        (memcmp(entry->dst_l2addr, gnrc_netif_hdr_get_dst_addr(netif_hdr),
+                netif_hdr->dst_l2addr_len) != 0)) {
+        return false;
+    }
+#if GNRC_NETIF_L2ADDR_MAXLEN > 0
+    gnrc_netif_acquire(iface);
+    res = (entry->l2addr_len == iface->l2addr_len) &&
+          (memcmp(entry->l2addr, iface->l2addr, iface->l2addr_len) == 0);
+    gnrc_netif_release(iface);
+#else
+    res = true;
+#endif
+    return res;
+}
+
+static inline bool _iphc_cache_ctx_usable(uint8_t id)
+{
+    gnrc_sixlowpan_ctx_t *ctx = gnrc_sixlowpan_ctx_lookup_id(id);
+
+    return (ctx != NULL) && (ctx->flags_id & GNRC_SIXLOWPAN_CTX_FLAGS_COMP);
+}
+
+static bool _iphc_cache_valid(const _iphc_cache_t *entry)
+{
+    const uint8_t *iphc_hdr = entry->iphc;
+    uint8_t cid = 0;
+
+    if (iphc_hdr[IPHC2_IDX] & SIXLOWPAN_IPHC2_CID_EXT) {
+        cid = iphc_hdr[CID_EXT_IDX];
+    }
+    /* looking up the contexts the entry was compressed with refreshes their
+     * lifetime, so an expiry changes the generation compared below */
+    if (((iphc_hdr[IPHC2_IDX] & IPHC_SAC_SAM_CTX_L2) > IPHC_SAC_SAM_UNSPEC) &&
+        !_iphc_cache_ctx_usable(cid >> 4)) {
+        return false;
+    }
+    if ((iphc_hdr[IPHC2_IDX] & SIXLOWPAN_IPHC2_DAC) &&
+        !_iphc_cache_ctx_usable(cid & GNRC_SIXLOWPAN_CTX_FLAGS_CID_MASK)) {
+        return false;
+    }
+    return entry->ctx_gen == gnrc_sixlowpan_ctx_generation();
+}
+
+static void _iphc_cache_add(_iphc_cache_t *entry, const ipv6_hdr_t *ipv6_hdr,
+                            const gnrc_netif_hdr_t *netif_hdr,
+                            gnrc_netif_t *iface, uint32_t ctx_gen,
+                            const uint8_t *iphc_hdr, size_t iphc_len)
+{
+    if (entry == NULL) {
+        /* take a free entry or replace the least recently used one */
+        entry = &_iphc_cache[0];
+        for (unsigned i = 0; i < ARRAY_SIZE(_iphc_cache); i++) {
+            if (_iphc_cache[i].iphc_len == 0) {
+                entry = &_iphc_cache[i];
+                break;
+            }
+            if ((_iphc_cache_clock - _iphc_cache[i].last_used) >
+                (_iphc_cache_clock - entry->last_used)) {
+                entry = &_iphc_cache[i];
+            }
+        }
+        if (entry->iphc_len != 0) {
+            _iphc_cache_stats.evictions++;
+        }
+    }
+    entry->ipv6 = *ipv6_hdr;
+    entry->ipv6.len = byteorder_htons(0);
+    entry->iface = iface;
+    entry->ctx_gen = ctx_gen;
+    entry->last_used = _iphc_cache_clock;
+#if GNRC_NETIF_L2ADDR_MAXLEN > 0
+    gnrc_netif_acquire(iface);
+    memcpy(entry->l2addr, iface->l2addr, iface->l2addr_len);
+    entry->l2addr_len = iface->l2addr_len;
+    gnrc_netif_release(iface);
+#endif
+    memcpy(entry->dst_l2addr, gnrc_netif_hdr_get_dst_addr(netif_hdr),
+           netif_hdr->dst_l2addr_len);
+    entry->dst_l2addr_len = netif_hdr->dst_l2addr_len;
+    memcpy(entry->iphc, iphc_hdr, iphc_len);
+    entry->iphc_len = iphc_len;
+}
+
+static size_t _iphc_cache_encode(gnrc_pktsnip_t *pkt,
+                                 const gnrc_netif_hdr_t *netif_hdr,
+                                 gnrc_netif_t *iface,
+                                 uint8_t *iphc_hdr)
+{
+    _iphc_cache_t *stale = NULL;
+    const ipv6_hdr_t *ipv6_hdr;
+    uint32_t ctx_gen;
+    size_t inline_pos;
+
+    if ((pkt->next == NULL) ||
+        (netif_hdr->dst_l2addr_len > GNRC_NETIF_HDR_L2ADDR_MAX_LEN)) {
+        return _iphc_ipv6_encode(pkt, netif_hdr, iface, iphc_hdr);
+    }
+    ipv6_hdr = pkt->next->data;
+    _iphc_cache_clock++;
+    for (unsigned i = 0; i < ARRAY_SIZE(_iphc_cache); i++) {
+        _iphc_cache_t *entry = &_iphc_cache[i];
+
+        if (!_iphc_cache_match(entry, ipv6_hdr, netif_hdr, iface)) {
+            continue;
+        }
+        if (_iphc_cache_valid(entry)) {
+            DEBUG("6lo iphc: using cached header for flow %u\n", i);
+            entry->last_used = _iphc_cache_clock;
+            memcpy(iphc_hdr, entry->iphc, entry->iphc_len);
+            _iphc_cache_stats.hits++;
+            return entry->iphc_len;
+        }
+        DEBUG("6lo iphc: cached header for flow %u is stale\n", i);
+        _iphc_cache_stats.stale++;
+        stale = entry;
+        break;
+    }
+    _iphc_cache_stats.misses++;
+    /* read the generation before compressing, so a context change during
+     * compression leaves a stale entry instead of a wrong one */
+    ctx_gen = gnrc_sixlowpan_ctx_generation();
+    inline_pos = _iphc_ipv6_encode(pkt, netif_hdr, iface, iphc_hdr);
+    if ((inline_pos > 0) && (inline_pos <= IPHC_CACHE_HDR_MAX_LEN)) {
+        _iphc_cache_add(stale, ipv6_hdr, netif_hdr, iface, ctx_gen, iphc_hdr,
+                        inline_pos);
+    }
+    return inline_pos;
+}
+
+void gnrc_sixlowpan_iphc_cache_stats(gnrc_sixlowpan_iphc_cache_stats_t *stats,
+                                     bool reset)
+{
+    *stats = _iphc_cache_stats;
+    if (reset) {
+        memset(&_iphc_cache_stats, 0, sizeof(_iphc_cache_stats));
+    }
+}
+
+void gnrc_sixlowpan_iphc_cache_flush(void)
+{
+    for (unsigned i = 0; i < ARRAY_SIZE(_iphc_cache); i++) {
+        _iphc_cache[i].iphc_len = 0;
+    }
+}
+#endif  /* MODULE_GNRC_SIXLOWPAN_IPHC_CACHE */
+
 static gnrc_pktsnip_t *_iphc_encode(gnrc_pktsnip_t *pkt,
                                     const gnrc_netif_hdr_t *netif_hdr,
                                     gnrc_netif_t *iface)
@@ -1660,7 +1847,11 @@ static gnrc_pktsnip_t *_iphc_encode(gnrc_pktsnip_t *pkt,
     }
 
     iphc_hdr = dispatch->data;
+#if IS_USED(MODULE_GNRC_SIXLOWPAN_IPHC_CACHE)
+    inline_pos = _iphc_cache_encode(pkt, netif_hdr, iface, iphc_hdr);
+#else
     inline_pos = _iphc_ipv6_encode(pkt, netif_hdr, iface, iphc_hdr);
+#endif
 
     if (inline_pos == 0) {
         DEBUG("6lo iphc: error encoding IPv6 header\n");
@@ -24,6 +24,7 @@
 #include <string.h>
 #include <sys/types.h>
 
+#include "bitarithm.h"
 #include "mutex.h"
 #include "od.h"
 #include "utlist.h"
@@ -41,17 +42,54 @@
 static alignas(sizeof(_unused_t)) uint8_t _static_buf[CONFIG_GNRC_PKTBUF_SIZE];
 static_assert((CONFIG_GNRC_PKTBUF_SIZE % sizeof(_unused_t)) == 0,
               "CONFIG_GNRC_PKTBUF_SIZE has to be a multiple of 8");
+
+#if IS_USED(MODULE_GNRC_PKTBUF_STATIC_SIZECLASS)
+/* the buffer is managed in units of the size of _unused_t */
+#define UNIT            sizeof(_unused_t)
+#define UNITS_NUMOF     (CONFIG_GNRC_PKTBUF_SIZE / UNIT)
+#define NIL             UINT16_MAX
+/* every power of two of chunk sizes is split into SL_NUMOF size classes */
+#define SL_BITS         (2U)
+#define SL_NUMOF        (1U << SL_BITS)
+#define CLASSES_NUMOF   (64U)
+
+static_assert(UNITS_NUMOF < NIL,
+              "CONFIG_GNRC_PKTBUF_SIZE too large for gnrc_pktbuf_static_sizeclass");
+
+/**
+ * @brief   Header at the first unit of a free chunk
+ *
+ * @ref _free_t::size is repeated in the last unit of the chunk, so the
+ * chunk can be found from the chunk following it.
+ */
+typedef struct {
+    uint16_t next;      /**< first unit of next free chunk of same class */
+    uint16_t prev;      /**< first unit of previous free chunk of same class */
+    uint16_t size;      /**< size of the chunk in units */
+} _free_t;
+
+static_assert(sizeof(_free_t) <= UNIT, "_free_t has to fit into one unit");
+
+static uint16_t _class_head[CLASSES_NUMOF];
+static unsigned _class_map[CLASSES_NUMOF / (8 * sizeof(unsigned))];
+/* marks the first and the last unit of every free chunk */
+static uint32_t _edge_map[(UNITS_NUMOF + 31) / 32];
+#else
 static _unused_t *_first_unused;
+#endif
 
 #ifdef DEVELHELP
 /* maximum number of bytes allocated */
 static uint16_t max_byte_count = 0;
+/* number of allocations that could not be served */
+static unsigned alloc_fail_count = 0;
 #endif
 
 /* internal gnrc_pktbuf functions */
 static gnrc_pktsnip_t *_create_snip(gnrc_pktsnip_t *next, const void *data, size_t size,
                                     gnrc_nettype_t type);
 static void *_pktbuf_alloc(size_t size);
+static void _init_free(void);
 
 static inline void _set_pktsnip(gnrc_pktsnip_t *pkt, gnrc_pktsnip_t *next,
                                 void *data, size_t size, gnrc_nettype_t type)
@@ -66,17 +104,152 @@ static inline void _set_pktsnip(gnrc_pktsnip_t *pkt, gnrc_pktsnip_t *next,
 #endif
 }
 
+#if IS_USED(MODULE_GNRC_PKTBUF_STATIC_SIZECLASS)
+#define CLASS_MAP_BITS  (8 * sizeof(unsigned))
+
+static inline _free_t *_chunk(unsigned unit)
+{
+    /* _static_buf is aligned to UNIT, we cast to uintptr_t as intermediate
+     * step to silence -Wcast-align */
+    return (_free_t *)(uintptr_t)&_static_buf[unit * UNIT];
+}
+
+static inline unsigned _unit(const void *ptr)
+{
+    return ((const uint8_t *)ptr - _static_buf) / UNIT;
+}
+
+static inline bool _is_edge(unsigned unit)
+{
+    return _edge_map[unit / 32] & (1UL << (unit % 32));
+}
+
+static inline void _set_edges(unsigned first, unsigned last)
+{
+    _edge_map[first / 32] |= 1UL << (first % 32);
+    _edge_map[last / 32] |= 1UL << (last % 32);
+}
+
+static inline void _clear_edges(unsigned first, unsigned last)
+{
+    _edge_map[first / 32] &= ~(1UL << (first % 32));
+    _edge_map[last / 32] &= ~(1UL << (last % 32));
+}
+
+/* size class of a chunk of the given number of units */
+static unsigned _class(unsigned units)
+{
+    if (units < SL_NUMOF) {
+        return units;
+    }
+
+    unsigned fl = bitarithm_msb(units);
+
+    return ((fl - SL_BITS + 1) * SL_NUMOF) +
+           ((units >> (fl - SL_BITS)) & (SL_NUMOF - 1));
+}
+
+/* first non-empty size class starting from start */
+static unsigned _first_class(unsigned start)
+{
+    for (unsigned i = start / CLASS_MAP_BITS; i < ARRAY_SIZE(_class_map); i++) {
+        unsigned map = _class_map[i];
+
+        if (i == start / CLASS_MAP_BITS) {
+            map &= ~0U << (start % CLASS_MAP_BITS);
+        }
+        if (map) {
+            return (i * CLASS_MAP_BITS) + bitarithm_lsb(map);
+        }
+    }
+    return CLASSES_NUMOF;
+}
+
+static void _link(unsigned unit, unsigned units)
+{
+    _free_t *chunk = _chunk(unit);
+    unsigned class = _class(units);
+
+    chunk->next = _class_head[class];
+    chunk->prev = NIL;
+    chunk->size = units;
+    if (chunk->next != NIL) {
+        _chunk(chunk->next)->prev = unit;
+    }
+    _class_head[class] = unit;
+    _class_map[class / CLASS_MAP_BITS] |= 1U << (class % CLASS_MAP_BITS);
+
+    /* footer, coincides with the header for chunks of a single unit */
+    _chunk(unit + units - 1)->size = units;
+    _set_edges(unit, unit + units - 1);
+}
+
+static void _unlink(unsigned unit)
+{
+    _free_t *chunk = _chunk(unit);
+    unsigned last = unit + chunk->size - 1;
+    unsigned class = _class(chunk->size);
+
+    if (chunk->prev != NIL) {
+        _chunk(chunk->prev)->next = chunk->next;
+    }
+    else {
+        _class_head[class] = chunk->next;
+        if (chunk->next == NIL) {
+            _class_map[class / CLASS_MAP_BITS] &= ~(1U << (class % CLASS_MAP_BITS));
+        }
+    }
+    if (chunk->next != NIL) {
+        _chunk(chunk->next)->prev = chunk->prev;
+    }
+    _clear_edges(unit, last);
+
+    if (CONFIG_GNRC_PKTBUF_CHECK_USE_AFTER_FREE && (last != unit)) {
+        memset(&_chunk(last)->size, GNRC_PKTBUF_CANARY, sizeof(_chunk(last)->size));
+    }
+}
+
+/* first unit of a free chunk of at least the given number of units */
+static unsigned _find(unsigned units)
+{
+    unsigned class = _class(units);
+    unsigned unit;
+
+    if (units >= SL_NUMOF) {
+        unsigned step = 1U << (bitarithm_msb(units) - SL_BITS);
+
+        if (units & (step - 1)) {
+            /* the class of units may hold smaller chunks, only chunks
+             * in the classes above are guaranteed to fit */
+            unsigned next = _first_class(class + 1);
+
+            if (next < CLASSES_NUMOF) {
+                return _class_head[next];
+            }
+            /* fall back to the best fit in the class of units */
+            unsigned best = NIL;
+            for (unit = _class_head[class]; unit != NIL; unit = _chunk(unit)->next) {
+                if ((_chunk(unit)->size >= units) &&
+                    ((best == NIL) || (_chunk(unit)->size < _chunk(best)->size))) {
+                    best = unit;
+                }
+            }
+            return best;
+        }
+    }
+
+    class = _first_class(class);
+    return (class < CLASSES_NUMOF) ? _class_head[class] : NIL;
+}
+#endif
+
 void gnrc_pktbuf_init(void)
 {
     mutex_lock(&gnrc_pktbuf_mutex);
     if (CONFIG_GNRC_PKTBUF_CHECK_USE_AFTER_FREE) {
         memset(_static_buf, GNRC_PKTBUF_CANARY, sizeof(_static_buf));
     }
-    /* Silence false -Wcast-align: _static_buf has qualifier
-     * `alignas(_unused_t)`, so it is guaranteed to be safe */
-    _first_unused = (_unused_t *)(uintptr_t)_static_buf;
-    _first_unused->next = NULL;
-    _first_unused->size = sizeof(_static_buf);
+    _init_free();
     mutex_unlock(&gnrc_pktbuf_mutex);
 }
 
@@ -248,6 +421,13 @@ static inline void _print_chunk(void *chunk, size_t size, int num)
 #endif
 }
 
+#if IS_USED(MODULE_GNRC_PKTBUF_STATIC_SIZECLASS)
+static inline void _print_free(unsigned unit)
+{
+    printf("~ unused: %p (class: %2u, size: %4u) ~\n", (void *)_chunk(unit),
+           _class(_chunk(unit)->size), (unsigned)(_chunk(unit)->size * UNIT));
+}
+#else
 static inline void _print_ptr(_unused_t *ptr)
 {
     if (ptr == NULL) {
@@ -266,10 +446,38 @@ static inline void _print_unused(_unused_t *ptr)
     _print_ptr(ptr->next);
     printf(", size: %4u) ~\n", ptr->size);
 }
+#endif
+
+static void _print_usage(void)
+{
+    size_t free_bytes = 0, largest = 0;
+    unsigned count = 0;
+
+#if IS_USED(MODULE_GNRC_PKTBUF_STATIC_SIZECLASS)
+    for (unsigned class = 0; class < CLASSES_NUMOF; class++) {
+        for (unsigned unit = _class_head[class]; unit != NIL; unit = _chunk(unit)->next) {
+            size_t size = _chunk(unit)->size * UNIT;
+#else
+    for (_unused_t *ptr = _first_unused; ptr != NULL; ptr = ptr->next) {
+        {
+            size_t size = ptr->size;
+#endif
+            free_bytes += size;
+            largest = (size > largest) ? size : largest;
+            count++;
+        }
+    }
+
+    printf("  free: %" PRIuSIZE " bytes in %u chunks, largest chunk: %" PRIuSIZE
+           " bytes\n", free_bytes, count, largest);
+    /* share of the free bytes that can not be allocated in one piece */
+    printf("  fragmentation: %u%%, failed allocations: %u\n",
+           free_bytes ? (unsigned)(100 - ((largest * 100) / free_bytes)) : 0,
+           alloc_fail_count);
+}
 
 void gnrc_pktbuf_stats(void)
 {
-    _unused_t *ptr = _first_unused;
     uint8_t *chunk = &_static_buf[0];
     int count = 0;
 
@@ -278,6 +486,27 @@ void gnrc_pktbuf_stats(void)
            (void *)&_static_buf[CONFIG_GNRC_PKTBUF_SIZE],
            CONFIG_GNRC_PKTBUF_SIZE);
     printf("  position of last byte used: %" PRIu16 "\n", max_byte_count);
+    _print_usage();
+
+#if IS_USED(MODULE_GNRC_PKTBUF_STATIC_SIZECLASS)
+    unsigned unit = 0;
+
+    while (unit < UNITS_NUMOF) {
+        if (!_is_edge(unit)) {
+            unit++;
+            continue;
+        }
+        /* unit is the first unit of a free chunk */
+        if (_chunk(unit) != (void *)chunk) {
+            _print_chunk(chunk, (uint8_t *)_chunk(unit) - chunk, count++);
+        }
+        _print_free(unit);
+        unit += _chunk(unit)->size;
+        chunk = &_static_buf[unit * UNIT];
+    }
+#else
+    _unused_t *ptr = _first_unused;
+
     if (ptr == NULL) {  /* packet buffer is completely full */
         _print_chunk(chunk, CONFIG_GNRC_PKTBUF_SIZE, count++);
     }
@@ -300,6 +529,7 @@ void gnrc_pktbuf_stats(void)
         _print_unused(ptr);
         ptr = ptr->next;
     }
+#endif
 
     if (chunk <= &_static_buf[CONFIG_GNRC_PKTBUF_SIZE - 1]) {
         _print_chunk(chunk, &_static_buf[CONFIG_GNRC_PKTBUF_SIZE] - chunk, count);
@@ -310,10 +540,55 @@ void gnrc_pktbuf_stats(void)
 #ifdef TEST_SUITES
 bool gnrc_pktbuf_is_empty(void)
 {
+#if IS_USED(MODULE_GNRC_PKTBUF_STATIC_SIZECLASS)
+    return _is_edge(0) && (_chunk(0)->size == UNITS_NUMOF);
+#else
     return ((uintptr_t)_first_unused == (uintptr_t)_static_buf) &&
            (_first_unused->size == sizeof(_static_buf));
+#endif
 }
 
+#if IS_USED(MODULE_GNRC_PKTBUF_STATIC_SIZECLASS)
+bool gnrc_pktbuf_is_sane(void)
+{
+    unsigned edges = 0;
+
+    /* Invariants of this implementation:
+     *  - every free chunk is in the list of its size class and the bit of
+     *    the class is set iff the list is not empty
+     *  - the first and the last unit of every free chunk, and only those,
+     *    are marked in _edge_map and the last unit repeats the size
+     *  - no two free chunks are adjacent
+     */
+    for (unsigned class = 0; class < CLASSES_NUMOF; class++) {
+        unsigned prev = NIL;
+        bool used = _class_map[class / CLASS_MAP_BITS] & (1U << (class % CLASS_MAP_BITS));
+
+        if (used != (_class_head[class] != NIL)) {
+            return false;
+        }
+        for (unsigned unit = _class_head[class]; unit != NIL; unit = _chunk(unit)->next) {
+            _free_t *chunk = _chunk(unit);
+            unsigned last = unit + chunk->size - 1;
+
+            if ((chunk->size == 0) || (unit + chunk->size > UNITS_NUMOF) ||
+                (_class(chunk->size) != class) || (chunk->prev != prev) ||
+                !_is_edge(unit) || !_is_edge(last) ||
+                (_chunk(last)->size != chunk->size) ||
+                ((last + 1 < UNITS_NUMOF) && _is_edge(last + 1))) {
+                return false;
+            }
+            edges += (last == unit) ? 1 : 2;
+            prev = unit;
+        }
+    }
+    for (unsigned i = 0; i < ARRAY_SIZE(_edge_map); i++) {
+        edges -= bitarithm_bits_set_u32(_edge_map[i]);
+    }
+
+    return edges == 0;
+}
+#else
 bool gnrc_pktbuf_is_sane(void)
 {
     _unused_t *ptr = _first_unused;
@@ -348,6 +623,7 @@ bool gnrc_pktbuf_is_sane(void)
     return true;
 }
 #endif
+#endif
 
 static gnrc_pktsnip_t *_create_snip(gnrc_pktsnip_t *next, const void *data, size_t size,
                                     gnrc_nettype_t type)
@@ -374,17 +650,52 @@ static gnrc_pktsnip_t *_create_snip(gnrc_pktsnip_t *next, const void *data, size
     return pkt;
 }
 
-static void *_pktbuf_alloc(size_t size)
+static void _init_free(void)
+{
+#if IS_USED(MODULE_GNRC_PKTBUF_STATIC_SIZECLASS)
+    memset(_class_head, 0xff, sizeof(_class_head));
+    memset(_class_map, 0, sizeof(_class_map));
+    memset(_edge_map, 0, sizeof(_edge_map));
+    _link(0, UNITS_NUMOF);
+#else
+    /* Silence false -Wcast-align: _static_buf has qualifier alignas(_unused_t),
+     * hence it is safe to access it as _unused_t. */
+    _first_unused = (_unused_t *)(uintptr_t)_static_buf;
+    _first_unused->next = NULL;
+    _first_unused->size = sizeof(_static_buf);
+#endif
+}
+
+#if IS_USED(MODULE_GNRC_PKTBUF_STATIC_SIZECLASS)
+static _unused_t *_alloc_chunk(size_t size)
+{
+    unsigned units = size / UNIT;
+    unsigned unit = _find(units);
+
+    if (unit == NIL) {
+        return NULL;
+    }
+
+    unsigned avail = _chunk(unit)->size;
+
+    _unlink(unit);
+    if (avail > units) {
+        /* put the remainder back */
+        _link(unit + units, avail - units);
+    }
+    /* We cast to uintptr_t as intermediate step to silence -Wcast-align */
+    return (_unused_t *)(uintptr_t)_chunk(unit);
+}
+#else
+static _unused_t *_alloc_chunk(size_t size)
 {
     _unused_t *prev = NULL, *ptr = _first_unused;
 
-    size = _align(size);
     while (ptr && (size > ptr->size)) {
         prev = ptr;
         ptr = ptr->next;
     }
     if (ptr == NULL) {
-        DEBUG("pktbuf: no space left in packet buffer\n");
         return NULL;
     }
     /* _unused_t struct would fit => add new space at ptr */
@@ -415,6 +726,23 @@ static void *_pktbuf_alloc(size_t size)
         new->next = ptr->next;
         new->size = ptr->size - size;
     }
+    return ptr;
+}
+#endif
+
+static void *_pktbuf_alloc(size_t size)
+{
+    _unused_t *ptr;
+
+    size = _align(size);
+    ptr = _alloc_chunk(size);
+    if (ptr == NULL) {
+        DEBUG("pktbuf: no space left in packet buffer\n");
+#ifdef DEVELHELP
+        alloc_fail_count++;
+#endif
+        return NULL;
+    }
 #ifdef DEVELHELP
     uint16_t last_byte = (uint16_t)((((uint8_t *)ptr) + size) - &(_static_buf[0]));
     if (last_byte > max_byte_count) {
@@ -441,6 +769,32 @@ static void *_pktbuf_alloc(size_t size)
     return (void *)ptr;
 }
 
+#if IS_USED(MODULE_GNRC_PKTBUF_STATIC_SIZECLASS)
+static void _free_chunk(void *data, size_t size)
+{
+    unsigned unit = _unit(data);
+    unsigned units = size / UNIT;
+
+    /* coalesce with the free chunks directly before and after */
+    if ((unit > 0) && _is_edge(unit - 1)) {
+        unsigned prev = unit - _chunk(unit - 1)->size;
+
+        units += _chunk(prev)->size;
+        _unlink(prev);
+        unit = prev;
+    }
+    if ((unit + units < UNITS_NUMOF) && _is_edge(unit + units)) {
+        unsigned next = unit + units;
+
+        units += _chunk(next)->size;
+        _unlink(next);
+        if (CONFIG_GNRC_PKTBUF_CHECK_USE_AFTER_FREE) {
+            memset(_chunk(next), GNRC_PKTBUF_CANARY, sizeof(_free_t));
+        }
+    }
+    _link(unit, units);
+}
+#else
 static inline bool _too_small_hole(_unused_t *a, _unused_t *b)
 {
     return sizeof(_unused_t) > (size_t)(((uint8_t *)b) - (((uint8_t *)a) + a->size));
@@ -458,38 +812,17 @@ static inline _unused_t *_merge(_unused_t *a, _unused_t *b)
     return a;
 }
 
-void gnrc_pktbuf_free_internal(void *data, size_t size)
+static void _free_chunk(void *data, size_t size)
 {
     size_t bytes_at_end;
     _unused_t *new = (_unused_t *)data, *prev = NULL, *ptr = _first_unused;
 
-    if (data == NULL) {
-        return;
-    }
-
-    if (!gnrc_pktbuf_contains(data)) {
-        assert(0);
-        return;
-    }
-
-    if (CONFIG_GNRC_PKTBUF_CHECK_USE_AFTER_FREE) {
-        /* check if the data has already been marked as free */
-        size_t chk_len = _align(size) - sizeof(*new);
-        if (chk_len &&
-            !memchk((uint8_t *)data + sizeof(*new), GNRC_PKTBUF_CANARY, chk_len)) {
-            printf("pktbuf: double free detected! (at %p, len=%u)\n",
-                   data, (unsigned)_align(size));
-            DEBUG_BREAKPOINT(2);
-        }
-        memset(data, GNRC_PKTBUF_CANARY, _align(size));
-    }
-
     while (ptr && (((void *)ptr) < data)) {
         prev = ptr;
         ptr = ptr->next;
     }
     new->next = ptr;
-    new->size = _align(size);
+    new->size = size;
     /* calculate number of bytes between new _unused_t chunk and end of packet
      * buffer */
     bytes_at_end = ((&_static_buf[0] + CONFIG_GNRC_PKTBUF_SIZE)
@@ -512,6 +845,33 @@ void gnrc_pktbuf_free_internal(void *data, size_t size)
         _merge(new, new->next);
     }
 }
+#endif
+
+void gnrc_pktbuf_free_internal(void *data, size_t size)
+{
+    if (data == NULL) {
+        return;
+    }
+
+    if (!gnrc_pktbuf_contains(data)) {
+        assert(0);
+        return;
+    }
+
+    if (CONFIG_GNRC_PKTBUF_CHECK_USE_AFTER_FREE) {
+        /* check if the data has already been marked as free */
+        size_t chk_len = _align(size) - sizeof(_unused_t);
+        if (chk_len &&
+            !memchk((uint8_t *)data + sizeof(_unused_t), GNRC_PKTBUF_CANARY, chk_len)) {
+            printf("pktbuf: double free detected! (at %p, len=%u)\n",
+                   data, (unsigned)_align(size));
+            DEBUG_BREAKPOINT(2);
+        }
+        memset(data, GNRC_PKTBUF_CANARY, _align(size));
+    }
+
+    _free_chunk(data, _align(size));
+}
 
 bool gnrc_pktbuf_contains(void *ptr)
 {
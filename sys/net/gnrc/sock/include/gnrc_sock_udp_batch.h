@@ -0,0 +1,118 @@
+/*
+ * Copyright (C) 2026 Mesotic SAS
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     net_gnrc_sock
+ *
+ * @{
+ *
+ * @file
+ * @brief   GNRC-specific helpers to receive and send several UDP datagrams
+ *
+ * The datagrams are still received and sent one by one, so these are no
+ * faster than calling @ref sock_udp_recv_buf_aux or @ref sock_udp_sendv_aux
+ * in a loop. They only save that loop and the handling of the timeout.
+ *
+ * @internal
+ */
+#ifndef GNRC_SOCK_UDP_BATCH_H
+#define GNRC_SOCK_UDP_BATCH_H
+
+#include <stddef.h>
+
+#include "net/sock/udp.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   A datagram received with @ref gnrc_sock_udp_recv_batch
+ */
+typedef struct {
+    void *data;             /**< buffer for the payload */
+    size_t max_len;         /**< size of gnrc_sock_udp_batch_rx_t::data */
+    /**
+     * @brief   Length of the received payload
+     *
+     * If it is larger than gnrc_sock_udp_batch_rx_t::max_len the payload was
+     * truncated.
+     */
+    size_t len;
+    sock_udp_ep_t remote;   /**< remote end point of the datagram */
+    /**
+     * @brief   Auxiliary data of the datagram
+     *
+     * Set sock_udp_aux_rx_t::flags to the information requested for this
+     * datagram.
+     */
+    sock_udp_aux_rx_t aux;
+} gnrc_sock_udp_batch_rx_t;
+
+/**
+ * @brief   A datagram sent with @ref gnrc_sock_udp_send_batch
+ */
+typedef struct {
+    const iolist_t *snips;          /**< payload chunks, may be `NULL` */
+    const sock_udp_ep_t *remote;    /**< remote end point, may be `NULL` */
+    sock_udp_aux_tx_t *aux;         /**< auxiliary data, may be `NULL` */
+} gnrc_sock_udp_batch_tx_t;
+
+/**
+ * @brief   Receives several UDP datagrams from remote end points
+ *
+ * Waits up to @p timeout for the first datagram, like @ref sock_udp_recv_aux,
+ * and then takes all further datagrams that are already queued for @p sock,
+ * up to @p numof, without waiting again.
+ *
+ * @pre `(sock != NULL) && (msgs != NULL) && (numof > 0)`
+ *
+ * @param[in] sock      A UDP sock object.
+ * @param[in,out] msgs  Receive buffers and the per datagram results.
+ * @param[in] numof     Number of entries in @p msgs.
+ * @param[in] timeout   Timeout for the first datagram in microseconds.
+ *                      If 0 and no data is available, the function returns
+ *                      immediately.
+ *                      May be @ref SOCK_NO_TIMEOUT for no timeout (wait until
+ *                      data is available).
+ *
+ * @return  The number of datagrams received, on success.
+ * @return  The errors of @ref sock_udp_recv_buf_aux, if no datagram was
+ *          received.
+ */
+int gnrc_sock_udp_recv_batch(sock_udp_t *sock, gnrc_sock_udp_batch_rx_t *msgs,
+                             unsigned numof, uint32_t timeout);
+
+/**
+ * @brief   Sends several UDP datagrams
+ *
+ * Each entry of @p msgs is sent like with @ref sock_udp_sendv_aux. Sending
+ * stops at the first datagram that fails.
+ *
+ * @pre `(msgs != NULL) && (numof > 0)`
+ * @pre `(sock != NULL)` or gnrc_sock_udp_batch_tx_t::remote is set for all
+ *      @p msgs
+ *
+ * @param[in] sock      A UDP sock object. May be `NULL`.
+ * @param[in] msgs      Datagrams to send.
+ * @param[in] numof     Number of entries in @p msgs.
+ *
+ * @return  The number of datagrams sent, on success.
+ * @return  The errors of @ref sock_udp_sendv_aux, if the first datagram
+ *          could not be sent.
+ */
+int gnrc_sock_udp_send_batch(sock_udp_t *sock,
+                             const gnrc_sock_udp_batch_tx_t *msgs,
+                             unsigned numof);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* GNRC_SOCK_UDP_BATCH_H */
+/** @} */
@@ -20,6 +20,7 @@
 #include <string.h>
 
 #include "byteorder.h"
+#include "macros/utils.h"
 #include "net/af.h"
 #include "net/protnum.h"
 #include "net/gnrc/ipv6.h"
@@ -29,6 +30,7 @@
 #include "random.h"
 
 #include "gnrc_sock_internal.h"
+#include "gnrc_sock_udp_batch.h"
 
 #define ENABLE_DEBUG 0
 #include "debug.h"
@@ -476,6 +478,63 @@ ssize_t sock_udp_sendv_aux(sock_udp_t *sock,
     return res;
 }
 
+int gnrc_sock_udp_recv_batch(sock_udp_t *sock, gnrc_sock_udp_batch_rx_t *msgs,
+                             unsigned numof, uint32_t timeout)
+{
+    unsigned received = 0;
+    uint32_t start = _now_us();
+
+    assert((sock != NULL) && (msgs != NULL) && (numof > 0));
+    while (received < numof) {
+        gnrc_sock_udp_batch_rx_t *msg = &msgs[received];
+        void *data, *ctx = NULL;
+        ssize_t res = sock_udp_recv_buf_aux(sock, &data, &ctx, timeout,
+                                            &msg->remote, &msg->aux);
+
+        if (res == -EPROTO) {
+            /* datagram from the wrong remote was dropped, keep waiting for
+             * what is left of the timeout */
+            if ((timeout != 0) && (timeout != SOCK_NO_TIMEOUT)) {
+                uint32_t now = _now_us();
+
+                if ((now - start) >= timeout) {
+                    return -ETIMEDOUT;
+                }
+                timeout -= now - start;
+                start = now;
+            }
+            continue;
+        }
+        if (res < 0) {
+            return (received > 0) ? (int)received : res;
+        }
+        msg->len = res;
+        memcpy(msg->data, data, MIN((size_t)res, msg->max_len));
+        /* release the packet */
+        sock_udp_recv_buf_aux(sock, &data, &ctx, 0, NULL, NULL);
+        received++;
+        /* only wait for the first datagram, take the others only if they
+         * are queued already */
+        timeout = 0;
+    }
+    return received;
+}
+
+int gnrc_sock_udp_send_batch(sock_udp_t *sock,
+                             const gnrc_sock_udp_batch_tx_t *msgs,
+                             unsigned numof)
+{
+    assert((msgs != NULL) && (numof > 0));
+    for (unsigned i = 0; i < numof; i++) {
+        ssize_t res = sock_udp_sendv_aux(sock, msgs[i].snips, msgs[i].remote,
+                                         msgs[i].aux);
+        if (res < 0) {
+            return (i > 0) ? (int)i : res;
+        }
+    }
+    return numof;
+}
+
 #ifdef SOCK_HAS_ASYNC
 void sock_udp_set_cb(sock_udp_t *sock, sock_udp_cb_t cb, void *arg)
 {
@@ -24,11 +24,13 @@
 #include "net/gnrc.h"
 #include "evtimer.h"
 #include "evtimer_msg.h"
+#include "macros/utils.h"
 #include "include/gnrc_tcp_common.h"
 #include "include/gnrc_tcp_eventloop.h"
 #include "include/gnrc_tcp_pkt.h"
 #include "include/gnrc_tcp_option.h"
 #include "include/gnrc_tcp_rcvbuf.h"
+#include "include/gnrc_tcp_ooo.h"
 #include "include/gnrc_tcp_fsm.h"
 
 #ifdef MODULE_GNRC_IPV6
@@ -148,8 +150,10 @@ static int _transition_to(gnrc_tcp_tcb_t *tcb, _gnrc_tcp_fsm_state_t state)
 
     switch (state) {
         case FSM_STATE_CLOSED:
-            /* Clear retransmit queue */
+            /* Clear retransmit queue and out-of-order queue */
             _clear_retransmit(tcb);
+            _gnrc_tcp_ooo_clear(tcb);
+            tcb->status &= ~(STATUS_SACK_PERMITTED);
 
             /* Close connection if not listenng */
             if (!(tcb->status & STATUS_LISTENING))
@@ -175,7 +179,7 @@ static int _transition_to(gnrc_tcp_tcb_t *tcb, _gnrc_tcp_fsm_state_t state)
 
         case FSM_STATE_LISTEN:
             /* Clear Accepted Status */
-            tcb->status &= ~(STATUS_ACCEPTED);
+            tcb->status &= ~(STATUS_ACCEPTED | STATUS_SACK_PERMITTED);
 
             /* Clear address info */
 #ifdef MODULE_GNRC_IPV6
@@ -360,12 +364,22 @@ static int _fsm_call_recv(gnrc_tcp_tcb_t *tcb, void *buf, size_t len)
 
     /* Read data into 'buf' up to 'len' bytes from receive buffer */
     size_t rcvd = ringbuffer_get(&(tcb->rcv_buf), buf, len);
+    uint32_t rcv_nxt = tcb->rcv_nxt;
+
+    /* Move held segments the receive buffer had no room for, the right
+     * edge of the window stays where it is */
+    _gnrc_tcp_ooo_drain(tcb);
+    tcb->rcv_wnd -= MIN(tcb->rcv_wnd, tcb->rcv_nxt - rcv_nxt);
+
+    bool ack = (tcb->rcv_nxt != rcv_nxt);
 
     /* If receive buffer can store more than CONFIG_GNRC_TCP_MSS: set window to free buffer size */
     if (ringbuffer_get_free(&tcb->rcv_buf) >= CONFIG_GNRC_TCP_MSS) {
         tcb->rcv_wnd = ringbuffer_get_free(&(tcb->rcv_buf));
-
-        /* Send ACK to announce window update */
+        ack = true;
+    }
+    if (ack) {
+        /* Send ACK to announce window update or the drained data */
         gnrc_pktsnip_t *out_pkt = NULL;
         uint16_t seq_con = 0;
         _gnrc_tcp_pkt_build(tcb, &out_pkt, &seq_con, MSK_ACK, tcb->snd_nxt,
@@ -782,11 +796,17 @@ static int _fsm_rcvd_pkt(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *in_pkt)
                         tcb->rcv_nxt += ringbuffer_add(&(tcb->rcv_buf), snp->data, snp->size);
                         snp = snp->next;
                     }
+                    /* Append held segments that are in order now */
+                    _gnrc_tcp_ooo_drain(tcb);
                     /* Shrink receive window */
                     tcb->rcv_wnd = ringbuffer_get_free(&(tcb->rcv_buf));
                     /* Notify owner because new data is available */
                     tcb->status |= STATUS_NOTIFY_USER;
                 }
+                /* Hold data ahead of rcv_nxt until the gap before it is filled */
+                else if (LSS_32_BIT(tcb->rcv_nxt, seg_seq)) {
+                    _gnrc_tcp_ooo_add(tcb, in_pkt, seg_seq, pay_len);
+                }
                 /* Send ACK, if FIN processing sends ACK already */
                 /* NOTE: this is the place to add payload piggybagging in the future */
                 if (!(ctl & MSK_FIN)) {
@@ -803,6 +823,14 @@ static int _fsm_rcvd_pkt(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *in_pkt)
                 TCP_DEBUG_LEAVE;
                 return 0;
             }
+            /* Data before FIN is missing: Acknowledge what we have, peer repeats FIN */
+            if (IS_USED(MODULE_GNRC_TCP_OOO) && LSS_32_BIT(tcb->rcv_nxt, seg_seq)) {
+                _gnrc_tcp_pkt_build(tcb, &out_pkt, &seq_con, MSK_ACK, tcb->snd_nxt,
+                                    tcb->rcv_nxt, NULL, 0);
+                _gnrc_tcp_pkt_send(tcb, out_pkt, seq_con, false);
+                TCP_DEBUG_LEAVE;
+                return 0;
+            }
             /* Advance rcv_nxt over FIN bit */
             tcb->rcv_nxt = seg_seq + seg_len;
             _gnrc_tcp_pkt_build(tcb, &out_pkt, &seq_con, MSK_ACK, tcb->snd_nxt,
@@ -0,0 +1,201 @@
+/*
+ * Copyright (C) 2026 Mesotic SAS
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     net_gnrc
+ * @{
+ *
+ * @file
+ * @brief       Implementation of internal/ooo.h
+ *
+ * @}
+ */
+#include <string.h>
+#include "net/gnrc/pktbuf.h"
+#include "include/gnrc_tcp_common.h"
+#include "include/gnrc_tcp_ooo.h"
+
+#define ENABLE_DEBUG 0
+#include "debug.h"
+
+static void _remove(gnrc_tcp_tcb_t *tcb, unsigned idx)
+{
+    gnrc_pktbuf_release(tcb->ooo_queue[idx].pkt);
+    tcb->ooo_numof--;
+    memmove(&tcb->ooo_queue[idx], &tcb->ooo_queue[idx + 1],
+            (tcb->ooo_numof - idx) * sizeof(tcb->ooo_queue[0]));
+}
+
+/* Copies the payload of seg, without its first skip bytes, into rcv_buf */
+static uint32_t _copy(gnrc_tcp_tcb_t *tcb, const gnrc_tcp_ooo_seg_t *seg, uint32_t skip)
+{
+    gnrc_pktsnip_t *snp = gnrc_pktsnip_search_type(seg->pkt, GNRC_NETTYPE_UNDEF);
+    uint32_t added = 0;
+
+    while (snp && snp->type == GNRC_NETTYPE_UNDEF) {
+        if (skip < snp->size) {
+            size_t len = snp->size - skip;
+            size_t res = ringbuffer_add(&(tcb->rcv_buf), (char *)snp->data + skip, len);
+
+            added += res;
+            if (res < len) {
+                break;
+            }
+            skip = 0;
+        }
+        else {
+            skip -= snp->size;
+        }
+        snp = snp->next;
+    }
+    return added;
+}
+
+int _gnrc_tcp_ooo_add(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *pkt,
+                      uint32_t seg_seq, uint16_t pay_len)
+{
+    TCP_DEBUG_ENTER;
+    unsigned idx = 0;
+
+    if (LSS_32_BIT(tcb->rcv_nxt + tcb->rcv_wnd, seg_seq + pay_len)) {
+        TCP_DEBUG_INFO("Segment exceeds receive window.");
+        TCP_DEBUG_LEAVE;
+        return -1;
+    }
+
+    /* Find insert position, keep queue sorted by sequence number */
+    while (idx < tcb->ooo_numof && LEQ_32_BIT(tcb->ooo_queue[idx].seq, seg_seq)) {
+        if (tcb->ooo_queue[idx].seq == seg_seq && tcb->ooo_queue[idx].len >= pay_len) {
+            TCP_DEBUG_INFO("Segment already queued.");
+            TCP_DEBUG_LEAVE;
+            return -1;
+        }
+        idx++;
+    }
+
+    /* Never evict a queued segment: It may have been selectively
+     * acknowledged already, and the peer would not send it again before
+     * its retransmission timeout */
+    if (tcb->ooo_numof == CONFIG_GNRC_TCP_OOO_QUEUE_SIZE) {
+        TCP_DEBUG_INFO("Queue full, segment dropped.");
+        TCP_DEBUG_LEAVE;
+        return -1;
+    }
+
+    memmove(&tcb->ooo_queue[idx + 1], &tcb->ooo_queue[idx],
+            (tcb->ooo_numof - idx) * sizeof(tcb->ooo_queue[0]));
+    gnrc_pktbuf_hold(pkt, 1);
+    tcb->ooo_queue[idx].pkt = pkt;
+    tcb->ooo_queue[idx].seq = seg_seq;
+    tcb->ooo_queue[idx].len = pay_len;
+    tcb->ooo_numof++;
+    tcb->ooo_recent = seg_seq;
+    TCP_DEBUG_INFO("Segment queued.");
+    TCP_DEBUG_LEAVE;
+    return 0;
+}
+
+void _gnrc_tcp_ooo_drain(gnrc_tcp_tcb_t *tcb)
+{
+    TCP_DEBUG_ENTER;
+    while (tcb->ooo_numof > 0 && LEQ_32_BIT(tcb->ooo_queue[0].seq, tcb->rcv_nxt)) {
+        gnrc_tcp_ooo_seg_t *seg = &tcb->ooo_queue[0];
+        uint32_t skip = tcb->rcv_nxt - seg->seq;
+
+        /* Segments may overlap, copy only what lies beyond rcv_nxt */
+        if (skip < seg->len) {
+            uint32_t added = _copy(tcb, seg, skip);
+
+            tcb->rcv_nxt += added;
+            if (added < seg->len - skip) {
+                /* Receive buffer is full. Keep the queued segments, they
+                 * may have been selectively acknowledged already. The rest
+                 * is drained once the user reads from the buffer. */
+                TCP_DEBUG_INFO("Receive buffer full.");
+                break;
+            }
+        }
+        _remove(tcb, 0);
+    }
+    TCP_DEBUG_LEAVE;
+}
+
+void _gnrc_tcp_ooo_clear(gnrc_tcp_tcb_t *tcb)
+{
+    TCP_DEBUG_ENTER;
+    for (unsigned i = 0; i < tcb->ooo_numof; i++) {
+        gnrc_pktbuf_release(tcb->ooo_queue[i].pkt);
+    }
+    tcb->ooo_numof = 0;
+    TCP_DEBUG_LEAVE;
+}
+
+static bool _holds_recent(const gnrc_tcp_tcb_t *tcb, const uint32_t *blocks,
+                          unsigned numof)
+{
+    for (unsigned i = 0; i < numof; i++) {
+        if (INSIDE_WND(blocks[2 * i], tcb->ooo_recent, blocks[2 * i + 1])) {
+            return true;
+        }
+    }
+    return false;
+}
+
+unsigned _gnrc_tcp_ooo_sack_blocks(const gnrc_tcp_tcb_t *tcb, uint32_t *blocks)
+{
+    unsigned numof = 0;
+
+    if (!(tcb->status & STATUS_SACK_PERMITTED)) {
+        return 0;
+    }
+
+    /* Merge adjacent and overlapping segments into blocks, in ascending order */
+    for (unsigned i = 0; i < tcb->ooo_numof; i++) {
+        uint32_t left = tcb->ooo_queue[i].seq;
+        uint32_t right = left + tcb->ooo_queue[i].len;
+
+        /* Data up to rcv_nxt is acknowledged cumulatively already */
+        if (LEQ_32_BIT(right, tcb->rcv_nxt)) {
+            continue;
+        }
+        if (LSS_32_BIT(left, tcb->rcv_nxt)) {
+            left = tcb->rcv_nxt;
+        }
+        if (numof > 0 && LEQ_32_BIT(left, blocks[2 * numof - 1])) {
+            if (LSS_32_BIT(blocks[2 * numof - 1], right)) {
+                blocks[2 * numof - 1] = right;
+            }
+            continue;
+        }
+        if (numof == GNRC_TCP_OOO_SACK_BLOCKS_MAX) {
+            if (_holds_recent(tcb, blocks, numof)) {
+                break;
+            }
+            /* The first block must hold the most recent segment, give up
+             * the last one until that segment is reached */
+            numof--;
+        }
+        blocks[2 * numof] = left;
+        blocks[2 * numof + 1] = right;
+        numof++;
+    }
+
+    /* Move the block holding the most recent segment to the front */
+    for (unsigned i = 1; i < numof; i++) {
+        if (INSIDE_WND(blocks[2 * i], tcb->ooo_recent, blocks[2 * i + 1])) {
+            uint32_t left = blocks[2 * i];
+            uint32_t right = blocks[2 * i + 1];
+
+            memmove(&blocks[2], &blocks[0], 2 * i * sizeof(blocks[0]));
+            blocks[0] = left;
+            blocks[1] = right;
+            break;
+        }
+    }
+    return numof;
+}
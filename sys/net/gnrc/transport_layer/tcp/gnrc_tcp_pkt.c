@@ -26,6 +26,7 @@
 #include "net/gnrc.h"
 #include "include/gnrc_tcp_common.h"
 #include "include/gnrc_tcp_eventloop.h"
+#include "include/gnrc_tcp_ooo.h"
 #include "include/gnrc_tcp_option.h"
 #include "include/gnrc_tcp_pkt.h"
 
@@ -155,6 +156,9 @@ int _gnrc_tcp_pkt_build(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t **out_pkt,
     gnrc_pktsnip_t *tcp_snp = NULL;
     tcp_hdr_t tcp_hdr;
     uint8_t offset = TCP_HDR_OFFSET_MIN;
+    bool sack_perm = false;
+    uint32_t sack_blocks[2 * GNRC_TCP_OOO_SACK_BLOCKS_MAX];
+    unsigned sack_numof = 0;
 
     /* Add payload, if supplied */
     if (payload != NULL && payload_len > 0) {
@@ -180,6 +184,19 @@ int _gnrc_tcp_pkt_build(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t **out_pkt,
     /* Add MSS option if SYN is sent */
     if (ctl & MSK_SYN) {
         offset += 1;
+        /* Offer SACK on SYN, accept it on SYN-ACK only if it was offered */
+        if (IS_USED(MODULE_GNRC_TCP_OOO) &&
+            (!(ctl & MSK_ACK) || (tcb->status & STATUS_SACK_PERMITTED))) {
+            sack_perm = true;
+            offset += 1;
+        }
+    }
+    /* Add SACK option if data is held in the out-of-order queue */
+    else if (ctl & MSK_ACK) {
+        sack_numof = _gnrc_tcp_ooo_sack_blocks(tcb, sack_blocks);
+        if (sack_numof > 0) {
+            offset += 1 + (sack_numof * TCP_OPTION_LENGTH_SACK_BLOCK) / sizeof(network_uint32_t);
+        }
     }
     /* Set offset and control bit accordingly */
     tcp_hdr.off_ctl = byteorder_htons(
@@ -217,8 +234,29 @@ int _gnrc_tcp_pkt_build(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t **out_pkt,
                     _gnrc_tcp_option_build_mss(CONFIG_GNRC_TCP_MSS));
 
                 memcpy(opt_ptr, &mss_option, sizeof(mss_option));
+                opt_ptr += sizeof(mss_option);
+            }
+            /* Options below are preceded by two NOPs to keep them aligned */
+            if (sack_perm) {
+                opt_ptr[0] = TCP_OPTION_KIND_NOP;
+                opt_ptr[1] = TCP_OPTION_KIND_NOP;
+                opt_ptr[2] = TCP_OPTION_KIND_SACK_PERM;
+                opt_ptr[3] = TCP_OPTION_LENGTH_SACK_PERM;
+                opt_ptr += sizeof(network_uint32_t);
+            }
+            if (sack_numof > 0) {
+                opt_ptr[0] = TCP_OPTION_KIND_NOP;
+                opt_ptr[1] = TCP_OPTION_KIND_NOP;
+                opt_ptr[2] = TCP_OPTION_KIND_SACK;
+                opt_ptr[3] = TCP_OPTION_LENGTH_MIN + sack_numof * TCP_OPTION_LENGTH_SACK_BLOCK;
+                opt_ptr += sizeof(network_uint32_t);
+                for (unsigned i = 0; i < 2 * sack_numof; i++) {
+                    network_uint32_t edge = byteorder_htonl(sack_blocks[i]);
+
+                    memcpy(opt_ptr, &edge, sizeof(edge));
+                    opt_ptr += sizeof(edge);
+                }
             }
-            /* Increase opt_ptr and decrease opt_left, if other options are added */
             /* NOTE: Add additional options here */
         }
         *(out_pkt) = tcp_snp;
@@ -47,6 +47,7 @@ extern "C" {
 #define STATUS_NOTIFY_USER    (1 << 2) /**< Internal: Status bitmask NOTIFY_USER */
 #define STATUS_ACCEPTED       (1 << 3) /**< Internal: Status bitmask ACCEPTED */
 #define STATUS_LOCKED         (1 << 4) /**< Internal: Status bitmask LOCKED */
+#define STATUS_SACK_PERMITTED (1 << 5) /**< Internal: Status bitmask SACK_PERMITTED */
 /** @} */
 
 /**
@@ -0,0 +1,127 @@
+/*
+ * Copyright (C) 2026 Mesotic SAS
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     net_gnrc_tcp
+ *
+ * @{
+ *
+ * @file
+ * @brief       Functions for the out-of-order queue and SACK generation.
+ *
+ * Without module `gnrc_tcp_ooo`, all functions are empty.
+ */
+
+#ifndef GNRC_TCP_OOO_H
+#define GNRC_TCP_OOO_H
+
+#include <stdint.h>
+#include "modules.h"
+#include "net/gnrc/pkt.h"
+#include "net/gnrc/tcp/tcb.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Maximum number of blocks in a SACK option.
+ *
+ * GNRC TCP sends no timestamps, so the option space holds four blocks
+ * (RFC 2018, section 3).
+ */
+#define GNRC_TCP_OOO_SACK_BLOCKS_MAX (4U)
+
+#if IS_USED(MODULE_GNRC_TCP_OOO) || defined(DOXYGEN)
+/**
+ * @brief Holds a segment that starts ahead of tcb->rcv_nxt.
+ *
+ * Segments that do not fit entirely into the receive window, duplicates
+ * of already queued segments and segments that arrive while the queue is
+ * full are ignored.
+ *
+ * @param[in,out] tcb       TCB holding the connection information.
+ * @param[in]     pkt       Received packet, held on success.
+ * @param[in]     seg_seq   Sequence number of the segment.
+ * @param[in]     pay_len   Payload length of the segment.
+ *
+ * @returns   Zero if the segment was queued.
+ *            -1 if the segment was ignored.
+ */
+int _gnrc_tcp_ooo_add(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *pkt,
+                      uint32_t seg_seq, uint16_t pay_len);
+
+/**
+ * @brief Moves queued segments that reached tcb->rcv_nxt into the
+ *        receive buffer and advances tcb->rcv_nxt.
+ *
+ * Stops when the receive buffer is full. The segments that did not fit stay
+ * queued, because the peer may not send them again after they were
+ * selectively acknowledged (RFC 2018, section 8).
+ *
+ * @param[in,out] tcb   TCB holding the connection information.
+ */
+void _gnrc_tcp_ooo_drain(gnrc_tcp_tcb_t *tcb);
+
+/**
+ * @brief Releases all queued segments.
+ *
+ * @param[in,out] tcb   TCB holding the connection information.
+ */
+void _gnrc_tcp_ooo_clear(gnrc_tcp_tcb_t *tcb);
+
+/**
+ * @brief Computes the SACK blocks describing the queued segments.
+ *
+ * The block that contains the most recently queued segment comes first,
+ * as required by RFC 2018, section 4.
+ *
+ * @param[in]  tcb      TCB holding the connection information.
+ * @param[out] blocks   Left and right edge of each block, must hold
+ *                      2 * GNRC_TCP_OOO_SACK_BLOCKS_MAX entries.
+ *
+ * @returns   Number of blocks. Zero if the peer did not permit SACK or
+ *            if the queue is empty.
+ */
+unsigned _gnrc_tcp_ooo_sack_blocks(const gnrc_tcp_tcb_t *tcb, uint32_t *blocks);
+#else
+static inline int _gnrc_tcp_ooo_add(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *pkt,
+                                    uint32_t seg_seq, uint16_t pay_len)
+{
+    (void)tcb;
+    (void)pkt;
+    (void)seg_seq;
+    (void)pay_len;
+    return -1;
+}
+
+static inline void _gnrc_tcp_ooo_drain(gnrc_tcp_tcb_t *tcb)
+{
+    (void)tcb;
+}
+
+static inline void _gnrc_tcp_ooo_clear(gnrc_tcp_tcb_t *tcb)
+{
+    (void)tcb;
+}
+
+static inline unsigned _gnrc_tcp_ooo_sack_blocks(const gnrc_tcp_tcb_t *tcb,
+                                                 uint32_t *blocks)
+{
+    (void)tcb;
+    (void)blocks;
+    return 0;
+}
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* GNRC_TCP_OOO_H */
+/** @} */
@@ -78,12 +78,12 @@ void ps(void)
 #ifdef MODULE_SCHEDSTATISTICS
     uint64_t rt_sum = 0;
     if (!IS_ACTIVE(MODULE_CORE_IDLE_THREAD)) {
-        rt_sum = sched_pidlist[KERNEL_PID_UNDEF].runtime_us;
+        rt_sum = schedstatistics_runtime_us(KERNEL_PID_UNDEF);
     }
     for (kernel_pid_t i = KERNEL_PID_FIRST; i <= KERNEL_PID_LAST; i++) {
         thread_t *p = thread_get(i);
         if (p != NULL) {
-            rt_sum += sched_pidlist[i].runtime_us;
+            rt_sum += schedstatistics_runtime_us(i);
         }
     }
 #endif /* MODULE_SCHEDSTATISTICS */
@@ -104,8 +104,8 @@ void ps(void)
 #endif
 #ifdef MODULE_SCHEDSTATISTICS
             /* multiply with 100 for percentage and to avoid floats/doubles */
-            uint64_t runtime_us = sched_pidlist[i].runtime_us * 100;
-            uint32_t ztimer_us = {sched_pidlist[i].runtime_us};
+            uint64_t runtime_us = schedstatistics_runtime_us(i) * 100;
+            uint32_t ztimer_us = schedstatistics_runtime_us(i);
             unsigned runtime_major = runtime_us / rt_sum;
             unsigned runtime_minor = ((runtime_us % rt_sum) * 1000) / rt_sum;
             unsigned switches = sched_pidlist[i].schedules;
@@ -141,6 +141,32 @@ void ps(void)
 #ifdef DEVELHELP
     printf("\t%5s %-21s|%13s%6s %6i (%5i) (%5i)\n", "|", "SUM", "|", "|",
            overall_stacksz, overall_used, overall_stacksz - overall_used);
+#endif
+
+#ifdef MODULE_SCHEDSTATISTICS_HIST
+    printf("\n\tRun length and wake latency histograms, bins from "
+           "(1/%" PRIu32 " s):\n\tpid |      |",
+           (uint32_t)SCHEDSTATISTICS_FREQ);
+    for (unsigned bin = 0; bin < CONFIG_SCHEDSTATISTICS_HIST_BINS; bin++) {
+        printf(" %7" PRIu32, schedstatistics_hist_bin(bin));
+    }
+    for (kernel_pid_t i = KERNEL_PID_FIRST; i <= KERNEL_PID_LAST; i++) {
+        if (thread_get(i) == NULL) {
+            continue;
+        }
+        printf("\n\t%3" PRIkernel_pid " | run  |", i);
+        for (unsigned bin = 0; bin < CONFIG_SCHEDSTATISTICS_HIST_BINS; bin++) {
+            printf(" %7" PRIu32, sched_pidlist[i].run_hist[bin]);
+        }
+        printf("\n\t    | wake |");
+        for (unsigned bin = 0; bin < CONFIG_SCHEDSTATISTICS_HIST_BINS; bin++) {
+            printf(" %7" PRIu32, sched_pidlist[i].latency_hist[bin]);
+        }
+    }
+    puts("");
+#endif
+
+#ifdef DEVELHELP
 #   ifdef MODULE_TLSF_MALLOC
     puts("\nHeap usage:");
     tlsf_size_container_t sizes = { .free = 0, .used = 0 };
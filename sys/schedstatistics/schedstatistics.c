@@ -21,9 +21,12 @@
  * @}
  */
 
+#include "bitarithm.h"
+#include "cpu.h"
 #include "sched.h"
 #include "schedstatistics.h"
 #include "thread.h"
+#include "time_units.h"
 #include "ztimer.h"
 
 /**
@@ -32,14 +35,48 @@
  */
 schedstat_t sched_pidlist[KERNEL_PID_LAST + 1];
 
+/* threads are woken up before the clock is ready */
+static bool _started;
+
+static inline uint32_t _now(void)
+{
+#if IS_USED(MODULE_SCHEDSTATISTICS_CYCLES)
+    return cpu_cycles_read();
+#else
+    return ztimer_now(ZTIMER_USEC);
+#endif
+}
+
+static inline void _hist_add(uint32_t *hist, uint32_t ticks)
+{
+    unsigned bin = 0;
+
+    ticks >>= CONFIG_SCHEDSTATISTICS_HIST_SHIFT;
+    if (ticks) {
+        bin = bitarithm_msb(ticks) + 1;
+        if (bin >= CONFIG_SCHEDSTATISTICS_HIST_BINS) {
+            bin = CONFIG_SCHEDSTATISTICS_HIST_BINS - 1;
+        }
+    }
+    hist[bin]++;
+}
+
 void sched_statistics_cb(kernel_pid_t active_thread, kernel_pid_t next_thread)
 {
-    uint32_t now = ztimer_now(ZTIMER_USEC);
+    uint32_t now = _now();
 
     /* Update active thread stats */
     if (!IS_USED(MODULE_CORE_IDLE_THREAD) || active_thread != KERNEL_PID_UNDEF) {
         schedstat_t *active_stat = &sched_pidlist[active_thread];
-        active_stat->runtime_us += now - active_stat->laststart;
+        uint32_t runtime = now - active_stat->laststart;
+#if IS_USED(MODULE_SCHEDSTATISTICS_CYCLES)
+        active_stat->runtime_cycles += runtime;
+#else
+        active_stat->runtime_us += runtime;
+#endif
+#if IS_USED(MODULE_SCHEDSTATISTICS_HIST)
+        _hist_add(active_stat->run_hist, runtime);
+#endif
     }
 
     /* Update next_thread stats */
@@ -47,15 +84,51 @@ void sched_statistics_cb(kernel_pid_t active_thread, kernel_pid_t next_thread)
         schedstat_t *next_stat = &sched_pidlist[next_thread];
         next_stat->laststart = now;
         next_stat->schedules++;
+#if IS_USED(MODULE_SCHEDSTATISTICS_HIST)
+        if (next_stat->woken) {
+            next_stat->woken = false;
+            _hist_add(next_stat->latency_hist, now - next_stat->lastwake);
+        }
+#endif
     }
 }
 
+#if IS_USED(MODULE_SCHEDSTATISTICS_HIST)
+void sched_wakeup_callback(thread_t *thread)
+{
+    schedstat_t *stat = &sched_pidlist[thread->pid];
+
+    if (!_started) {
+        return;
+    }
+    stat->lastwake = _now();
+    stat->woken = true;
+}
+#endif
+
+uint64_t schedstatistics_runtime_us(kernel_pid_t pid)
+{
+#if IS_USED(MODULE_SCHEDSTATISTICS_CYCLES)
+    uint64_t cycles = sched_pidlist[pid].runtime_cycles;
+
+    /* split to not overflow for long runtimes */
+    return (cycles / SCHEDSTATISTICS_FREQ) * US_PER_SEC
+           + ((cycles % SCHEDSTATISTICS_FREQ) * US_PER_SEC) / SCHEDSTATISTICS_FREQ;
+#else
+    return sched_pidlist[pid].runtime_us;
+#endif
+}
+
 void init_schedstatistics(void)
 {
+#if IS_USED(MODULE_SCHEDSTATISTICS_CYCLES)
+    cpu_cycles_init();
+#endif
     /* Init laststart for the thread starting schedstatistics since the callback
        wasn't registered when it was first scheduled */
     schedstat_t *active_stat = &sched_pidlist[thread_getpid()];
-    active_stat->laststart = ztimer_now(ZTIMER_USEC);
+    active_stat->laststart = _now();
     active_stat->schedules = 1;
     sched_register_cb(sched_statistics_cb);
+    _started = true;
 }
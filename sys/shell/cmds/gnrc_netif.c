@@ -188,6 +188,29 @@ static int _netif_stats(netif_t *iface, unsigned module, bool reset)
 }
 #endif /* MODULE_NETSTATS */
 
+#if IS_USED(MODULE_GNRC_NETIF_RX_BATCH)
+static void _netif_rx_batch_stats(netif_t *iface)
+{
+    gnrc_netif_t *netif = container_of(iface, gnrc_netif_t, netif);
+    gnrc_netif_rx_batch_stats_t stats;
+
+    gnrc_netif_rx_batch_stats(netif, &stats, false);
+    printf("          RX batches %u  frames %u  budget exhausted %u\n"
+           "            size",
+           (unsigned)stats.events, (unsigned)stats.frames,
+           (unsigned)stats.budget_exhausted);
+    for (unsigned i = 0; i < GNRC_NETIF_RX_BATCH_HIST_NUMOF; i++) {
+        if (i < GNRC_NETIF_RX_BATCH_HIST_NUMOF - 1) {
+            printf(" <%u: %u", 2U << i, (unsigned)stats.hist[i]);
+        }
+        else {
+            printf(" >=%u: %u", 1U << i, (unsigned)stats.hist[i]);
+        }
+    }
+    puts("");
+}
+#endif
+
 static void _link_usage(char *cmd_name)
 {
     printf("usage: %s <if_id> [up|down]\n", cmd_name);
@@ -958,6 +981,9 @@ static void _netif_list(netif_t *iface)
 #endif
 #ifdef MODULE_NETSTATS_IPV6
     _netif_stats(iface, NETSTATS_IPV6, false);
+#endif
+#if IS_USED(MODULE_GNRC_NETIF_RX_BATCH)
+    _netif_rx_batch_stats(iface);
 #endif
     puts("");
 }
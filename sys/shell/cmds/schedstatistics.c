@@ -0,0 +1,85 @@
+/*
+ * Copyright (C) 2026 Mesotic SAS
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     sys_shell_commands
+ * @{
+ *
+ * @file
+ * @brief       Shell command printing the scheduler statistics as JSON
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "schedstatistics.h"
+#include "shell.h"
+#include "thread.h"
+
+#if IS_USED(MODULE_SCHEDSTATISTICS_HIST)
+static void _print_hist(const char *name, const uint32_t *hist)
+{
+    printf(", \"%s\": [", name);
+    for (unsigned bin = 0; bin < CONFIG_SCHEDSTATISTICS_HIST_BINS; bin++) {
+        printf("%s%" PRIu32, bin ? ", " : "", hist[bin]);
+    }
+    printf("]");
+}
+#endif
+
+static void _print(kernel_pid_t pid)
+{
+    const char *name = thread_get_name(thread_get(pid));
+
+    printf("{ \"pid\": %" PRIkernel_pid ", \"name\": \"%s\", "
+           "\"schedules\": %u, \"runtime_us\": %" PRIu64,
+           pid, name ? name : "", sched_pidlist[pid].schedules,
+           schedstatistics_runtime_us(pid));
+#if IS_USED(MODULE_SCHEDSTATISTICS_HIST)
+    printf(", \"freq\": %" PRIu32 ", \"bins\": [",
+           (uint32_t)SCHEDSTATISTICS_FREQ);
+    for (unsigned bin = 0; bin < CONFIG_SCHEDSTATISTICS_HIST_BINS; bin++) {
+        printf("%s%" PRIu32, bin ? ", " : "", schedstatistics_hist_bin(bin));
+    }
+    printf("]");
+    _print_hist("run", sched_pidlist[pid].run_hist);
+    _print_hist("latency", sched_pidlist[pid].latency_hist);
+#endif
+    puts(" }");
+}
+
+static int _schedstat_handler(int argc, char **argv)
+{
+    if (argc > 2) {
+        printf("usage: %s [pid]\n", argv[0]);
+        return 1;
+    }
+    if (argc == 2) {
+        kernel_pid_t pid = atoi(argv[1]);
+
+        if (thread_get(pid) == NULL) {
+            printf("error: no thread with pid %s\n", argv[1]);
+            return 1;
+        }
+        _print(pid);
+        return 0;
+    }
+
+    for (kernel_pid_t pid = KERNEL_PID_FIRST; pid <= KERNEL_PID_LAST; pid++) {
+        if (thread_get(pid) != NULL) {
+            _print(pid);
+        }
+    }
+    return 0;
+}
+
+SHELL_COMMAND(schedstat, "Prints scheduler statistics as JSON, one line per thread",
+              _schedstat_handler);
@@ -43,6 +43,9 @@
 #ifdef MODULE_SUIT_TRANSPORT_VFS
 #include "suit/transport/vfs.h"
 #endif
+#ifdef MODULE_SUIT_TRANSPORT_WORKER_PIPELINE
+#include "suit/transport/worker.h"
+#endif
 #include "suit/transport/mock.h"
 
 #if defined(MODULE_PROGRESS_BAR)
@@ -390,6 +393,27 @@ static int _storage_helper(void *arg, size_t offset, uint8_t *buf, size_t len,
     }
     return res;
 }
+
+/* blocks go to the storage backend through the worker pipeline if enabled */
+static coap_blockwise_cb_t _storage_sink(suit_manifest_t *manifest, void **arg)
+{
+#if IS_USED(MODULE_SUIT_TRANSPORT_WORKER_PIPELINE)
+    if (suit_worker_pipeline_start(_storage_helper, manifest) == 0) {
+        *arg = NULL;
+        return suit_worker_pipeline_cb;
+    }
+#endif
+    *arg = manifest;
+    return _storage_helper;
+}
+
+static int _storage_sink_finish(int res)
+{
+#if IS_USED(MODULE_SUIT_TRANSPORT_WORKER_PIPELINE)
+    res = suit_worker_pipeline_finish(res);
+#endif
+    return res;
+}
 #endif
 
 static int _dtv_fetch(suit_manifest_t *manifest, int key,
@@ -445,9 +469,11 @@ static int _dtv_fetch(suit_manifest_t *manifest, int key,
 #ifdef MODULE_SUIT_TRANSPORT_COAP
     else if ((strncmp(manifest->urlbuf, "coap://", 7) == 0) ||
              (IS_USED(MODULE_NANOCOAP_DTLS) && strncmp(manifest->urlbuf, "coaps://", 8) == 0)) {
+        void *arg;
+        coap_blockwise_cb_t cb = _storage_sink(manifest, &arg);
         res = nanocoap_get_blockwise_url(manifest->urlbuf, CONFIG_SUIT_COAP_BLOCKSIZE,
-                                         _storage_helper,
-                                         manifest);
+                                         cb, arg);
+        res = _storage_sink_finish(res);
     }
 #endif
 #ifdef MODULE_SUIT_TRANSPORT_MOCK
@@ -457,7 +483,10 @@ static int _dtv_fetch(suit_manifest_t *manifest, int key,
 #endif
 #ifdef MODULE_SUIT_TRANSPORT_VFS
     else if (strncmp(manifest->urlbuf, "file://", 7) == 0) {
-        res = suit_transport_vfs_fetch(manifest, _storage_helper, manifest);
+        void *arg;
+        coap_blockwise_cb_t cb = _storage_sink(manifest, &arg);
+        res = suit_transport_vfs_fetch(manifest, cb, arg);
+        res = _storage_sink_finish(res);
     }
 #endif
     else {
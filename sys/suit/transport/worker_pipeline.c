@@ -0,0 +1,216 @@
+/*
+ * Copyright (C) 2026 Mesotic SAS
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     sys_suit_transport_worker
+ * @{
+ *
+ * @file
+ * @brief       SUIT worker download and storage write pipeline
+ *
+ * The transport copies each received block into one of two buffers and
+ * continues with the next request, while a writer thread passes the other
+ * buffer on to the storage backend.
+ *
+ * @}
+ */
+
+#include <assert.h>
+#include <errno.h>
+#include <inttypes.h>
+#include <string.h>
+
+#include "log.h"
+#include "macros/utils.h"
+#include "sema.h"
+#include "thread.h"
+#include "time_units.h"
+#include "ztimer.h"
+
+#include "suit/transport/coap.h"
+#include "suit/transport/worker.h"
+
+#define ENABLE_DEBUG 0
+#include "debug.h"
+
+#ifndef SUIT_WORKER_PIPELINE_STACKSIZE
+#define SUIT_WORKER_PIPELINE_STACKSIZE  (THREAD_STACKSIZE_DEFAULT)
+#endif
+
+/* below the worker, so receiving the next block preempts the writer */
+#ifndef SUIT_WORKER_PIPELINE_PRIO
+#define SUIT_WORKER_PIPELINE_PRIO       (THREAD_PRIORITY_MAIN)
+#endif
+
+/** Size of each of the two pipeline buffers, larger blocks are split */
+#ifndef SUIT_WORKER_PIPELINE_BUFSIZE
+#define SUIT_WORKER_PIPELINE_BUFSIZE    (1U << (CONFIG_SUIT_COAP_BLOCKSIZE + 4))
+#endif
+
+typedef struct {
+    size_t offset;
+    size_t len;
+    bool more;
+    uint8_t data[SUIT_WORKER_PIPELINE_BUFSIZE];
+} _chunk_t;
+
+static char _stack[SUIT_WORKER_PIPELINE_STACKSIZE];
+static kernel_pid_t _writer_pid = KERNEL_PID_UNDEF;
+
+static _chunk_t _chunks[2];
+static unsigned _head, _tail;
+static sema_t _free = SEMA_CREATE(ARRAY_SIZE(_chunks));
+static sema_t _full = SEMA_CREATE_LOCKED();
+
+static coap_blockwise_cb_t _cb;
+static void *_arg;
+static volatile int _res;
+static bool _running;
+
+static uint32_t _start;
+/* bytes and fetch_stall_us are only written by the transport, write_stall_us
+ * and write_us only by the writer, elapsed_us by suit_worker_pipeline_finish()
+ * once both are done */
+static suit_worker_stats_t _stats;
+
+static inline uint32_t _now(void)
+{
+    return ztimer_now(ZTIMER_USEC);
+}
+
+static void *_writer_thread(void *arg)
+{
+    (void)arg;
+
+    while (1) {
+        uint32_t waiting = _now();
+
+        sema_wait(&_full);
+
+        /* don't count the time the writer was idle before the download */
+        uint32_t now = _now();
+        _stats.write_stall_us += now - MAX(waiting, _start);
+
+        _chunk_t *chunk = &_chunks[_tail];
+        _tail ^= 1;
+
+        if (_res >= 0) {
+            int res = _cb(_arg, chunk->offset, chunk->data, chunk->len,
+                          chunk->more);
+            if (res < 0) {
+                _res = res;
+            }
+        }
+        _stats.write_us += _now() - now;
+
+        sema_post(&_free);
+    }
+
+    return NULL;
+}
+
+int suit_worker_pipeline_start(coap_blockwise_cb_t cb, void *arg)
+{
+    assert(!_running);
+
+    if (_writer_pid == KERNEL_PID_UNDEF) {
+        _writer_pid = thread_create(_stack, sizeof(_stack),
+                                    SUIT_WORKER_PIPELINE_PRIO, 0,
+                                    _writer_thread, NULL, "suit writer");
+        if (_writer_pid < 0) {
+            _writer_pid = KERNEL_PID_UNDEF;
+            return -ENOMEM;
+        }
+    }
+
+    _cb = cb;
+    _arg = arg;
+    _res = 0;
+    _head = 0;
+    _tail = 0;
+    memset(&_stats, 0, sizeof(_stats));
+    _start = _now();
+    _running = true;
+
+    return 0;
+}
+
+int suit_worker_pipeline_cb(void *arg, size_t offset, uint8_t *buf,
+                            size_t len, int more)
+{
+    (void)arg;
+
+    assert(_running);
+
+    /* pass at least one chunk on, the last one may be empty */
+    do {
+        uint32_t waiting = _now();
+
+        sema_wait(&_free);
+        _stats.fetch_stall_us += _now() - waiting;
+
+        if (_res < 0) {
+            sema_post(&_free);
+            return _res;
+        }
+
+        _chunk_t *chunk = &_chunks[_head];
+        _head ^= 1;
+
+        chunk->offset = offset;
+        chunk->len = MIN(len, sizeof(chunk->data));
+        memcpy(chunk->data, buf, chunk->len);
+
+        buf += chunk->len;
+        offset += chunk->len;
+        len -= chunk->len;
+        chunk->more = more || len;
+        _stats.bytes += chunk->len;
+
+        sema_post(&_full);
+    } while (len);
+
+    return 0;
+}
+
+int suit_worker_pipeline_finish(int res)
+{
+    if (!_running) {
+        return res;
+    }
+
+    /* wait for the writer to take care of both buffers */
+    for (unsigned i = 0; i < ARRAY_SIZE(_chunks); i++) {
+        sema_wait(&_free);
+    }
+    for (unsigned i = 0; i < ARRAY_SIZE(_chunks); i++) {
+        sema_post(&_free);
+    }
+
+    _stats.elapsed_us = _now() - _start;
+    _running = false;
+
+    uint32_t elapsed_ms = _stats.elapsed_us / US_PER_MS;
+    uint32_t rate = elapsed_ms ? ((uint64_t)_stats.bytes * MS_PER_SEC) / elapsed_ms : 0;
+    LOG_INFO("suit_worker: %" PRIu32 " bytes in %" PRIu32 " ms (%" PRIu32 " B/s), "
+             "fetch stalled %" PRIu32 " ms, write stalled %" PRIu32 " ms, "
+             "writing %" PRIu32 " ms\n",
+             _stats.bytes, elapsed_ms, rate,
+             (uint32_t)(_stats.fetch_stall_us / US_PER_MS),
+             (uint32_t)(_stats.write_stall_us / US_PER_MS),
+             (uint32_t)(_stats.write_us / US_PER_MS));
+
+    return res ? res : _res;
+}
+
+void suit_worker_pipeline_stats(suit_worker_stats_t *stats)
+{
+    /* the writer may still update the statistics while running */
+    assert(!_running);
+    *stats = _stats;
+}
@@ -0,0 +1,353 @@
+/*
+ * Copyright (C) 2026 Mesotic SAS
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     sys
+ * @{
+ *
+ * @file
+ * @brief       Export of the trace buffer as Chrome trace event JSON and CTF
+ *
+ * @}
+ */
+
+#include <errno.h>
+#include <fcntl.h>
+#include <stdarg.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "bitfield.h"
+#include "stdio_base.h"
+#include "trace.h"
+
+#if IS_USED(MODULE_VFS)
+#include "vfs.h"
+#endif
+
+/* tid of the track showing ISRs and events not bound to a thread */
+#define IRQ_TID         (KERNEL_PID_UNDEF)
+
+/* magic number starting CTF packets */
+#define CTF_MAGIC       (0xC1FC1FC1LU)
+
+/* size of a CTF event: uint8 id, uint64 timestamp, int16 pid, uint32 arg */
+#define CTF_EVENT_SIZE  (15)
+
+/**
+ * @brief   Names of the pid and arg fields of each event type
+ */
+static const struct {
+    const char *pid;
+    const char *arg;
+} _fields[] = {
+    [TRACE_USER] = { "pid", "value" },
+    [TRACE_SCHED] = { "next", "unused" },
+    [TRACE_MSG_SEND] = { "target", "msg_type" },
+    [TRACE_MSG_RECV] = { "sender", "msg_type" },
+    [TRACE_MUTEX_BLOCK] = { "pid", "mutex" },
+    [TRACE_MUTEX_UNBLOCK] = { "pid", "mutex" },
+    [TRACE_ISR_ENTER] = { "pid", "irq" },
+    [TRACE_ISR_EXIT] = { "pid", "irq" },
+    [TRACE_ZTIMER_FIRE] = { "pid", "callback" },
+};
+
+/**
+ * @brief   Iterator over the trace buffer, extending the times to 64 bit
+ */
+typedef struct {
+    size_t idx;
+    size_t numof;
+    uint32_t last;
+    uint64_t time;
+    trace_event_t event;
+} _iter_t;
+
+static void _iter_init(_iter_t *iter)
+{
+    memset(iter, 0, sizeof(*iter));
+    iter->numof = trace_numof();
+}
+
+static bool _iter_next(_iter_t *iter)
+{
+    if ((iter->idx >= iter->numof) || !trace_get(iter->idx, &iter->event)) {
+        return false;
+    }
+    if (iter->idx++ == 0) {
+        iter->time = iter->event.time;
+    }
+    else {
+        iter->time += (uint32_t)(iter->event.time - iter->last);
+    }
+    iter->last = iter->event.time;
+    return true;
+}
+
+static void _printf(trace_write_t write, void *ctx, const char *fmt, ...)
+{
+    char buf[160];
+    va_list args;
+
+    va_start(args, fmt);
+    int len = vsnprintf(buf, sizeof(buf), fmt, args);
+    va_end(args);
+
+    if (len > 0) {
+        write(ctx, buf, ((size_t)len < sizeof(buf)) ? (size_t)len
+                                                     : sizeof(buf) - 1);
+    }
+}
+
+static void _puts(trace_write_t write, void *ctx, const char *str)
+{
+    write(ctx, str, strlen(str));
+}
+
+static const char *_thread_name(kernel_pid_t pid)
+{
+    const thread_t *thread = thread_get(pid);
+    const char *name = thread ? thread_get_name(thread) : NULL;
+
+    return name ? name : "thread";
+}
+
+static void _json_slice(trace_write_t write, void *ctx, char ph,
+                        kernel_pid_t tid, const char *name, uint64_t time)
+{
+    _printf(write, ctx, ",\n{\"name\":\"%s\",\"ph\":\"%c\",\"pid\":0,"
+            "\"tid\":%" PRIkernel_pid ",\"ts\":%" PRIu64 "}",
+            name, ph, tid, time);
+}
+
+void trace_export_json(trace_write_t write, void *ctx)
+{
+    uint32_t mask = trace_set_mask(0);
+    kernel_pid_t running = KERNEL_PID_UNDEF;
+    unsigned isr_depth = 0;
+    BITFIELD(seen, KERNEL_PID_LAST + 1) = { 0 };
+    char irq_name[16];
+    _iter_t iter;
+
+    /* name the tracks of the IRQs and all threads appearing in the trace */
+    _printf(write, ctx, "{\"traceEvents\":[\n{\"name\":\"thread_name\","
+            "\"ph\":\"M\",\"pid\":0,\"tid\":%" PRIkernel_pid ","
+            "\"args\":{\"name\":\"irq\"}}", IRQ_TID);
+    _iter_init(&iter);
+    while (_iter_next(&iter)) {
+        kernel_pid_t pid = iter.event.pid;
+
+        if (pid_is_valid(pid) && !bf_isset(seen, pid)) {
+            bf_set(seen, pid);
+            _printf(write, ctx, ",\n{\"name\":\"thread_name\",\"ph\":\"M\","
+                    "\"pid\":0,\"tid\":%" PRIkernel_pid ",\"args\":{\"name\":"
+                    "\"%s (%" PRIkernel_pid ")\"}}",
+                    pid, _thread_name(pid), pid);
+        }
+    }
+
+    _iter_init(&iter);
+    while (_iter_next(&iter)) {
+        trace_event_t *e = &iter.event;
+
+        switch (e->type) {
+        case TRACE_SCHED:
+            if (running != KERNEL_PID_UNDEF) {
+                _json_slice(write, ctx, 'E', running, _thread_name(running),
+                            iter.time);
+            }
+            running = e->pid;
+            _json_slice(write, ctx, 'B', running, _thread_name(running),
+                        iter.time);
+            break;
+        case TRACE_ISR_ENTER:
+        case TRACE_ISR_EXIT:
+            if (e->type == TRACE_ISR_ENTER) {
+                isr_depth++;
+            }
+            else if (isr_depth) {
+                isr_depth--;
+            }
+            snprintf(irq_name, sizeof(irq_name), "irq %" PRIu32, e->arg);
+            _json_slice(write, ctx, (e->type == TRACE_ISR_ENTER) ? 'B' : 'E',
+                        IRQ_TID, irq_name, iter.time);
+            break;
+        default:
+            /* show the event in the context it happened in */
+            _printf(write, ctx, ",\n{\"name\":\"%s\",\"ph\":\"i\",\"s\":\"t\","
+                    "\"pid\":0,\"tid\":%" PRIkernel_pid ",\"ts\":%" PRIu64 ","
+                    "\"args\":{\"%s\":%" PRIkernel_pid ",\"%s\":%" PRIu32 "}}",
+                    trace_type_name(e->type),
+                    isr_depth ? IRQ_TID
+                              : (running != KERNEL_PID_UNDEF) ? running
+                              : e->pid, iter.time,
+                    _fields[e->type].pid, e->pid, _fields[e->type].arg, e->arg);
+            break;
+        }
+    }
+    /* close the slice of the thread running at the end */
+    if (running != KERNEL_PID_UNDEF) {
+        _json_slice(write, ctx, 'E', running, _thread_name(running),
+                    iter.time);
+    }
+
+    _puts(write, ctx, "\n]}\n");
+    trace_set_mask(mask);
+}
+
+void trace_export_ctf(trace_write_t write_metadata, void *metadata_ctx,
+                      trace_write_t write_stream, void *stream_ctx)
+{
+    uint32_t mask = trace_set_mask(0);
+    uint32_t header[2] = { CTF_MAGIC, 0 };
+    _iter_t iter;
+
+    _puts(write_metadata, metadata_ctx,
+          "/* CTF 1.8 */\n\n"
+          "typealias integer { size = 8; align = 8; signed = false; } "
+          ":= uint8_t;\n"
+          "typealias integer { size = 16; align = 8; signed = true; } "
+          ":= int16_t;\n"
+          "typealias integer { size = 32; align = 8; signed = false; } "
+          ":= uint32_t;\n\n"
+          "trace {\n"
+          "\tmajor = 1;\n\tminor = 8;\n"
+#if __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+          "\tbyte_order = be;\n"
+#else
+          "\tbyte_order = le;\n"
+#endif
+          "\tpacket.header := struct {\n"
+          "\t\tuint32_t magic;\n\t\tuint32_t stream_id;\n\t};\n};\n\n"
+          "clock {\n\tname = riot_usec;\n\tfreq = 1000000;\n};\n\n"
+          "typealias integer {\n"
+          "\tsize = 64; align = 8; signed = false;\n"
+          "\tmap = clock.riot_usec.value;\n"
+          "} := riot_usec_t;\n\n"
+          "stream {\n\tid = 0;\n"
+          "\tevent.header := struct {\n"
+          "\t\tuint8_t id;\n\t\triot_usec_t timestamp;\n\t};\n};\n");
+    for (unsigned type = 0; type < TRACE_TYPE_NUMOF; type++) {
+        _printf(write_metadata, metadata_ctx,
+                "\nevent {\n\tname = \"%s\";\n\tid = %u;\n\tstream_id = 0;\n"
+                "\tfields := struct {\n"
+                "\t\tint16_t %s;\n\t\tuint32_t %s;\n\t};\n};\n",
+                trace_type_name(type), type,
+                _fields[type].pid, _fields[type].arg);
+    }
+
+    write_stream(stream_ctx, header, sizeof(header));
+    _iter_init(&iter);
+    while (_iter_next(&iter)) {
+        uint8_t buf[CTF_EVENT_SIZE];
+        int16_t pid = iter.event.pid;
+
+        buf[0] = iter.event.type;
+        memcpy(&buf[1], &iter.time, sizeof(iter.time));
+        memcpy(&buf[9], &pid, sizeof(pid));
+        memcpy(&buf[11], &iter.event.arg, sizeof(iter.event.arg));
+        write_stream(stream_ctx, buf, sizeof(buf));
+    }
+
+    trace_set_mask(mask);
+}
+
+void trace_write_stdio(void *ctx, const void *data, size_t len)
+{
+    (void)ctx;
+    const uint8_t *pos = data;
+
+    /* not fwrite(): on native, that bypasses RIOT's stdio and ends up in the
+     * buffer of the host libc, out of order with everything printed */
+    while (len) {
+        ssize_t res = stdio_write(pos, len);
+        if (res <= 0) {
+            break;
+        }
+        pos += res;
+        len -= res;
+    }
+}
+
+#if IS_USED(MODULE_VFS)
+typedef struct {
+    int fd;
+    int res;
+} _vfs_ctx_t;
+
+static void _write_vfs(void *arg, const void *data, size_t len)
+{
+    _vfs_ctx_t *ctx = arg;
+
+    while ((ctx->res == 0) && len) {
+        ssize_t res = vfs_write(ctx->fd, data, len);
+
+        if (res <= 0) {
+            ctx->res = res ? res : -EIO;
+            break;
+        }
+        data = (const uint8_t *)data + res;
+        len -= res;
+    }
+}
+
+static int _open(_vfs_ctx_t *ctx, const char *path)
+{
+    ctx->res = 0;
+    ctx->fd = vfs_open(path, O_CREAT | O_TRUNC | O_WRONLY, 0);
+    return (ctx->fd < 0) ? ctx->fd : 0;
+}
+
+static int _close(_vfs_ctx_t *ctx)
+{
+    int res = vfs_close(ctx->fd);
+
+    return ctx->res ? ctx->res : res;
+}
+
+int trace_export_json_vfs(const char *path)
+{
+    _vfs_ctx_t ctx;
+    int res = _open(&ctx, path);
+
+    if (res < 0) {
+        return res;
+    }
+    trace_export_json(_write_vfs, &ctx);
+    return _close(&ctx);
+}
+
+int trace_export_ctf_vfs(const char *dir)
+{
+    char path[2][VFS_NAME_MAX + 1];
+    _vfs_ctx_t metadata, stream;
+    int res;
+
+    if ((snprintf(path[0], sizeof(path[0]), "%s/metadata", dir)
+         >= (int)sizeof(path[0])) ||
+        (snprintf(path[1], sizeof(path[1]), "%s/stream", dir)
+         >= (int)sizeof(path[1]))) {
+        return -ENAMETOOLONG;
+    }
+
+    res = _open(&metadata, path[0]);
+    if (res < 0) {
+        return res;
+    }
+    res = _open(&stream, path[1]);
+    if (res < 0) {
+        vfs_close(metadata.fd);
+        return res;
+    }
+    trace_export_ctf(_write_vfs, &metadata, _write_vfs, &stream);
+    res = _close(&stream);
+    int res_metadata = _close(&metadata);
+
+    return res ? res : res_metadata;
+}
+#endif
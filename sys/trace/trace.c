@@ -24,41 +24,106 @@
 
 #include "architecture.h"
 #include "irq.h"
+#include "trace.h"
 #include "ztimer.h"
 
+#if IS_USED(MODULE_SCHEDSTATISTICS)
+#include "schedstatistics.h"
+#endif
+
 #ifndef CONFIG_TRACE_BUFSIZE
 #define CONFIG_TRACE_BUFSIZE 512
 #endif
 
-typedef struct {
-    uint32_t time;
-    uint32_t val;
-} tracebuf_entry_t;
+static trace_event_t tracebuf[CONFIG_TRACE_BUFSIZE];
+static uint32_t tracebuf_pos;
+static uint32_t trace_mask = TRACE_MASK_ALL;
 
-static tracebuf_entry_t tracebuf[CONFIG_TRACE_BUFSIZE];
-static size_t tracebuf_pos;
+static const char *const _type_names[] = {
+    [TRACE_USER] = "user",
+    [TRACE_SCHED] = "sched",
+    [TRACE_MSG_SEND] = "msg_send",
+    [TRACE_MSG_RECV] = "msg_recv",
+    [TRACE_MUTEX_BLOCK] = "mutex_block",
+    [TRACE_MUTEX_UNBLOCK] = "mutex_unblock",
+    [TRACE_ISR_ENTER] = "isr_enter",
+    [TRACE_ISR_EXIT] = "isr_exit",
+    [TRACE_ZTIMER_FIRE] = "ztimer_fire",
+};
 
-void trace(uint32_t val)
+void trace_event(trace_type_t type, kernel_pid_t pid, uint32_t arg)
 {
+    if (!(trace_mask & (1LU << type))) {
+        return;
+    }
+
     unsigned state = irq_disable();
 
     tracebuf[tracebuf_pos % CONFIG_TRACE_BUFSIZE] =
-        (tracebuf_entry_t){ .time = ztimer_now(ZTIMER_USEC), .val = val };
+        (trace_event_t){ .time = ztimer_now(ZTIMER_USEC), .arg = arg,
+                         .pid = pid, .type = type };
     tracebuf_pos++;
     irq_restore(state);
 }
 
+void trace(uint32_t val)
+{
+    trace_event(TRACE_USER, thread_getpid(), val);
+}
+
+uint32_t trace_set_mask(uint32_t mask)
+{
+    uint32_t old = trace_mask;
+
+    trace_mask = mask;
+    return old;
+}
+
+size_t trace_numof(void)
+{
+    return tracebuf_pos >
+           CONFIG_TRACE_BUFSIZE ? CONFIG_TRACE_BUFSIZE : tracebuf_pos;
+}
+
+uint32_t trace_lost(void)
+{
+    return tracebuf_pos - trace_numof();
+}
+
+bool trace_get(size_t idx, trace_event_t *event)
+{
+    unsigned state = irq_disable();
+    size_t n = trace_numof();
+
+    if (idx < n) {
+        *event = tracebuf[(tracebuf_pos - n + idx) % CONFIG_TRACE_BUFSIZE];
+    }
+    irq_restore(state);
+    return idx < n;
+}
+
+const char *trace_type_name(trace_type_t type)
+{
+    return (type < TRACE_TYPE_NUMOF) ? _type_names[type] : "unknown";
+}
+
 void trace_dump(void)
 {
-    size_t n = tracebuf_pos >
-               CONFIG_TRACE_BUFSIZE ? CONFIG_TRACE_BUFSIZE : tracebuf_pos;
+    size_t n = trace_numof();
     uint32_t t_last = 0;
+    trace_event_t event;
 
-    for (size_t i = 0; i < n; i++) {
-        printf("n=%4" PRIuSIZE " t=%s%8" PRIu32 " v=0x%08" PRIx32 "\n", i,
-               i ? "+" : " ",
-               tracebuf[i].time - t_last, tracebuf[i].val);
-        t_last = tracebuf[i].time;
+    for (size_t i = 0; (i < n) && trace_get(i, &event); i++) {
+        printf("n=%4" PRIuSIZE " t=%s%8" PRIu32, i, i ? "+" : " ",
+               event.time - t_last);
+        if (event.type == TRACE_USER) {
+            printf(" v=0x%08" PRIx32 "\n", event.arg);
+        }
+        else {
+            printf(" %s pid=%" PRIkernel_pid " v=0x%08" PRIx32 "\n",
+                   trace_type_name(event.type), event.pid, event.arg);
+        }
+        t_last = event.time;
     }
 }
 
@@ -69,3 +134,23 @@ void trace_reset(void)
     tracebuf_pos = 0;
     irq_restore(state);
 }
+
+#if IS_USED(MODULE_TRACE_SCHED)
+static void _sched_cb(kernel_pid_t active, kernel_pid_t next)
+{
+#if IS_USED(MODULE_SCHEDSTATISTICS)
+    sched_statistics_cb(active, next);
+#else
+    (void)active;
+#endif
+    if (next != KERNEL_PID_UNDEF) {
+        trace_event(TRACE_SCHED, next, 0);
+    }
+}
+
+void trace_sched_init(void)
+{
+    /* runs after schedstatistics, whose callback is called from ours */
+    sched_register_cb(_sched_cb);
+}
+#endif
@@ -17,6 +17,8 @@
  * @}
  */
 
+#include <string.h>
+
 #include "irq.h"
 #include "tsrb.h"
 
@@ -35,6 +37,49 @@ static uint8_t _peek(tsrb_t *rb, unsigned int idx)
     return rb->buf[(rb->reads + idx) & (rb->size - 1)];
 }
 
+static size_t _avail(const tsrb_t *rb, size_t n)
+{
+    unsigned int avail = rb->writes - rb->reads;
+
+    return (n < avail) ? n : avail;
+}
+
+static size_t _space(const tsrb_t *rb, size_t n)
+{
+    unsigned int space = rb->size - (rb->writes - rb->reads);
+
+    return (n < space) ? n : space;
+}
+
+/* copy n bytes starting at the oldest byte in at most two chunks */
+static void _copy_out(const tsrb_t *rb, uint8_t *dst, size_t n)
+{
+    unsigned int pos = rb->reads & (rb->size - 1);
+    size_t chunk = rb->size - pos;
+
+    if (n <= chunk) {
+        memcpy(dst, &rb->buf[pos], n);
+    }
+    else {
+        memcpy(dst, &rb->buf[pos], chunk);
+        memcpy(dst + chunk, rb->buf, n - chunk);
+    }
+}
+
+static void _copy_in(tsrb_t *rb, const uint8_t *src, size_t n)
+{
+    unsigned int pos = rb->writes & (rb->size - 1);
+    size_t chunk = rb->size - pos;
+
+    if (n <= chunk) {
+        memcpy(&rb->buf[pos], src, n);
+    }
+    else {
+        memcpy(&rb->buf[pos], src, chunk);
+        memcpy(rb->buf, src + chunk, n - chunk);
+    }
+}
+
 int tsrb_get_one(tsrb_t *rb)
 {
     int retval = -1;
@@ -59,38 +104,30 @@ int tsrb_peek_one(tsrb_t *rb)
 
 int tsrb_get(tsrb_t *rb, uint8_t *dst, size_t n)
 {
-    size_t tmp = n;
     unsigned irq_state = irq_disable();
-    while (tmp && !tsrb_empty(rb)) {
-        *dst++ = _pop(rb);
-        tmp--;
-    }
+    n = _avail(rb, n);
+    _copy_out(rb, dst, n);
+    rb->reads += n;
     irq_restore(irq_state);
-    return (n - tmp);
+    return n;
 }
 
 int tsrb_peek(tsrb_t *rb, uint8_t *dst, size_t n)
 {
-    size_t idx = 0;
     unsigned irq_state = irq_disable();
-    unsigned int avail = tsrb_avail(rb);
-    while (idx < n && idx != avail) {
-        *dst++ = _peek(rb, idx++);
-    }
+    n = _avail(rb, n);
+    _copy_out(rb, dst, n);
     irq_restore(irq_state);
-    return idx;
+    return n;
 }
 
 int tsrb_drop(tsrb_t *rb, size_t n)
 {
-    size_t tmp = n;
     unsigned irq_state = irq_disable();
-    while (tmp && !tsrb_empty(rb)) {
-        _pop(rb);
-        tmp--;
-    }
+    n = _avail(rb, n);
+    rb->reads += n;
     irq_restore(irq_state);
-    return (n - tmp);
+    return n;
 }
 
 int tsrb_add_one(tsrb_t *rb, uint8_t c)
@@ -107,12 +144,46 @@ int tsrb_add_one(tsrb_t *rb, uint8_t c)
 
 int tsrb_add(tsrb_t *rb, const uint8_t *src, size_t n)
 {
-    size_t tmp = n;
     unsigned irq_state = irq_disable();
-    while (tmp && !tsrb_full(rb)) {
-        _push(rb, *src++);
-        tmp--;
-    }
+    n = _space(rb, n);
+    _copy_in(rb, src, n);
+    rb->writes += n;
+    irq_restore(irq_state);
+    return n;
+}
+
+size_t tsrb_peek_region(tsrb_t *rb, uint8_t **region)
+{
+    unsigned irq_state = irq_disable();
+    unsigned int pos = rb->reads & (rb->size - 1);
+    size_t n = _avail(rb, rb->size - pos);
+    irq_restore(irq_state);
+
+    *region = &rb->buf[pos];
+    return n;
+}
+
+int tsrb_consume(tsrb_t *rb, size_t n)
+{
+    return tsrb_drop(rb, n);
+}
+
+size_t tsrb_reserve_region(tsrb_t *rb, uint8_t **region)
+{
+    unsigned irq_state = irq_disable();
+    unsigned int pos = rb->writes & (rb->size - 1);
+    size_t n = _space(rb, rb->size - pos);
+    irq_restore(irq_state);
+
+    *region = &rb->buf[pos];
+    return n;
+}
+
+int tsrb_commit(tsrb_t *rb, size_t n)
+{
+    unsigned irq_state = irq_disable();
+    n = _space(rb, n);
+    rb->writes += n;
     irq_restore(irq_state);
-    return (n - tmp);
+    return n;
 }
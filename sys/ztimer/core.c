@@ -33,6 +33,7 @@
 #endif
 #include "ztimer.h"
 #include "log.h"
+#include "trace.h"
 
 #define ENABLE_DEBUG 0
 #include "debug.h"
@@ -114,12 +115,36 @@ bool ztimer_release(ztimer_clock_t *clock)
 
 static unsigned _is_set(const ztimer_clock_t *clock, const ztimer_t *t)
 {
+#if MODULE_ZTIMER_WHEEL
+    (void)clock;
+    return t->base.prev != NULL;
+#else
     if (!clock->list.next) {
         return 0;
     }
     else {
         return (t->base.next || &t->base == clock->last);
     }
+#endif
+}
+
+static inline bool _has_entries(const ztimer_clock_t *clock)
+{
+#if MODULE_ZTIMER_WHEEL
+    return !ztimer_wheel_is_empty(&clock->wheel);
+#else
+    return clock->list.next != NULL;
+#endif
+}
+
+/* offset of the next target relative to clock->list.offset */
+static inline uint32_t _next_offset(const ztimer_clock_t *clock)
+{
+#if MODULE_ZTIMER_WHEEL
+    return ztimer_wheel_next(&clock->wheel);
+#else
+    return clock->list.next->offset;
+#endif
 }
 
 unsigned ztimer_is_set(const ztimer_clock_t *clock, const ztimer_t *timer)
@@ -156,7 +181,61 @@ bool ztimer_remove(ztimer_clock_t *clock, ztimer_t *timer)
     return was_removed;
 }
 
-uint32_t ztimer_set(ztimer_clock_t *clock, ztimer_t *timer, uint32_t val)
+#if MODULE_ZTIMER_SLACK
+/* target relative to now for a timer that may fire between val and end */
+static uint32_t _coalesce(ztimer_clock_t *clock, uint32_t val, uint32_t end)
+{
+#if MODULE_ZTIMER_WHEEL
+    /* only the interrupt the clock is armed for is known */
+    if ((val != end) && _has_entries(clock)) {
+        uint32_t next = _next_offset(clock);
+
+        if ((next >= val) && (next <= end)) {
+            clock->slack_stats.coalesced++;
+            return next;
+        }
+    }
+    return end;
+#else
+    ztimer_base_t *entry = clock->list.next;
+    uint32_t target = 0;
+
+    /* find the first timer not before the window */
+    for (; entry; entry = entry->next) {
+        target += entry->offset;
+        if (target >= val) {
+            break;
+        }
+    }
+    if (!entry) {
+        return end;
+    }
+    if ((val != end) && (target <= end)) {
+        clock->slack_stats.coalesced++;
+        return target;
+    }
+    /* all timers from here on are behind the window, pull the first one whose
+     * slack reaches into it */
+    for (; entry; entry = entry->next) {
+        if (target > end && entry->slack >= target - end) {
+            _del_entry_from_list(clock, entry);
+            entry->slack -= target - end;
+            entry->offset = end;
+            _add_entry_to_list(clock, entry);
+            clock->slack_stats.coalesced++;
+            return end;
+        }
+        if (entry->next) {
+            target += entry->next->offset;
+        }
+    }
+    return end;
+#endif
+}
+#endif
+
+static uint32_t _ztimer_set(ztimer_clock_t *clock, ztimer_t *timer,
+                            uint32_t val, uint32_t slack)
 {
     unsigned state = irq_disable();
 
@@ -191,6 +270,16 @@ uint32_t ztimer_set(ztimer_clock_t *clock, ztimer_t *timer, uint32_t val)
         val = 0;
     }
 
+#if MODULE_ZTIMER_SLACK
+    uint32_t end = (val + slack < val) ? UINT32_MAX : val + slack;
+    uint32_t target = _coalesce(clock, val, end);
+
+    timer->base.slack = target - val;
+    val = target;
+#else
+    (void)slack;
+#endif
+
     timer->base.offset = val;
     _add_entry_to_list(clock, &timer->base);
     _ztimer_update(clock);
@@ -213,20 +302,36 @@ uint32_t ztimer_set(ztimer_clock_t *clock, ztimer_t *timer, uint32_t val)
     return now;
 }
 
-static void _add_entry_to_list(ztimer_clock_t *clock, ztimer_base_t *entry)
+uint32_t ztimer_set(ztimer_clock_t *clock, ztimer_t *timer, uint32_t val)
 {
-    uint32_t delta_sum = 0;
+    return _ztimer_set(clock, timer, val, 0);
+}
 
-    ztimer_base_t *list = &clock->list;
+#if MODULE_ZTIMER_SLACK
+uint32_t ztimer_set_slack(ztimer_clock_t *clock, ztimer_t *timer, uint32_t val,
+                          uint32_t slack)
+{
+    return _ztimer_set(clock, timer, val, slack);
+}
+#endif
 
+static void _add_entry_to_list(ztimer_clock_t *clock, ztimer_base_t *entry)
+{
 #if MODULE_PM_LAYERED && !MODULE_ZTIMER_ONDEMAND
     /* First timer on the clock's linked list */
-    if (list->next == NULL &&
+    if (!_has_entries(clock) &&
         clock->block_pm_mode != ZTIMER_CLOCK_NO_REQUIRED_PM_MODE) {
         pm_block(clock->block_pm_mode);
     }
 #endif
 
+#if MODULE_ZTIMER_WHEEL
+    ztimer_wheel_add(&clock->wheel, entry, entry->offset);
+#else
+    uint32_t delta_sum = 0;
+
+    ztimer_base_t *list = &clock->list;
+
     /* Jump past all entries which are set to an earlier target than the new entry */
     while (list->next) {
         ztimer_base_t *list_entry = list->next;
@@ -249,7 +354,7 @@ static void _add_entry_to_list(ztimer_clock_t *clock, ztimer_base_t *entry)
     list->next = entry;
     DEBUG("_add_entry_to_list() %p offset %" PRIu32 "\n", (void *)entry,
           entry->offset);
-
+#endif
 }
 
 static uint32_t _add_modulo(uint32_t a, uint32_t b, uint32_t mod)
@@ -285,8 +390,12 @@ ztimer_now_t _ztimer_now_extend(ztimer_clock_t *clock)
 
 static uint32_t _ztimer_update_head_offset(ztimer_clock_t *clock)
 {
-    uint32_t old_base = clock->list.offset;
     uint32_t now = ztimer_now(clock);
+
+#if MODULE_ZTIMER_WHEEL
+    ztimer_wheel_advance(&clock->wheel, now);
+#else
+    uint32_t old_base = clock->list.offset;
     uint32_t diff = now - old_base;
 
     ztimer_base_t *entry = clock->list.next;
@@ -321,6 +430,7 @@ static uint32_t _ztimer_update_head_offset(ztimer_clock_t *clock)
             DEBUG("\n");
         }
     }
+#endif
 
     clock->list.offset = now;
     return now;
@@ -331,10 +441,15 @@ static bool _del_entry_from_list(ztimer_clock_t *clock, ztimer_base_t *entry)
     bool was_removed = false;
 
     DEBUG("_del_entry_from_list()\n");
-    ztimer_base_t *list = &clock->list;
 
     assert(_is_set(clock, (ztimer_t *)entry));
 
+#if MODULE_ZTIMER_WHEEL
+    ztimer_wheel_del(&clock->wheel, entry);
+    was_removed = true;
+#else
+    ztimer_base_t *list = &clock->list;
+
     while (list->next) {
         ztimer_base_t *list_entry = list->next;
         if (list_entry == entry) {
@@ -357,10 +472,11 @@ static bool _del_entry_from_list(ztimer_clock_t *clock, ztimer_base_t *entry)
         }
         list = list->next;
     }
+#endif
 
 #if MODULE_PM_LAYERED && !MODULE_ZTIMER_ONDEMAND
     /* The last timer just got removed from the clock's linked list */
-    if (clock->list.next == NULL &&
+    if (!_has_entries(clock) &&
         clock->block_pm_mode != ZTIMER_CLOCK_NO_REQUIRED_PM_MODE) {
         pm_unblock(clock->block_pm_mode);
     }
@@ -371,6 +487,18 @@ static bool _del_entry_from_list(ztimer_clock_t *clock, ztimer_base_t *entry)
 
 static ztimer_t *_now_next(ztimer_clock_t *clock)
 {
+#if MODULE_ZTIMER_WHEEL
+    ztimer_base_t *entry = ztimer_wheel_pop_expired(&clock->wheel);
+
+#if MODULE_PM_LAYERED && !MODULE_ZTIMER_ONDEMAND
+    /* The last timer just got removed from the clock's wheel */
+    if (entry && !_has_entries(clock) &&
+        clock->block_pm_mode != ZTIMER_CLOCK_NO_REQUIRED_PM_MODE) {
+        pm_unblock(clock->block_pm_mode);
+    }
+#endif
+    return (ztimer_t *)entry;
+#else
     ztimer_base_t *entry = clock->list.next;
 
     if (entry && (entry->offset == 0)) {
@@ -393,15 +521,16 @@ static ztimer_t *_now_next(ztimer_clock_t *clock)
     else {
         return NULL;
     }
+#endif
 }
 
 static void _ztimer_update(ztimer_clock_t *clock)
 {
 #ifdef MODULE_ZTIMER_EXTEND
     if (clock->max_value < UINT32_MAX) {
-        if (clock->list.next) {
+        if (_has_entries(clock)) {
             clock->ops->set(clock,
-                            _min_u32(clock->list.next->offset,
+                            _min_u32(_next_offset(clock),
                                      clock->max_value >> 1));
         }
         else {
@@ -412,8 +541,8 @@ static void _ztimer_update(ztimer_clock_t *clock)
 #endif
     }
     else {
-        if (clock->list.next) {
-            clock->ops->set(clock, clock->list.next->offset);
+        if (_has_entries(clock)) {
+            clock->ops->set(clock, _next_offset(clock));
         }
         else {
             clock->ops->cancel(clock);
@@ -436,8 +565,8 @@ void ztimer_handler(ztimer_clock_t *clock)
         /* calling now triggers checkpointing */
         uint32_t now = ztimer_now(clock);
 
-        if (clock->list.next) {
-            uint32_t target = clock->list.offset + clock->list.next->offset;
+        if (_has_entries(clock)) {
+            uint32_t target = clock->list.offset + _next_offset(clock);
             int32_t diff = (int32_t)(target - now);
             if (diff > 0) {
                 DEBUG("ztimer_handler(): %p postponing by %" PRIi32 "\n",
@@ -461,16 +590,29 @@ void ztimer_handler(ztimer_clock_t *clock)
     }
 #endif
 
-    if (clock->list.next) {
+    if (_has_entries(clock)) {
+#if MODULE_ZTIMER_WHEEL
+        _ztimer_update_head_offset(clock);
+#else
         clock->list.offset += clock->list.next->offset;
         clock->list.next->offset = 0;
+#endif
 
         ztimer_t *entry = _now_next(clock);
+#if MODULE_ZTIMER_SLACK
+        if (entry) {
+            clock->slack_stats.wakeups++;
+        }
+#endif
         while (entry) {
             DEBUG("ztimer_handler(): trigger %p->%p at %" PRIu32 "\n",
                   (void *)entry, (void *)entry->base.next, clock->ops->now(
                       clock));
+            trace_ztimer_fire(entry->callback);
             entry->callback(entry->arg);
+#if MODULE_ZTIMER_SLACK
+            clock->slack_stats.fired++;
+#endif
 #if MODULE_ZTIMER_ONDEMAND
             no_clock_user_left = ztimer_release(clock);
             if (no_clock_user_left) {
@@ -503,6 +645,15 @@ void ztimer_handler(ztimer_clock_t *clock)
 
 static void _ztimer_print(const ztimer_clock_t *clock)
 {
+#if MODULE_ZTIMER_WHEEL
+    printf("base=%" PRIu32 " pending=", clock->wheel.base);
+    for (unsigned level = 0; level < ZTIMER_WHEEL_LEVELS; level++) {
+        printf("%s0x%x", level ? ":" : "", clock->wheel.pending[level]);
+    }
+    printf(" expired=%p overflow=%p\n",
+           (void *)clock->wheel.lists[ZTIMER_WHEEL_EXPIRED],
+           (void *)clock->wheel.lists[ZTIMER_WHEEL_OVERFLOW]);
+#else
     const ztimer_base_t *entry = &clock->list;
     uint32_t last_offset = 0;
 
@@ -515,6 +666,7 @@ static void _ztimer_print(const ztimer_clock_t *clock)
 
     } while ((entry = entry->next));
     puts("");
+#endif
 }
 
 #if MODULE_ZTIMER_ONDEMAND && DEVELHELP
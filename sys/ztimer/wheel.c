@@ -0,0 +1,283 @@
+/*
+ * Copyright (C) 2026 Mesotic SAS
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser General
+ * Public License v2.1. See the file LICENSE in the top level directory for more
+ * details.
+ */
+
+/**
+ * @ingroup     sys_ztimer_wheel
+ * @{
+ *
+ * @file
+ * @brief       ztimer hierarchical timing wheel implementation
+ *
+ * Every timer stores its absolute target in ztimer_base_t::offset. All timers
+ * in a slot of level @c n share the bits above level @c n with the wheel
+ * base and have a larger level @c n digit than the base, so timers on lower
+ * levels always expire before timers on higher levels.
+ *
+ * @}
+ */
+
+#include <assert.h>
+#include <stdint.h>
+
+#include "bitarithm.h"
+#include "ztimer.h"
+#include "ztimer/wheel.h"
+
+#define ENABLE_DEBUG 0
+#include "debug.h"
+
+#define SLOT_MASK       (ZTIMER_WHEEL_SLOTS - 1)
+
+static_assert((CONFIG_ZTIMER_WHEEL_SLOT_BITS > 0) && (CONFIG_ZTIMER_WHEEL_SLOT_BITS <= 4),
+              "CONFIG_ZTIMER_WHEEL_SLOT_BITS must be in [1, 4]");
+
+static inline ztimer_base_t *_head(ztimer_wheel_t *wheel, unsigned list)
+{
+    /* only used as marker in the prev pointer, never dereferenced as timer */
+    return (ztimer_base_t *)&wheel->lists[list];
+}
+
+static inline bool _is_head(const ztimer_wheel_t *wheel, const ztimer_base_t *prev)
+{
+    const void *p = prev;
+
+    return (p >= (const void *)&wheel->lists[0]) &&
+           (p <= (const void *)&wheel->lists[ZTIMER_WHEEL_EXPIRED]);
+}
+
+static inline unsigned _head_index(const ztimer_wheel_t *wheel, const ztimer_base_t *prev)
+{
+    return (ztimer_base_t * const *)(const void *)prev - &wheel->lists[0];
+}
+
+static unsigned _level(uint32_t diff)
+{
+    unsigned level = 0;
+
+    while ((level < ZTIMER_WHEEL_LEVELS - 1) &&
+           (diff >> (CONFIG_ZTIMER_WHEEL_SLOT_BITS * (level + 1)))) {
+        level++;
+    }
+    return level;
+}
+
+static void _push(ztimer_wheel_t *wheel, unsigned list, ztimer_base_t *entry)
+{
+    entry->next = wheel->lists[list];
+    entry->prev = _head(wheel, list);
+    if (entry->next) {
+        entry->next->prev = entry;
+    }
+    wheel->lists[list] = entry;
+}
+
+static void _place(ztimer_wheel_t *wheel, ztimer_base_t *entry)
+{
+    unsigned level = _level(entry->offset ^ wheel->base);
+    unsigned slot = (entry->offset >> (CONFIG_ZTIMER_WHEEL_SLOT_BITS * level)) & SLOT_MASK;
+
+    _push(wheel, (level * ZTIMER_WHEEL_SLOTS) + slot, entry);
+    wheel->pending[level] |= 1U << slot;
+}
+
+static void _expire(ztimer_wheel_t *wheel, ztimer_base_t *entry)
+{
+    ztimer_base_t *pos = wheel->expired_tail;
+
+    /* timers usually expire in order, so search the position from the end */
+    while (pos && ((int32_t)(pos->offset - entry->offset) > 0)) {
+        pos = _is_head(wheel, pos->prev) ? NULL : pos->prev;
+    }
+
+    if (pos) {
+        entry->next = pos->next;
+        entry->prev = pos;
+        pos->next = entry;
+        if (entry->next) {
+            entry->next->prev = entry;
+        }
+    }
+    else {
+        _push(wheel, ZTIMER_WHEEL_EXPIRED, entry);
+    }
+
+    if (!entry->next) {
+        wheel->expired_tail = entry;
+    }
+}
+
+void ztimer_wheel_add(ztimer_wheel_t *wheel, ztimer_base_t *entry, uint32_t val)
+{
+    uint32_t target = wheel->base + val;
+
+    entry->offset = target;
+    if (val == 0) {
+        _expire(wheel, entry);
+    }
+    else if (target < wheel->base) {
+        /* placed into the wheel once the clock has wrapped around */
+        _push(wheel, ZTIMER_WHEEL_OVERFLOW, entry);
+    }
+    else {
+        _place(wheel, entry);
+    }
+    DEBUG("ztimer_wheel_add(): %p target %" PRIu32 "\n", (void *)entry, target);
+}
+
+void ztimer_wheel_del(ztimer_wheel_t *wheel, ztimer_base_t *entry)
+{
+    ztimer_base_t *prev = entry->prev;
+
+    assert(prev);
+
+    if (entry->next) {
+        entry->next->prev = prev;
+    }
+    else if (entry == wheel->expired_tail) {
+        wheel->expired_tail = _is_head(wheel, prev) ? NULL : prev;
+    }
+
+    if (_is_head(wheel, prev)) {
+        unsigned list = _head_index(wheel, prev);
+
+        wheel->lists[list] = entry->next;
+        if (!entry->next && (list < ZTIMER_WHEEL_OVERFLOW)) {
+            wheel->pending[list / ZTIMER_WHEEL_SLOTS] &= ~(1U << (list & SLOT_MASK));
+        }
+    }
+    else {
+        prev->next = entry->next;
+    }
+
+    /* reset the pointers so the timer is considered unset */
+    entry->next = NULL;
+    entry->prev = NULL;
+}
+
+static void _advance(ztimer_wheel_t *wheel, uint32_t now)
+{
+    unsigned due[ZTIMER_WHEEL_LEVELS];
+
+    /* determine the slots the wheel has passed, using the old base */
+    for (unsigned level = 0; level < ZTIMER_WHEEL_LEVELS; level++) {
+        unsigned shift = CONFIG_ZTIMER_WHEEL_SLOT_BITS * (level + 1);
+
+        if ((shift >= 32) || ((wheel->base >> shift) == (now >> shift))) {
+            unsigned digit = (now >> (shift - CONFIG_ZTIMER_WHEEL_SLOT_BITS)) & SLOT_MASK;
+            /* wraps to all ones for the last slot */
+            due[level] = wheel->pending[level] & ((2U << digit) - 1);
+        }
+        else {
+            due[level] = wheel->pending[level];
+        }
+        wheel->pending[level] &= ~due[level];
+    }
+
+    wheel->base = now;
+
+    /* cascade the passed slots, lower levels hold the earlier timers */
+    for (unsigned level = 0; level < ZTIMER_WHEEL_LEVELS; level++) {
+        while (due[level]) {
+            unsigned slot = bitarithm_lsb(due[level]);
+            unsigned list = (level * ZTIMER_WHEEL_SLOTS) + slot;
+            ztimer_base_t *entry = wheel->lists[list];
+
+            due[level] &= ~(1U << slot);
+            wheel->lists[list] = NULL;
+
+            while (entry) {
+                ztimer_base_t *next = entry->next;
+
+                if (entry->offset <= now) {
+                    _expire(wheel, entry);
+                }
+                else {
+                    _place(wheel, entry);
+                }
+                entry = next;
+            }
+        }
+    }
+}
+
+void ztimer_wheel_advance(ztimer_wheel_t *wheel, uint32_t now)
+{
+    if (now == wheel->base) {
+        return;
+    }
+
+    if (now < wheel->base) {
+        /* the clock wrapped around: all timers in the wheel have expired and
+         * the timers of the overflow list are placed relative to zero */
+        ztimer_base_t *entry = wheel->lists[ZTIMER_WHEEL_OVERFLOW];
+
+        _advance(wheel, UINT32_MAX);
+        wheel->lists[ZTIMER_WHEEL_OVERFLOW] = NULL;
+        wheel->base = 0;
+
+        while (entry) {
+            ztimer_base_t *next = entry->next;
+
+            if (entry->offset == 0) {
+                _expire(wheel, entry);
+            }
+            else {
+                _place(wheel, entry);
+            }
+            entry = next;
+        }
+    }
+
+    _advance(wheel, now);
+}
+
+ztimer_base_t *ztimer_wheel_pop_expired(ztimer_wheel_t *wheel)
+{
+    ztimer_base_t *entry = wheel->lists[ZTIMER_WHEEL_EXPIRED];
+
+    if (entry) {
+        ztimer_wheel_del(wheel, entry);
+    }
+    return entry;
+}
+
+uint32_t ztimer_wheel_next(const ztimer_wheel_t *wheel)
+{
+    assert(!ztimer_wheel_is_empty(wheel));
+
+    if (wheel->lists[ZTIMER_WHEEL_EXPIRED]) {
+        return 0;
+    }
+
+    for (unsigned level = 0; level < ZTIMER_WHEEL_LEVELS; level++) {
+        if (wheel->pending[level]) {
+            unsigned slot = bitarithm_lsb(wheel->pending[level]);
+            unsigned shift = CONFIG_ZTIMER_WHEEL_SLOT_BITS * (level + 1);
+            uint32_t start = (shift >= 32) ? 0 : ((wheel->base >> shift) << shift);
+
+            start |= (uint32_t)slot << (shift - CONFIG_ZTIMER_WHEEL_SLOT_BITS);
+            return start - wheel->base;
+        }
+    }
+
+    /* only timers behind the wrap around are left */
+    return 0 - wheel->base;
+}
+
+bool ztimer_wheel_is_empty(const ztimer_wheel_t *wheel)
+{
+    if (wheel->lists[ZTIMER_WHEEL_OVERFLOW] || wheel->lists[ZTIMER_WHEEL_EXPIRED]) {
+        return false;
+    }
+    for (unsigned level = 0; level < ZTIMER_WHEEL_LEVELS; level++) {
+        if (wheel->pending[level]) {
+            return false;
+        }
+    }
+    return true;
+}
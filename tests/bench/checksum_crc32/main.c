@@ -0,0 +1,91 @@
+/*
+ * Copyright (C) 2026 Mesotic SAS
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Throughput benchmark for the CRC32 implementations
+ *
+ * @}
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+
+#include "benchmark.h"
+#include "checksum/crc32.h"
+#include "container.h"
+
+#ifndef BENCH_RUNS
+#define BENCH_RUNS          (1000UL)
+#endif
+
+#define MAX_SIZE            (4096U)
+
+static uint8_t _buf[MAX_SIZE];
+static const unsigned _sizes[] = { 16, 64, 256, 1024, MAX_SIZE };
+static volatile uint32_t _crc;
+
+static uint32_t _reference(const uint8_t *buf, size_t size)
+{
+    uint32_t crc = ~0U;
+
+    while (size--) {
+        crc ^= *buf++;
+        for (unsigned i = 0; i < 8; i++) {
+            crc = (crc >> 1) ^ ((crc & 1) * 0xEDB88320UL);
+        }
+    }
+    return ~crc;
+}
+
+static const char *_impl(void)
+{
+    if (IS_USED(MODULE_CRC32_SLICE8)) {
+        return "slice8";
+    }
+    if (IS_USED(MODULE_CRC32_FAST)) {
+        return "fast";
+    }
+    return "bitwise";
+}
+
+int main(void)
+{
+    char name[32];
+    int res = 0;
+
+    printf("crc32 benchmark (%s)\n\n", _impl());
+
+    for (unsigned i = 0; i < sizeof(_buf); i++) {
+        _buf[i] = (i * 131) + 7;
+    }
+
+    for (unsigned i = 0; i < ARRAY_SIZE(_sizes); i++) {
+        unsigned size = _sizes[i];
+
+        /* start at an odd address to include the unaligned case */
+        if (crc32(_buf + 1, size - 1) != _reference(_buf + 1, size - 1)) {
+            printf("checksum mismatch for size %u\n", size);
+            res = 1;
+        }
+
+        printf("size: %u\n", size);
+        snprintf(name, sizeof(name), "crc32 (%u)", size);
+        BENCHMARK_FUNC(name, BENCH_RUNS, _crc = crc32(_buf, size));
+        snprintf(name, sizeof(name), "reference (%u)", size);
+        BENCHMARK_FUNC(name, BENCH_RUNS, _crc = _reference(_buf, size));
+    }
+
+    if (res == 0) {
+        puts("\n[SUCCESS]");
+    }
+    return res;
+}
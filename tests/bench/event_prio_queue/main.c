@@ -0,0 +1,284 @@
+/*
+ * Copyright (C) 2026 Mesotic SAS
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Latency and cancel cost of the priority event queue compared
+ *              to event_queue_t and event_wait_multi()
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+
+#include "event.h"
+#include "event/prio_queue.h"
+#include "test_utils/expect.h"
+#include "thread.h"
+#include "thread_flags.h"
+#include "ztimer.h"
+
+#ifndef BURST_NUMOF
+#define BURST_NUMOF     (8U)
+#endif
+#ifndef SPIN_US
+#define SPIN_US         (100U)
+#endif
+#ifndef RUNS_NUMOF
+#define RUNS_NUMOF      (200U)
+#endif
+#ifndef OPS_NUMOF
+#define OPS_NUMOF       (65536U)
+#endif
+
+#define LEVELS          CONFIG_EVENT_PRIO_QUEUE_LEVELS
+#define DEPTH_MAX       (256U)
+
+#define FLAG_URGENT     (0x1)
+#define FLAG_DRAINED    (0x2)
+
+typedef enum {
+    MODE_FIFO,          /**< a single event_queue_t */
+    MODE_MULTI,         /**< event_wait_multi() on an event_queue_t per level */
+    MODE_PRIO,          /**< event_prio_queue_t */
+    MODE_NUMOF,
+} bench_mode_t;
+
+static const char *_mode_names[] = { "fifo", "multi", "prio" };
+
+static char _stacks[MODE_NUMOF][THREAD_STACKSIZE_DEFAULT];
+static event_queue_t _fifo;
+static event_queue_t _multi[LEVELS];
+static event_prio_queue_t _prio;
+
+/* the same events go to every kind of queue, the event_queue_t ones only use
+ * their super member */
+static event_prio_t _burst[BURST_NUMOF];
+static event_prio_t _drain;
+static event_prio_t _urgent;
+static event_prio_t _depth_events[DEPTH_MAX];
+
+static thread_t *_main;
+static bench_mode_t _mode;
+static uint32_t _post_at_us;
+static uint32_t _urgent_start_us;
+static uint32_t _urgent_us;
+
+static void _post(bench_mode_t mode, event_prio_t *event)
+{
+    switch (mode) {
+    case MODE_FIFO:
+        event_post(&_fifo, &event->super);
+        break;
+    case MODE_MULTI:
+        event_post(&_multi[event->level], &event->super);
+        break;
+    default:
+        event_prio_post(&_prio, event);
+        break;
+    }
+}
+
+static void _spin(event_t *event)
+{
+    (void)event;
+    ztimer_spin(ZTIMER_USEC, SPIN_US);
+}
+
+/* the urgent event comes in while the first low priority handler runs, at a
+ * point that varies between runs */
+static void _spin_and_post(event_t *event)
+{
+    (void)event;
+    ztimer_spin(ZTIMER_USEC, _post_at_us);
+    _urgent_start_us = ztimer_now(ZTIMER_USEC);
+    _post(_mode, &_urgent);
+    ztimer_spin(ZTIMER_USEC, SPIN_US - _post_at_us);
+}
+
+static void _drained(event_t *event)
+{
+    (void)event;
+    thread_flags_set(_main, FLAG_DRAINED);
+}
+
+static void _urgent_handler(event_t *event)
+{
+    (void)event;
+    _urgent_us = ztimer_now(ZTIMER_USEC);
+    thread_flags_set(_main, FLAG_URGENT);
+}
+
+static void *_waiter(void *arg)
+{
+    bench_mode_t mode = (bench_mode_t)(uintptr_t)arg;
+    event_t *event;
+
+    switch (mode) {
+    case MODE_FIFO:
+        event_queue_claim(&_fifo);
+        event_loop(&_fifo);
+        break;
+    case MODE_MULTI:
+        event_queues_claim(_multi, LEVELS);
+        while ((event = event_wait_multi(_multi, LEVELS))) {
+            event->handler(event);
+        }
+        break;
+    default:
+        event_prio_queue_claim(&_prio);
+        event_prio_loop(&_prio);
+        break;
+    }
+    return NULL;
+}
+
+/* main posts a burst of low priority events to the waiter, which runs at a
+ * lower priority, and waits for the burst to be handled */
+static void _latency(bench_mode_t mode, unsigned burst)
+{
+    uint32_t sum = 0, max = 0;
+
+    _mode = mode;
+    thread_create(_stacks[mode], sizeof(_stacks[mode]),
+                  THREAD_PRIORITY_MAIN + 1, THREAD_CREATE_STACKTEST,
+                  _waiter, (void *)(uintptr_t)mode, _mode_names[mode]);
+
+    for (unsigned run = 0; run < RUNS_NUMOF; run++) {
+        uint32_t latency;
+
+        _post_at_us = (run * 37U) % SPIN_US;
+        for (unsigned i = 0; i < burst; i++) {
+            _post(mode, &_burst[i]);
+        }
+        _post(mode, &_drain);
+        thread_flags_wait_all(FLAG_URGENT | FLAG_DRAINED);
+        latency = _urgent_us - _urgent_start_us;
+
+        sum += latency;
+        if (latency > max) {
+            max = latency;
+        }
+    }
+
+    printf("{ \"mode\" : \"%s\", \"levels\" : %u, \"burst\" : %u, "
+           "\"spin_us\" : %u, \"runs\" : %u, \"avg_us\" : %" PRIu32 ", "
+           "\"max_us\" : %" PRIu32 " }\n",
+           _mode_names[mode], LEVELS, burst, SPIN_US, RUNS_NUMOF,
+           sum / RUNS_NUMOF, max);
+}
+
+/* cancel and repost the newest of depth queued events, the position a timeout
+ * event usually has */
+static void _cancel(unsigned depth)
+{
+    event_queue_t queue;
+    event_prio_queue_t prio;
+    event_prio_t *last = &_depth_events[depth - 1];
+    uint32_t start, fifo_us, prio_us;
+
+    event_queue_init_detached(&queue);
+    for (unsigned i = 0; i < depth; i++) {
+        event_post(&queue, &_depth_events[i].super);
+    }
+    start = ztimer_now(ZTIMER_USEC);
+    for (unsigned i = 0; i < OPS_NUMOF; i++) {
+        event_cancel(&queue, &last->super);
+        event_post(&queue, &last->super);
+    }
+    fifo_us = ztimer_now(ZTIMER_USEC) - start;
+    while (event_get(&queue)) {}
+
+    event_prio_queue_init_detached(&prio);
+    for (unsigned i = 0; i < depth; i++) {
+        event_prio_post(&prio, &_depth_events[i]);
+    }
+    start = ztimer_now(ZTIMER_USEC);
+    for (unsigned i = 0; i < OPS_NUMOF; i++) {
+        event_prio_cancel(&prio, last);
+        event_prio_post(&prio, last);
+    }
+    prio_us = ztimer_now(ZTIMER_USEC) - start;
+    while (event_prio_get(&prio)) {}
+
+    printf("{ \"depth\" : %u, \"ops\" : %u, "
+           "\"event_cancel_ns\" : %" PRIu32 ", "
+           "\"event_prio_cancel_ns\" : %" PRIu32 " }\n",
+           depth, OPS_NUMOF,
+           (uint32_t)(((uint64_t)fifo_us * 1000U) / OPS_NUMOF),
+           (uint32_t)(((uint64_t)prio_us * 1000U) / OPS_NUMOF));
+}
+
+/* post and take an event of the least urgent level, with all other levels
+ * empty, which is the worst case of event_wait_multi() */
+static void _dispatch(void)
+{
+    event_queue_t queues[LEVELS];
+    event_prio_queue_t prio;
+    event_prio_t *event = &_depth_events[0];
+    uint32_t start, multi_us, prio_us;
+
+    event_queues_init(queues, LEVELS);
+    start = ztimer_now(ZTIMER_USEC);
+    for (unsigned i = 0; i < OPS_NUMOF; i++) {
+        event_post(&queues[LEVELS - 1], &event->super);
+        expect(event_wait_multi(queues, LEVELS) == &event->super);
+    }
+    multi_us = ztimer_now(ZTIMER_USEC) - start;
+
+    event_prio_queue_init(&prio);
+    start = ztimer_now(ZTIMER_USEC);
+    for (unsigned i = 0; i < OPS_NUMOF; i++) {
+        event_prio_post(&prio, event);
+        expect(event_prio_wait(&prio) == event);
+    }
+    prio_us = ztimer_now(ZTIMER_USEC) - start;
+    thread_flags_clear(THREAD_FLAG_EVENT);
+
+    printf("{ \"levels\" : %u, \"ops\" : %u, "
+           "\"event_wait_multi_ns\" : %" PRIu32 ", "
+           "\"event_prio_wait_ns\" : %" PRIu32 " }\n",
+           LEVELS, OPS_NUMOF,
+           (uint32_t)(((uint64_t)multi_us * 1000U) / OPS_NUMOF),
+           (uint32_t)(((uint64_t)prio_us * 1000U) / OPS_NUMOF));
+}
+
+int main(void)
+{
+    _main = thread_get_active();
+    printf("{ \"board\" : \"%s\" }\n", RIOT_BOARD);
+
+    _burst[0] = (event_prio_t)EVENT_PRIO_INIT(_spin_and_post, LEVELS - 1);
+    for (unsigned i = 1; i < BURST_NUMOF; i++) {
+        _burst[i] = (event_prio_t)EVENT_PRIO_INIT(_spin, LEVELS - 1);
+    }
+    _drain = (event_prio_t)EVENT_PRIO_INIT(_drained, LEVELS - 1);
+    _urgent = (event_prio_t)EVENT_PRIO_INIT(_urgent_handler, 0);
+    for (unsigned i = 0; i < DEPTH_MAX; i++) {
+        _depth_events[i] = (event_prio_t)EVENT_PRIO_INIT(_spin, LEVELS - 1);
+    }
+
+    event_queue_init_detached(&_fifo);
+    event_queues_init_detached(_multi, LEVELS);
+    event_prio_queue_init_detached(&_prio);
+    for (bench_mode_t mode = 0; mode < MODE_NUMOF; mode++) {
+        _latency(mode, BURST_NUMOF);
+    }
+
+    for (unsigned depth = 1; depth <= DEPTH_MAX; depth *= 4) {
+        _cancel(depth);
+    }
+    _dispatch();
+
+    puts("[SUCCESS]");
+    return 0;
+}
@@ -0,0 +1,35 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2026 Mesotic SAS
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import sys
+from testrunner import run
+
+
+LATENCY_REGEXP = (r"{{ \"mode\" : \"{mode}\", \"levels\" : \d+, \"burst\" : \d+, "
+                  r"\"spin_us\" : \d+, \"runs\" : \d+, \"avg_us\" : \d+, "
+                  r"\"max_us\" : \d+ }}")
+CANCEL_REGEXP = (r"{{ \"depth\" : {depth}, \"ops\" : \d+, "
+                 r"\"event_cancel_ns\" : \d+, \"event_prio_cancel_ns\" : \d+ }}")
+DEPTH_MAX = 256
+
+
+def testfunc(child):
+    child.expect(r"{ \"board\" : \"[^\"]+\" }")
+    for mode in ("fifo", "multi", "prio"):
+        child.expect(LATENCY_REGEXP.format(mode=mode))
+    depth = 1
+    while depth <= DEPTH_MAX:
+        child.expect(CANCEL_REGEXP.format(depth=depth))
+        depth *= 4
+    child.expect(r"{ \"levels\" : \d+, \"ops\" : \d+, "
+                 r"\"event_wait_multi_ns\" : \d+, \"event_prio_wait_ns\" : \d+ }")
+    child.expect_exact("[SUCCESS]")
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc, timeout=120))
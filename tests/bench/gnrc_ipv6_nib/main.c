@@ -0,0 +1,133 @@
+/*
+ * Copyright (C) 2026 Mesotic SAS
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Next hop resolution benchmark for the GNRC NIB
+ *
+ * @}
+ */
+
+#include <stdio.h>
+
+#include "benchmark.h"
+#include "byteorder.h"
+#include "net/ethernet.h"
+#include "net/gnrc/ipv6/nib.h"
+#include "net/gnrc/netif/ethernet.h"
+#include "net/netdev_test.h"
+#include "test_utils/expect.h"
+
+#ifndef BENCH_RUNS
+#define BENCH_RUNS          (10UL * 1000UL)
+#endif
+
+/* leave some entries to the NIB itself, e.g. for the interface */
+#define NEIGHBORS_NUMOF     (CONFIG_GNRC_IPV6_NIB_NUMOF - 4)
+#define ROUTES_NUMOF        (CONFIG_GNRC_IPV6_NIB_OFFL_NUMOF - 4)
+
+static gnrc_netif_t _netif;
+static netdev_test_t _netdev;
+static char _netif_stack[THREAD_STACKSIZE_DEFAULT];
+
+static int _get_device_type(netdev_t *dev, void *value, size_t max_len)
+{
+    (void)dev;
+    expect(max_len == sizeof(uint16_t));
+    *((uint16_t *)value) = NETDEV_TYPE_ETHERNET;
+    return sizeof(uint16_t);
+}
+
+static int _get_max_packet_size(netdev_t *dev, void *value, size_t max_len)
+{
+    (void)dev;
+    expect(max_len == sizeof(uint16_t));
+    *((uint16_t *)value) = ETHERNET_DATA_LEN;
+    return sizeof(uint16_t);
+}
+
+static int _get_address(netdev_t *dev, void *value, size_t max_len)
+{
+    static const uint8_t addr[] = { 0xce, 0xab, 0xfe, 0xad, 0xf7, 0x26 };
+
+    (void)dev;
+    expect(max_len >= sizeof(addr));
+    memcpy(value, addr, sizeof(addr));
+    return sizeof(addr);
+}
+
+static void _neighbor(ipv6_addr_t *addr, uint8_t *l2addr, unsigned i)
+{
+    ipv6_addr_set_link_local_prefix(addr);
+    addr->u32[2] = byteorder_htonl(0x02000000);
+    addr->u32[3] = byteorder_htonl(i + 1);
+    memcpy(l2addr, &addr->u8[10], ETHERNET_ADDR_LEN);
+}
+
+static void _route(ipv6_addr_t *pfx, unsigned i)
+{
+    ipv6_addr_from_str(pfx, "2001:db8::");
+    pfx->u16[3] = byteorder_htons(i + 1);
+}
+
+int main(void)
+{
+    static gnrc_ipv6_nib_nc_t nce;
+    ipv6_addr_t neighbor, dst;
+    unsigned neighbors = 0, routes = 0;
+
+    printf("NIB benchmark (%u entries, %u off-link entries, %u buckets)\n\n",
+           CONFIG_GNRC_IPV6_NIB_NUMOF, CONFIG_GNRC_IPV6_NIB_OFFL_NUMOF,
+           CONFIG_GNRC_IPV6_NIB_HASH_NUMOF);
+
+    netdev_test_setup(&_netdev, 0);
+    netdev_test_set_get_cb(&_netdev, NETOPT_DEVICE_TYPE, _get_device_type);
+    netdev_test_set_get_cb(&_netdev, NETOPT_MAX_PDU_SIZE, _get_max_packet_size);
+    netdev_test_set_get_cb(&_netdev, NETOPT_ADDRESS, _get_address);
+    expect(gnrc_netif_ethernet_create(&_netif, _netif_stack, sizeof(_netif_stack),
+                                      GNRC_NETIF_PRIO, "bench_eth",
+                                      &_netdev.netdev.netdev) == 0);
+
+    for (unsigned fill = 8; neighbors < NEIGHBORS_NUMOF; fill *= 2) {
+        uint8_t l2addr[ETHERNET_ADDR_LEN];
+
+        fill = (fill > NEIGHBORS_NUMOF) ? NEIGHBORS_NUMOF : fill;
+        for (; neighbors < fill; neighbors++) {
+            _neighbor(&neighbor, l2addr, neighbors);
+            expect(gnrc_ipv6_nib_nc_set(&neighbor, _netif.pid, l2addr,
+                                        sizeof(l2addr)) == 0);
+            if (routes < ROUTES_NUMOF) {
+                _route(&dst, routes++);
+                expect(gnrc_ipv6_nib_ft_add(&dst, 64, &neighbor, _netif.pid,
+                                            0) == 0);
+            }
+        }
+        /* look up the entries added last */
+        _neighbor(&neighbor, l2addr, neighbors - 1);
+        _route(&dst, routes - 1);
+        dst.u32[3] = byteorder_htonl(0x1234);
+
+        printf("neighbors: %u, routes: %u\n", neighbors, routes);
+        expect(gnrc_ipv6_nib_get_next_hop_l2addr(&neighbor, &_netif, NULL,
+                                                 &nce) == 0);
+        BENCHMARK_FUNC("neighbor", BENCH_RUNS,
+                       gnrc_ipv6_nib_get_next_hop_l2addr(&neighbor, &_netif,
+                                                         NULL, &nce));
+        expect(gnrc_ipv6_nib_get_next_hop_l2addr(&dst, &_netif, NULL,
+                                                 &nce) == 0);
+        BENCHMARK_FUNC("route", BENCH_RUNS,
+                       gnrc_ipv6_nib_get_next_hop_l2addr(&dst, &_netif, NULL,
+                                                         &nce));
+    }
+
+    puts("\n[SUCCESS]");
+    return 0;
+}
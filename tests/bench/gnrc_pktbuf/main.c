@@ -0,0 +1,142 @@
+/*
+ * Copyright (C) 2026 Mesotic SAS
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Fragmentation benchmark for the static packet buffer
+ *
+ * @}
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+
+#include "benchmark.h"
+#include "container.h"
+#include "net/gnrc/pktbuf.h"
+
+#ifndef BENCH_RUNS
+#define BENCH_RUNS          (100UL * 1000UL)
+#endif
+
+#ifndef SLOTS_NUMOF
+#define SLOTS_NUMOF         (32U)
+#endif
+
+/* gnrc_pktbuf_static rounds every allocation up to the size of its internal
+ * free list entry, a pointer and an unsigned */
+#define ALIGN               (2 * sizeof(void *))
+#define ALIGNED(size)       (((size) + ALIGN - 1) & ~(ALIGN - 1))
+
+typedef struct {
+    gnrc_pktsnip_t *pkt;
+    size_t cost;            /**< bytes taken from the packet buffer */
+    uint8_t keep;           /**< chance to keep the packet, in 1/8 */
+} slot_t;
+
+static slot_t _slots[SLOTS_NUMOF];
+static size_t _used;
+static uint32_t _state = 0x2545f491;
+static unsigned _allocs, _fails, _frag_fails;
+
+static uint32_t _rand(void)
+{
+    /* xorshift32, deterministic to compare both allocators */
+    _state ^= _state << 13;
+    _state ^= _state >> 17;
+    _state ^= _state << 5;
+    return _state;
+}
+
+static unsigned _rand_range(unsigned min, unsigned max)
+{
+    return min + (_rand() % (max - min + 1));
+}
+
+static void _free(slot_t *slot)
+{
+    gnrc_pktbuf_release(slot->pkt);
+    slot->pkt = NULL;
+    _used -= slot->cost;
+}
+
+static void _alloc(slot_t *slot)
+{
+    unsigned kind = _rand() % 8;
+    size_t size;
+
+    if (kind == 0) {
+        /* reassembly buffer, lives long */
+        size = _rand_range(200, 1280);
+        slot->keep = 7;
+    }
+    else if (kind < 4) {
+        /* link-layer fragment */
+        size = _rand_range(40, 127);
+        slot->keep = 2;
+    }
+    else {
+        /* header */
+        size = _rand_range(8, 48);
+        slot->keep = 1;
+    }
+    slot->cost = ALIGNED(sizeof(gnrc_pktsnip_t)) + ALIGNED(size);
+
+    _allocs++;
+    slot->pkt = gnrc_pktbuf_add(NULL, NULL, size, GNRC_NETTYPE_UNDEF);
+    if (slot->pkt == NULL) {
+        _fails++;
+        if (CONFIG_GNRC_PKTBUF_SIZE - _used >= slot->cost) {
+            _frag_fails++;
+        }
+        return;
+    }
+    _used += slot->cost;
+}
+
+static void _step(void)
+{
+    slot_t *slot = &_slots[_rand() % SLOTS_NUMOF];
+
+    if (slot->pkt == NULL) {
+        _alloc(slot);
+    }
+    else if ((_rand() % 8) >= slot->keep) {
+        _free(slot);
+    }
+}
+
+int main(void)
+{
+    printf("gnrc_pktbuf benchmark (%s)\n\n",
+           IS_USED(MODULE_GNRC_PKTBUF_STATIC_SIZECLASS) ? "sizeclass" : "first-fit");
+
+    BENCHMARK_FUNC("replay", BENCH_RUNS, _step());
+
+    printf("allocations: %u, failed: %u, failed while fragmented: %u\n",
+           _allocs, _fails, _frag_fails);
+#ifdef DEVELHELP
+    gnrc_pktbuf_stats();
+#endif
+
+    for (unsigned i = 0; i < ARRAY_SIZE(_slots); i++) {
+        if (_slots[i].pkt != NULL) {
+            _free(&_slots[i]);
+        }
+    }
+    if (_used != 0) {
+        puts("accounting mismatch");
+        return 1;
+    }
+
+    puts("\n[SUCCESS]");
+    return 0;
+}
@@ -0,0 +1,211 @@
+/*
+ * Copyright (C) 2026 Mesotic SAS
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Lookup cost of the 6LoWPAN reassembly buffer and VRB over the
+ *              number of concurrent datagrams
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "byteorder.h"
+#include "net/gnrc.h"
+#include "net/gnrc/netif/hdr.h"
+#include "net/gnrc/sixlowpan/config.h"
+#include "net/gnrc/sixlowpan/frag/rb.h"
+#include "net/gnrc/sixlowpan/frag/vrb.h"
+#include "net/ieee802154.h"
+#include "net/ipv6/hdr.h"
+#include "net/sixlowpan.h"
+#include "test_utils/expect.h"
+#include "ztimer.h"
+
+#ifndef LOOKUPS_NUMOF
+#define LOOKUPS_NUMOF       (65536U)
+#endif
+
+#define DATAGRAMS_MAX       (CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_SIZE < \
+                             CONFIG_GNRC_SIXLOWPAN_FRAG_VRB_SIZE ? \
+                             CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_SIZE : \
+                             CONFIG_GNRC_SIXLOWPAN_FRAG_VRB_SIZE)
+#define DATAGRAM_SIZE       (96U)
+#define FRAG1_PAYLOAD_SIZE  (48U)
+#define TAG_BASE            (0x4200U)
+
+typedef struct {
+    gnrc_netif_hdr_t hdr;
+    uint8_t src[IEEE802154_LONG_ADDRESS_LEN];
+    uint8_t dst[IEEE802154_LONG_ADDRESS_LEN];
+} _netif_hdr_t;
+
+static const uint8_t _l2addr[] = { 0x02, 0x00, 0x5e, 0x10, 0x00, 0x00, 0x00, 0x00 };
+
+static _netif_hdr_t _netif_hdrs[DATAGRAMS_MAX];
+/* only the pointer is kept by the VRB */
+static gnrc_netif_t _out_netif;
+
+/* neighbors only differ in the last bytes of their address, as in a PAN */
+static void _set_netif_hdr(_netif_hdr_t *hdr, unsigned i)
+{
+    memcpy(hdr->src, _l2addr, sizeof(hdr->src));
+    hdr->src[6] = i >> 8;
+    hdr->src[7] = i + 1;
+    memcpy(hdr->dst, _l2addr, sizeof(hdr->dst));
+    gnrc_netif_hdr_init(&hdr->hdr, sizeof(hdr->src), sizeof(hdr->dst));
+    gnrc_netif_hdr_set_src_addr(&hdr->hdr, hdr->src, sizeof(hdr->src));
+    gnrc_netif_hdr_set_dst_addr(&hdr->hdr, hdr->dst, sizeof(hdr->dst));
+}
+
+/* the first fragment of an uncompressed datagram, which is reassembled as
+ * its hop limit forbids forwarding */
+static void _add_first_fragment(unsigned i)
+{
+    gnrc_pktsnip_t *pkt;
+    sixlowpan_frag_t *frag;
+    ipv6_hdr_t *ipv6;
+    uint8_t *data;
+
+    pkt = gnrc_pktbuf_add(NULL, NULL, sizeof(sixlowpan_frag_t) + 1 +
+                          FRAG1_PAYLOAD_SIZE, GNRC_NETTYPE_SIXLOWPAN);
+    expect(pkt != NULL);
+    memset(pkt->data, 0, pkt->size);
+    frag = pkt->data;
+    frag->disp_size = byteorder_htons((SIXLOWPAN_FRAG_1_DISP << 8) |
+                                      DATAGRAM_SIZE);
+    frag->tag = byteorder_htons(TAG_BASE + i);
+    data = (uint8_t *)(frag + 1);
+    data[0] = SIXLOWPAN_UNCOMP;
+    ipv6 = (ipv6_hdr_t *)&data[1];
+    ipv6_hdr_set_version(ipv6);
+    ipv6->len = byteorder_htons(DATAGRAM_SIZE - sizeof(ipv6_hdr_t));
+    ipv6->hl = 1;
+    expect(gnrc_sixlowpan_frag_rb_add(&_netif_hdrs[i].hdr, pkt, 0, 0) != NULL);
+}
+
+static void _add_vrb(unsigned i)
+{
+    gnrc_sixlowpan_frag_rb_base_t base = {
+        .src_len = sizeof(_netif_hdrs[i].src),
+        .dst_len = sizeof(_netif_hdrs[i].dst),
+        .tag = TAG_BASE + i,
+        .datagram_size = DATAGRAM_SIZE,
+    };
+
+    memcpy(base.src, _netif_hdrs[i].src, sizeof(base.src));
+    memcpy(base.dst, _netif_hdrs[i].dst, sizeof(base.dst));
+    expect(gnrc_sixlowpan_frag_vrb_add(&base, &_out_netif, _l2addr,
+                                       sizeof(_l2addr)) != NULL);
+}
+
+static void _check(unsigned datagrams)
+{
+    for (unsigned i = 0; i < datagrams; i++) {
+        gnrc_sixlowpan_frag_rb_t *rbe;
+        gnrc_sixlowpan_frag_vrb_t *vrbe;
+
+        rbe = gnrc_sixlowpan_frag_rb_get_by_datagram(&_netif_hdrs[i].hdr,
+                                                     TAG_BASE + i);
+        expect((rbe != NULL) && (rbe->super.tag == (TAG_BASE + i)));
+        expect(!gnrc_sixlowpan_frag_rb_exists(&_netif_hdrs[i].hdr,
+                                              TAG_BASE + datagrams));
+        vrbe = gnrc_sixlowpan_frag_vrb_get(_netif_hdrs[i].src,
+                                           sizeof(_netif_hdrs[i].src),
+                                           TAG_BASE + i);
+        expect((vrbe != NULL) && (vrbe->super.tag == (TAG_BASE + i)));
+        expect(gnrc_sixlowpan_frag_vrb_get(_netif_hdrs[i].src,
+                                           sizeof(_netif_hdrs[i].src),
+                                           TAG_BASE + datagrams) == NULL);
+    }
+}
+
+static void _clear(unsigned datagrams)
+{
+    for (unsigned i = 0; i < datagrams; i++) {
+        gnrc_sixlowpan_frag_rb_rm_by_datagram(&_netif_hdrs[i].hdr,
+                                              TAG_BASE + i);
+        gnrc_sixlowpan_frag_vrb_rm(
+            gnrc_sixlowpan_frag_vrb_get(_netif_hdrs[i].src,
+                                        sizeof(_netif_hdrs[i].src),
+                                        TAG_BASE + i)
+        );
+    }
+}
+
+/* fragments of concurrent datagrams arrive interleaved, so look the datagrams
+ * up round robin */
+static uint32_t _lookup_rb(unsigned datagrams)
+{
+    uint32_t start = ztimer_now(ZTIMER_USEC);
+
+    for (unsigned i = 0; i < LOOKUPS_NUMOF; i++) {
+        unsigned d = i % datagrams;
+
+        expect(gnrc_sixlowpan_frag_rb_exists(&_netif_hdrs[d].hdr,
+                                             TAG_BASE + d));
+    }
+    return ztimer_now(ZTIMER_USEC) - start;
+}
+
+static uint32_t _lookup_vrb(unsigned datagrams)
+{
+    uint32_t start = ztimer_now(ZTIMER_USEC);
+
+    for (unsigned i = 0; i < LOOKUPS_NUMOF; i++) {
+        unsigned d = i % datagrams;
+
+        expect(gnrc_sixlowpan_frag_vrb_get(_netif_hdrs[d].src,
+                                           sizeof(_netif_hdrs[d].src),
+                                           TAG_BASE + d) != NULL);
+    }
+    return ztimer_now(ZTIMER_USEC) - start;
+}
+
+int main(void)
+{
+    gnrc_pktbuf_init();
+    printf("{ \"board\" : \"%s\", \"rbuf_size\" : %u, \"rbuf_hash_size\" : %u, "
+           "\"vrb_size\" : %u, \"vrb_hash_size\" : %u }\n",
+           RIOT_BOARD, CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_SIZE,
+           CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_HASH_SIZE,
+           CONFIG_GNRC_SIXLOWPAN_FRAG_VRB_SIZE,
+           CONFIG_GNRC_SIXLOWPAN_FRAG_VRB_HASH_SIZE);
+
+    for (unsigned i = 0; i < DATAGRAMS_MAX; i++) {
+        _set_netif_hdr(&_netif_hdrs[i], i);
+    }
+    for (unsigned datagrams = 1; datagrams <= DATAGRAMS_MAX; datagrams *= 2) {
+        uint32_t rb_us, vrb_us;
+
+        for (unsigned i = 0; i < datagrams; i++) {
+            _add_first_fragment(i);
+            _add_vrb(i);
+        }
+        _check(datagrams);
+        rb_us = _lookup_rb(datagrams);
+        vrb_us = _lookup_vrb(datagrams);
+        _clear(datagrams);
+
+        printf("{ \"datagrams\" : %u, \"lookups\" : %u, "
+               "\"rb_ns_per_lookup\" : %" PRIu32 ", "
+               "\"vrb_ns_per_lookup\" : %" PRIu32 " }\n",
+               datagrams, LOOKUPS_NUMOF,
+               (uint32_t)(((uint64_t)rb_us * 1000U) / LOOKUPS_NUMOF),
+               (uint32_t)(((uint64_t)vrb_us * 1000U) / LOOKUPS_NUMOF));
+    }
+
+    puts("[SUCCESS]");
+    return 0;
+}
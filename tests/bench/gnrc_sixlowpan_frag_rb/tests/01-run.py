@@ -0,0 +1,29 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2026 Mesotic SAS
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import sys
+from testrunner import run
+
+
+RESULT_REGEXP = (r"{{ \"datagrams\" : {datagrams}, \"lookups\" : \d+, "
+                 r"\"rb_ns_per_lookup\" : \d+, \"vrb_ns_per_lookup\" : \d+ }}")
+
+
+def testfunc(child):
+    child.expect(r"{ \"board\" : \"[^\"]+\", \"rbuf_size\" : (\d+), \"rbuf_hash_size\" : \d+, "
+                 r"\"vrb_size\" : (\d+), \"vrb_hash_size\" : \d+ }")
+    datagrams_max = min(int(child.match.group(1)), int(child.match.group(2)))
+    datagrams = 1
+    while datagrams <= datagrams_max:
+        child.expect(RESULT_REGEXP.format(datagrams=datagrams))
+        datagrams *= 2
+    child.expect_exact("[SUCCESS]")
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc, timeout=120))
@@ -0,0 +1,256 @@
+/*
+ * Copyright (C) 2026 Mesotic SAS
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Send path cost of 6LoWPAN IPHC with and without the flow cache
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "byteorder.h"
+#include "net/gnrc.h"
+#include "net/gnrc/ipv6/hdr.h"
+#include "net/gnrc/netif/hdr.h"
+#include "net/gnrc/netif/ieee802154.h"
+#include "net/gnrc/sixlowpan/config.h"
+#include "net/gnrc/sixlowpan/ctx.h"
+#include "net/gnrc/sixlowpan/iphc.h"
+#include "net/gnrc/udp.h"
+#include "net/ieee802154.h"
+#include "net/netdev_test.h"
+#include "test_utils/expect.h"
+#include "ztimer.h"
+
+#ifndef PACKETS_NUMOF
+#define PACKETS_NUMOF       (4096U)
+#endif
+
+#define FLOWS_MAX           (8U)
+#define PAYLOAD_SIZE        (16U)
+#define PORT                (5683U)
+#define CTX_LTIME_MIN       (60U)
+
+static const uint8_t _l2addr[] = { 0x02, 0x00, 0x5e, 0x10, 0x00, 0x00, 0x00, 0x01 };
+
+static gnrc_netif_t _netif;
+static netdev_test_t _netdev;
+static char _netif_stack[THREAD_STACKSIZE_DEFAULT];
+
+static uint8_t _frame[IEEE802154_FRAME_LEN_MAX];
+static size_t _frame_len;
+static uint8_t _payload[PAYLOAD_SIZE];
+
+static int _get_device_type(netdev_t *dev, void *value, size_t max_len)
+{
+    (void)dev;
+    expect(max_len == sizeof(uint16_t));
+    *((uint16_t *)value) = NETDEV_TYPE_IEEE802154;
+    return sizeof(uint16_t);
+}
+
+static int _get_proto(netdev_t *dev, void *value, size_t max_len)
+{
+    (void)dev;
+    expect(max_len == sizeof(gnrc_nettype_t));
+    *((gnrc_nettype_t *)value) = GNRC_NETTYPE_SIXLOWPAN;
+    return sizeof(gnrc_nettype_t);
+}
+
+static int _get_max_pdu_size(netdev_t *dev, void *value, size_t max_len)
+{
+    (void)dev;
+    expect(max_len == sizeof(uint16_t));
+    *((uint16_t *)value) = IEEE802154_FRAME_LEN_MAX;
+    return sizeof(uint16_t);
+}
+
+static int _get_src_len(netdev_t *dev, void *value, size_t max_len)
+{
+    (void)dev;
+    expect(max_len == sizeof(uint16_t));
+    *((uint16_t *)value) = sizeof(_l2addr);
+    return sizeof(uint16_t);
+}
+
+static int _get_addr_long(netdev_t *dev, void *value, size_t max_len)
+{
+    (void)dev;
+    expect(max_len >= sizeof(_l2addr));
+    memcpy(value, _l2addr, sizeof(_l2addr));
+    return sizeof(_l2addr);
+}
+
+static int _send(netdev_t *dev, const iolist_t *iolist)
+{
+    (void)dev;
+    _frame_len = 0;
+    for (; iolist != NULL; iolist = iolist->iol_next) {
+        if ((_frame_len + iolist->iol_len) <= sizeof(_frame)) {
+            memcpy(&_frame[_frame_len], iolist->iol_base, iolist->iol_len);
+        }
+        _frame_len += iolist->iol_len;
+    }
+    return _frame_len;
+}
+
+/* every flow goes from the address of the interface in context 0 to a
+ * different context, as a sensor reporting to several collectors would */
+static void _send_flow(unsigned flow)
+{
+    gnrc_pktsnip_t *pkt, *ipv6;
+    ipv6_hdr_t *hdr;
+    ipv6_addr_t src, dst;
+    uint8_t dst_l2addr[IEEE802154_LONG_ADDRESS_LEN];
+
+    ipv6_addr_from_str(&src, "2001:db8::");
+    memcpy(&src.u8[8], _l2addr, sizeof(_l2addr));
+    src.u8[8] ^= 0x02;
+    ipv6_addr_from_str(&dst, "2001:db8::ff:fe00:0");
+    dst.u16[3] = byteorder_htons(flow + 1);
+    dst.u16[7] = byteorder_htons(flow + 1);
+    memcpy(dst_l2addr, _l2addr, sizeof(dst_l2addr));
+    dst_l2addr[7] = 0x80 + flow;
+
+    pkt = gnrc_pktbuf_add(NULL, _payload, sizeof(_payload), GNRC_NETTYPE_UNDEF);
+    expect(pkt != NULL);
+    pkt = gnrc_udp_hdr_build(pkt, PORT, PORT + flow);
+    expect(pkt != NULL);
+    ipv6 = gnrc_ipv6_hdr_build(pkt, &src, &dst);
+    expect(ipv6 != NULL);
+    hdr = ipv6->data;
+    hdr->len = byteorder_htons(gnrc_pkt_len(pkt));
+    hdr->nh = PROTNUM_UDP;
+    hdr->hl = 64;
+    pkt = gnrc_netif_hdr_build(NULL, 0, dst_l2addr, sizeof(dst_l2addr));
+    expect(pkt != NULL);
+    gnrc_netif_hdr_set_netif(pkt->data, &_netif);
+    pkt->next = ipv6;
+    gnrc_sixlowpan_iphc_send(pkt, NULL, 0);
+}
+
+/* the cached header must not change the frame, except the sequence number */
+static void _check_frames(unsigned flow)
+{
+    uint8_t cold[sizeof(_frame)];
+    size_t cold_len;
+
+    gnrc_sixlowpan_iphc_cache_flush();
+    _send_flow(flow);
+    expect(_frame_len > 0);
+    memcpy(cold, _frame, sizeof(cold));
+    cold_len = _frame_len;
+    _send_flow(flow);
+    expect(_frame_len == cold_len);
+    expect(memcmp(_frame, cold, 2) == 0);
+    expect(memcmp(&_frame[3], &cold[3], cold_len - 3) == 0);
+}
+
+/* a context change must not leave a stale header in the cache */
+static void _check_ctx_change(void)
+{
+    gnrc_sixlowpan_iphc_cache_stats_t stats;
+    gnrc_sixlowpan_ctx_t *ctx = gnrc_sixlowpan_ctx_lookup_id(1);
+    size_t comp_len;
+
+    expect(ctx != NULL);
+    gnrc_sixlowpan_iphc_cache_flush();
+    gnrc_sixlowpan_iphc_cache_stats(&stats, true);
+    _send_flow(0);
+    _send_flow(0);
+    comp_len = _frame_len;
+    gnrc_sixlowpan_iphc_cache_stats(&stats, true);
+    expect((stats.hits == 1) && (stats.misses == 1));
+
+    /* flow 0 sends to the prefix of context 1 */
+    gnrc_sixlowpan_ctx_update(1, &ctx->prefix, ctx->prefix_len, CTX_LTIME_MIN,
+                              false);
+    _send_flow(0);
+    expect(_frame_len > comp_len);
+    gnrc_sixlowpan_iphc_cache_stats(&stats, true);
+    expect((stats.stale == 1) && (stats.misses == 1));
+    gnrc_sixlowpan_ctx_update(1, &ctx->prefix, ctx->prefix_len, CTX_LTIME_MIN,
+                              true);
+}
+
+static uint32_t _run(unsigned flows, bool cache, uint32_t cold_us)
+{
+    gnrc_sixlowpan_iphc_cache_stats_t stats;
+    uint32_t start, us;
+
+    gnrc_sixlowpan_iphc_cache_flush();
+    gnrc_sixlowpan_iphc_cache_stats(&stats, true);
+    start = ztimer_now(ZTIMER_USEC);
+    for (unsigned i = 0; i < PACKETS_NUMOF; i++) {
+        if (!cache) {
+            gnrc_sixlowpan_iphc_cache_flush();
+        }
+        _send_flow(i % flows);
+    }
+    us = ztimer_now(ZTIMER_USEC) - start;
+    gnrc_sixlowpan_iphc_cache_stats(&stats, true);
+
+    printf("{ \"flows\" : %u, \"cache\" : %u, \"packets\" : %u, \"us\" : %" PRIu32
+           ", \"ns_per_packet\" : %" PRIu32 ", \"saved_ns_per_packet\" : %" PRId32
+           ", \"hits\" : %" PRIu32 ", \"misses\" : %" PRIu32
+           ", \"hit_rate\" : %" PRIu32 " }\n",
+           flows, (unsigned)cache, PACKETS_NUMOF, us,
+           (uint32_t)(((uint64_t)us * 1000U) / PACKETS_NUMOF),
+           cache ? (int32_t)((((int64_t)cold_us - us) * 1000) / PACKETS_NUMOF) : 0,
+           stats.hits, stats.misses,
+           (stats.hits + stats.misses) ?
+           (stats.hits * 100U) / (stats.hits + stats.misses) : 0);
+    return us;
+}
+
+int main(void)
+{
+    netdev_test_setup(&_netdev, NULL);
+    netdev_test_set_get_cb(&_netdev, NETOPT_DEVICE_TYPE, _get_device_type);
+    netdev_test_set_get_cb(&_netdev, NETOPT_PROTO, _get_proto);
+    netdev_test_set_get_cb(&_netdev, NETOPT_MAX_PDU_SIZE, _get_max_pdu_size);
+    netdev_test_set_get_cb(&_netdev, NETOPT_SRC_LEN, _get_src_len);
+    netdev_test_set_get_cb(&_netdev, NETOPT_ADDRESS_LONG, _get_addr_long);
+    netdev_test_set_send_cb(&_netdev, _send);
+    expect(gnrc_netif_ieee802154_create(&_netif, _netif_stack,
+                                        sizeof(_netif_stack), GNRC_NETIF_PRIO,
+                                        "bench_6lo",
+                                        &_netdev.netdev.netdev) == 0);
+
+    /* fill the whole context table, so every lookup has to check all of it */
+    for (unsigned id = 0; id < GNRC_SIXLOWPAN_CTX_SIZE; id++) {
+        ipv6_addr_t prefix;
+
+        ipv6_addr_from_str(&prefix, "2001:db8::");
+        prefix.u16[3] = byteorder_htons(id);
+        expect(gnrc_sixlowpan_ctx_update(id, &prefix, 64, CTX_LTIME_MIN,
+                                         true) != NULL);
+    }
+
+    printf("{ \"board\" : \"%s\", \"cache_size\" : %u, \"contexts\" : %u }\n",
+           RIOT_BOARD, CONFIG_GNRC_SIXLOWPAN_IPHC_CACHE_SIZE,
+           GNRC_SIXLOWPAN_CTX_SIZE);
+
+    for (unsigned flow = 0; flow < FLOWS_MAX; flow++) {
+        _check_frames(flow);
+    }
+    _check_ctx_change();
+    for (unsigned flows = 1; flows <= FLOWS_MAX; flows *= 2) {
+        _run(flows, true, _run(flows, false, 0));
+    }
+
+    puts("[SUCCESS]");
+    return 0;
+}
@@ -0,0 +1,27 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2026 Mesotic SAS
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import sys
+from testrunner import run
+
+
+RESULT_REGEXP = (r"{{ \"flows\" : {flows}, \"cache\" : {cache}, \"packets\" : \d+, \"us\" : \d+, "
+                 r"\"ns_per_packet\" : \d+, \"saved_ns_per_packet\" : -?\d+, "
+                 r"\"hits\" : \d+, \"misses\" : \d+, \"hit_rate\" : \d+ }}")
+
+
+def testfunc(child):
+    child.expect(r"{ \"board\" : \"[^\"]+\", \"cache_size\" : \d+, \"contexts\" : \d+ }")
+    for flows in (1, 2, 4, 8):
+        child.expect(RESULT_REGEXP.format(flows=flows, cache=0))
+        child.expect(RESULT_REGEXP.format(flows=flows, cache=1))
+    child.expect_exact("[SUCCESS]")
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc, timeout=120))
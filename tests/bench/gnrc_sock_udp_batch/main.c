@@ -0,0 +1,166 @@
+/*
+ * Copyright (C) 2026 Mesotic SAS
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       UDP throughput of single and batched sock calls
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "net/ipv6/addr.h"
+#include "net/sock/udp.h"
+#include "sema.h"
+#include "thread.h"
+#include "ztimer.h"
+
+#include "gnrc_sock_udp_batch.h"
+
+#ifndef DATAGRAMS_NUMOF
+#define DATAGRAMS_NUMOF     (4096U)
+#endif
+
+#define BATCH_MAX           (GNRC_SOCK_MBOX_SIZE)
+#define PAYLOAD_SIZE        (32U)
+#define PORT                (5683U)
+
+/* above main, so a whole batch is queued before the receiver runs */
+#define SENDER_PRIO         (THREAD_PRIORITY_MAIN - 1)
+
+static char _stack[THREAD_STACKSIZE_DEFAULT];
+static sema_t _start = SEMA_CREATE_LOCKED();
+static sema_t _consumed = SEMA_CREATE_LOCKED();
+
+static sock_udp_t _sock;
+static sock_udp_ep_t _remote = { .family = AF_INET6, .port = PORT };
+
+static uint8_t _payload[PAYLOAD_SIZE];
+static uint8_t _bufs[BATCH_MAX][PAYLOAD_SIZE];
+static gnrc_sock_udp_batch_rx_t _rx[BATCH_MAX];
+
+static unsigned _batch;
+static bool _batched;
+
+static void *_sender(void *arg)
+{
+    iolist_t snip = { .iol_base = _payload, .iol_len = sizeof(_payload) };
+    gnrc_sock_udp_batch_tx_t tx[BATCH_MAX];
+
+    (void)arg;
+    for (unsigned i = 0; i < BATCH_MAX; i++) {
+        tx[i] = (gnrc_sock_udp_batch_tx_t){ .snips = &snip, .remote = &_remote };
+    }
+
+    while (1) {
+        sema_wait(&_start);
+        for (unsigned sent = 0; sent < DATAGRAMS_NUMOF; sent += _batch) {
+            if (_batched) {
+                if (gnrc_sock_udp_send_batch(NULL, tx, _batch) != (int)_batch) {
+                    puts("sending batch failed");
+                }
+            }
+            else {
+                for (unsigned i = 0; i < _batch; i++) {
+                    if (sock_udp_send(NULL, _payload, sizeof(_payload),
+                                      &_remote) < 0) {
+                        puts("send failed");
+                    }
+                }
+            }
+            /* keep the mailbox of the receiving sock from overflowing */
+            sema_wait(&_consumed);
+        }
+    }
+
+    return NULL;
+}
+
+static int _receive(void)
+{
+    if (_batched) {
+        return gnrc_sock_udp_recv_batch(&_sock, _rx, _batch, SOCK_NO_TIMEOUT);
+    }
+
+    for (unsigned i = 0; i < _batch; i++) {
+        int res = sock_udp_recv(&_sock, _bufs[0], sizeof(_bufs[0]),
+                                SOCK_NO_TIMEOUT, NULL);
+        if (res < 0) {
+            return res;
+        }
+    }
+    return _batch;
+}
+
+static int _run(bool batched, unsigned batch)
+{
+    unsigned received = 0;
+
+    _batched = batched;
+    _batch = batch;
+
+    uint32_t start = ztimer_now(ZTIMER_USEC);
+    sema_post(&_start);
+    while (received < DATAGRAMS_NUMOF) {
+        unsigned burst = 0;
+
+        while (burst < batch) {
+            int res = _receive();
+            if (res < 0) {
+                printf("receive failed: %d\n", res);
+                return res;
+            }
+            burst += res;
+        }
+        received += burst;
+        sema_post(&_consumed);
+    }
+    uint32_t elapsed = ztimer_now(ZTIMER_USEC) - start;
+
+    printf("{ \"bench\" : \"%s\", \"batch\" : %u, \"datagrams\" : %u, "
+           "\"us\" : %" PRIu32 ", \"per_sec\" : %" PRIu32 " }\n",
+           batched ? "batch" : "single", batch, received, elapsed,
+           (uint32_t)(((uint64_t)received * US_PER_SEC) / elapsed));
+    return 0;
+}
+
+int main(void)
+{
+    sock_udp_ep_t local = { .family = AF_INET6, .port = PORT };
+    int res = 0;
+
+    memcpy(&_remote.addr.ipv6, &ipv6_addr_loopback, sizeof(ipv6_addr_t));
+    for (unsigned i = 0; i < BATCH_MAX; i++) {
+        _rx[i] = (gnrc_sock_udp_batch_rx_t){ .data = _bufs[i],
+                                             .max_len = sizeof(_bufs[i]) };
+    }
+    if (sock_udp_create(&_sock, &local, NULL, 0) < 0) {
+        puts("unable to create sock");
+        return 1;
+    }
+    thread_create(_stack, sizeof(_stack), SENDER_PRIO, 0, _sender, NULL,
+                  "sender");
+
+    printf("{ \"board\" : \"%s\", \"payload\" : %u }\n", RIOT_BOARD,
+           PAYLOAD_SIZE);
+    for (unsigned batch = 1; batch <= BATCH_MAX; batch *= 2) {
+        res |= _run(false, batch);
+        res |= _run(true, batch);
+    }
+
+    if (res == 0) {
+        puts("[SUCCESS]");
+    }
+    return res;
+}
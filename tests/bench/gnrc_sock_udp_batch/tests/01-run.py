@@ -0,0 +1,28 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2026 Mesotic SAS
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import sys
+from testrunner import run
+
+
+RESULT_REGEXP = (r"{{ \"bench\" : \"{bench}\", \"batch\" : {batch}, \"datagrams\" : \d+, "
+                 r"\"us\" : \d+, \"per_sec\" : \d+ }}")
+
+
+def testfunc(child):
+    child.expect(r"{ \"board\" : \"[^\"]+\", \"payload\" : \d+ }")
+    batch = 1
+    while batch <= 8:
+        for bench in ("single", "batch"):
+            child.expect(RESULT_REGEXP.format(bench=bench, batch=batch))
+        batch *= 2
+    child.expect_exact("[SUCCESS]")
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc, timeout=120))
@@ -0,0 +1,600 @@
+/*
+ * Copyright (C) 2026 Mesotic SAS
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       GNRC TCP receive goodput over a lossy link
+ *
+ * @}
+ */
+
+#include <errno.h>
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "byteorder.h"
+#include "irq.h"
+#include "msg.h"
+#include "net/ethernet.h"
+#include "net/ethertype.h"
+#include "net/gnrc/ipv6/nib.h"
+#include "net/gnrc/netif/ethernet.h"
+#include "net/gnrc/tcp.h"
+#include "net/inet_csum.h"
+#include "net/ipv6/hdr.h"
+#include "net/netdev_test.h"
+#include "net/protnum.h"
+#include "net/tcp.h"
+#include "test_utils/expect.h"
+#include "thread.h"
+#include "ztimer.h"
+
+#ifndef TRANSFER_SIZE
+#define TRANSFER_SIZE       (128UL * 1024UL)
+#endif
+
+/* the sender keeps at most this many segments in flight */
+#ifndef PEER_WND_SEGS
+#define PEER_WND_SEGS       (8U)
+#endif
+
+#ifndef PEER_RTO_MS
+#define PEER_RTO_MS         (200U)
+#endif
+
+#define SEG_SIZE            (CONFIG_GNRC_TCP_MSS)
+#define SEGS_NUMOF          ((TRANSFER_SIZE + SEG_SIZE - 1) / SEG_SIZE)
+#define PORT                (8080U)
+#define PEER_ISS            (0x1000U)
+
+#define TCP_FIN             (0x01)
+#define TCP_SYN             (0x02)
+#define TCP_RST             (0x04)
+#define TCP_ACK             (0x10)
+
+#define FRAME_SIZE          (sizeof(ethernet_hdr_t) + sizeof(ipv6_hdr_t) + \
+                             sizeof(tcp_hdr_t) + 40 + SEG_SIZE)
+#define FRAMES_NUMOF        (4U)
+#define ACKS_NUMOF          (16U)
+
+#define PEER_MSG_ACK        (0x4101)
+#define PEER_MSG_RUN        (0x4102)
+
+/* above main, which reads the data, so the link never waits for it */
+#define PEER_PRIO           (THREAD_PRIORITY_MAIN + 1)
+
+typedef struct {
+    uint32_t ack;
+    uint32_t seq;
+    uint16_t wnd;
+    uint8_t ctl;
+    uint8_t sack_perm;
+    uint8_t sack_numof;
+    uint32_t sack[8];
+} _ack_t;
+
+static const uint16_t _loss[] = { 0, 10, 20, 50, 100 }; /* in permille */
+
+static const uint8_t _mac[] = { 0x02, 0x00, 0x00, 0x00, 0x00, 0x01 };
+static const uint8_t _peer_mac[] = { 0x02, 0x00, 0x00, 0x00, 0x00, 0x02 };
+static ipv6_addr_t _addr, _peer_addr;
+
+static gnrc_netif_t _netif;
+static netdev_test_t _netdev;
+static char _netif_stack[THREAD_STACKSIZE_DEFAULT];
+static char _peer_stack[THREAD_STACKSIZE_DEFAULT];
+static msg_t _peer_queue[8];
+static kernel_pid_t _peer_pid;
+
+static uint8_t _frames[FRAMES_NUMOF][FRAME_SIZE];
+static uint16_t _frame_lens[FRAMES_NUMOF];
+static unsigned _frames_head, _frames_numof;
+
+static _ack_t _acks[ACKS_NUMOF];
+static unsigned _acks_head, _acks_numof;
+
+static gnrc_tcp_tcb_queue_t _queue = GNRC_TCP_TCB_QUEUE_INIT;
+static gnrc_tcp_tcb_t _tcb;
+static uint8_t _buf[SEG_SIZE];
+
+static struct {
+    uint32_t irs;       /* initial sequence number of the receiver */
+    uint32_t una;
+    uint32_t nxt;
+    uint32_t recover;   /* end of the current loss recovery */
+    uint16_t rwnd;
+    uint16_t loss;
+    unsigned dupacks;
+    bool recovery;
+    bool sack_perm;
+    bool sacked[SEGS_NUMOF];
+    bool retransmitted[SEGS_NUMOF];
+    unsigned segments;
+    unsigned timeouts;
+    uint32_t state;
+} _peer;
+
+static uint8_t _pattern(uint32_t pos)
+{
+    return pos ^ (pos >> 8);
+}
+
+static uint32_t _rand(void)
+{
+    /* xorshift32, all runs see the same loss pattern */
+    _peer.state ^= _peer.state << 13;
+    _peer.state ^= _peer.state >> 17;
+    _peer.state ^= _peer.state << 5;
+    return _peer.state;
+}
+
+static int _netdev_send(netdev_t *dev, const iolist_t *iolist)
+{
+    uint8_t frame[sizeof(ethernet_hdr_t) + sizeof(ipv6_hdr_t) + 60];
+    size_t len = 0;
+
+    (void)dev;
+    for (const iolist_t *iol = iolist; iol; iol = iol->iol_next) {
+        size_t chunk = iol->iol_len;
+
+        if (chunk > sizeof(frame) - len) {
+            chunk = sizeof(frame) - len;
+        }
+        memcpy(&frame[len], iol->iol_base, chunk);
+        len += chunk;
+    }
+
+    ipv6_hdr_t *ipv6 = (ipv6_hdr_t *)&frame[sizeof(ethernet_hdr_t)];
+    tcp_hdr_t *tcp = (tcp_hdr_t *)(ipv6 + 1);
+
+    if (len < sizeof(ethernet_hdr_t) + sizeof(ipv6_hdr_t) + sizeof(tcp_hdr_t) ||
+        ipv6->nh != PROTNUM_TCP) {
+        /* neighbor discovery and the like */
+        return iolist_size(iolist);
+    }
+
+    unsigned state = irq_disable();
+    if (_acks_numof == ACKS_NUMOF) {
+        /* the peer is behind, lose the ACK */
+        irq_restore(state);
+        return iolist_size(iolist);
+    }
+    _ack_t *ack = &_acks[(_acks_head + _acks_numof++) % ACKS_NUMOF];
+    irq_restore(state);
+
+    uint16_t off_ctl = byteorder_ntohs(tcp->off_ctl);
+    uint8_t *opt = (uint8_t *)(tcp + 1);
+    uint8_t *end = (uint8_t *)tcp + ((off_ctl >> 12) * 4);
+
+    memset(ack, 0, sizeof(*ack));
+    ack->ack = byteorder_ntohl(tcp->ack_num);
+    ack->seq = byteorder_ntohl(tcp->seq_num);
+    ack->wnd = byteorder_ntohs(tcp->window);
+    ack->ctl = off_ctl & 0x3f;
+    while (opt < end && opt < &frame[len] && *opt != TCP_OPTION_KIND_EOL) {
+        if (*opt == TCP_OPTION_KIND_NOP) {
+            opt++;
+            continue;
+        }
+        if (opt[0] == TCP_OPTION_KIND_SACK_PERM) {
+            ack->sack_perm = 1;
+        }
+        else if (opt[0] == TCP_OPTION_KIND_SACK) {
+            ack->sack_numof = (opt[1] - TCP_OPTION_LENGTH_MIN) / TCP_OPTION_LENGTH_SACK_BLOCK;
+            for (unsigned i = 0; i < 2U * ack->sack_numof; i++) {
+                ack->sack[i] = byteorder_bebuftohl(&opt[2 + 4 * i]);
+            }
+        }
+        opt += opt[1];
+    }
+
+    msg_t msg = { .type = PEER_MSG_ACK };
+    msg_try_send(&msg, _peer_pid);
+    return iolist_size(iolist);
+}
+
+static int _netdev_recv(netdev_t *dev, char *buf, int len, void *info)
+{
+    int res;
+
+    (void)dev;
+    (void)info;
+    if (_frames_numof == 0) {
+        return 0;
+    }
+    res = _frame_lens[_frames_head];
+    if (buf == NULL) {
+        if (len > 0) {
+            _frames_head = (_frames_head + 1) % FRAMES_NUMOF;
+            _frames_numof--;
+        }
+        return res;
+    }
+    if (len < res) {
+        return -ENOBUFS;
+    }
+    memcpy(buf, _frames[_frames_head], res);
+    _frames_head = (_frames_head + 1) % FRAMES_NUMOF;
+    _frames_numof--;
+    return res;
+}
+
+static void _netdev_isr(netdev_t *dev)
+{
+    while (_frames_numof > 0) {
+        dev->event_callback(dev, NETDEV_EVENT_RX_COMPLETE);
+    }
+}
+
+static int _get_device_type(netdev_t *dev, void *value, size_t max_len)
+{
+    (void)dev;
+    expect(max_len == sizeof(uint16_t));
+    *((uint16_t *)value) = NETDEV_TYPE_ETHERNET;
+    return sizeof(uint16_t);
+}
+
+static int _get_max_packet_size(netdev_t *dev, void *value, size_t max_len)
+{
+    (void)dev;
+    expect(max_len == sizeof(uint16_t));
+    *((uint16_t *)value) = ETHERNET_DATA_LEN;
+    return sizeof(uint16_t);
+}
+
+static int _get_address(netdev_t *dev, void *value, size_t max_len)
+{
+    (void)dev;
+    expect(max_len >= sizeof(_mac));
+    memcpy(value, _mac, sizeof(_mac));
+    return sizeof(_mac);
+}
+
+/* Sends a segment from the peer to the TCP under test */
+static void _send(uint32_t seq, uint8_t ctl, size_t pay_len)
+{
+    unsigned state;
+
+    while (_frames_numof == FRAMES_NUMOF) {
+        ztimer_sleep(ZTIMER_USEC, 100);
+    }
+
+    uint8_t *frame = _frames[(_frames_head + _frames_numof) % FRAMES_NUMOF];
+    ethernet_hdr_t *eth = (ethernet_hdr_t *)frame;
+    ipv6_hdr_t *ipv6 = (ipv6_hdr_t *)(eth + 1);
+    tcp_hdr_t *tcp = (tcp_hdr_t *)(ipv6 + 1);
+    uint8_t *opt = (uint8_t *)(tcp + 1);
+    size_t opt_len = 0;
+
+    if (ctl & TCP_SYN) {
+        network_uint16_t mss = byteorder_htons(SEG_SIZE);
+
+        opt[0] = TCP_OPTION_KIND_MSS;
+        opt[1] = TCP_OPTION_LENGTH_MSS;
+        memcpy(&opt[2], &mss, sizeof(mss));
+        opt[4] = TCP_OPTION_KIND_NOP;
+        opt[5] = TCP_OPTION_KIND_NOP;
+        opt[6] = TCP_OPTION_KIND_SACK_PERM;
+        opt[7] = TCP_OPTION_LENGTH_SACK_PERM;
+        opt_len = 8;
+    }
+    for (size_t i = 0; i < pay_len; i++) {
+        opt[opt_len + i] = _pattern(seq - PEER_ISS - 1 + i);
+    }
+
+    uint16_t tcp_len = sizeof(tcp_hdr_t) + opt_len + pay_len;
+
+    memcpy(eth->dst, _mac, sizeof(_mac));
+    memcpy(eth->src, _peer_mac, sizeof(_peer_mac));
+    eth->type = byteorder_htons(ETHERTYPE_IPV6);
+    memset(ipv6, 0, sizeof(*ipv6));
+    ipv6_hdr_set_version(ipv6);
+    ipv6->len = byteorder_htons(tcp_len);
+    ipv6->nh = PROTNUM_TCP;
+    ipv6->hl = 64;
+    ipv6->src = _peer_addr;
+    ipv6->dst = _addr;
+    memset(tcp, 0, sizeof(*tcp));
+    tcp->src_port = byteorder_htons(PORT + 1);
+    tcp->dst_port = byteorder_htons(PORT);
+    tcp->seq_num = byteorder_htonl(seq);
+    tcp->ack_num = byteorder_htonl((ctl & TCP_ACK) ? _peer.irs + 1 : 0);
+    tcp->off_ctl = byteorder_htons((((sizeof(tcp_hdr_t) + opt_len) / 4) << 12) | ctl);
+    tcp->window = byteorder_htons(UINT16_MAX);
+
+    uint16_t csum = ipv6_hdr_inet_csum(0, ipv6, PROTNUM_TCP, tcp_len);
+    csum = ~inet_csum(csum, (uint8_t *)tcp, tcp_len);
+    tcp->checksum = byteorder_htons(csum ? csum : 0xffff);
+
+    state = irq_disable();
+    _frame_lens[(_frames_head + _frames_numof) % FRAMES_NUMOF] =
+        sizeof(ethernet_hdr_t) + sizeof(ipv6_hdr_t) + tcp_len;
+    _frames_numof++;
+    irq_restore(state);
+    netdev_trigger_event_isr(&_netdev.netdev.netdev);
+}
+
+static uint32_t _seg_seq(unsigned idx)
+{
+    return PEER_ISS + 1 + idx * SEG_SIZE;
+}
+
+static size_t _seg_len(unsigned idx)
+{
+    return (idx == SEGS_NUMOF - 1) ? TRANSFER_SIZE - idx * SEG_SIZE : SEG_SIZE;
+}
+
+static unsigned _seg_idx(uint32_t seq)
+{
+    return (seq - PEER_ISS - 1) / SEG_SIZE;
+}
+
+static void _send_seg(unsigned idx)
+{
+    _peer.segments++;
+    if ((_rand() % 1000) < _peer.loss) {
+        /* lost on the link */
+        return;
+    }
+    _send(_seg_seq(idx), TCP_ACK, _seg_len(idx));
+}
+
+static bool _pop_ack(_ack_t *ack)
+{
+    unsigned state = irq_disable();
+
+    if (_acks_numof == 0) {
+        irq_restore(state);
+        return false;
+    }
+    *ack = _acks[_acks_head];
+    _acks_head = (_acks_head + 1) % ACKS_NUMOF;
+    _acks_numof--;
+    irq_restore(state);
+    return true;
+}
+
+static void _handle_ack(const _ack_t *ack)
+{
+    const uint32_t end = PEER_ISS + 1 + TRANSFER_SIZE;
+    uint32_t highest = _peer.una;
+
+    for (unsigned i = 0; i < ack->sack_numof; i++) {
+        uint32_t left = ack->sack[2 * i];
+        uint32_t right = ack->sack[2 * i + 1];
+
+        for (unsigned idx = _seg_idx(left); idx < SEGS_NUMOF; idx++) {
+            if ((int32_t)(_seg_seq(idx) + _seg_len(idx) - right) > 0) {
+                break;
+            }
+            if ((int32_t)(_seg_seq(idx) - left) >= 0) {
+                _peer.sacked[idx] = true;
+            }
+        }
+        if ((int32_t)(right - highest) > 0) {
+            highest = right;
+        }
+    }
+
+    if ((int32_t)(ack->ack - _peer.una) > 0 && (int32_t)(ack->ack - end) <= 0) {
+        _peer.una = ack->ack;
+        _peer.dupacks = 0;
+        if ((int32_t)(_peer.nxt - _peer.una) < 0) {
+            _peer.nxt = _peer.una;
+            /* the receiver may have dropped SACKed data, RFC 2018, section 8 */
+            memset(_peer.sacked, 0, sizeof(_peer.sacked));
+        }
+        if (_peer.recovery) {
+            if ((int32_t)(_peer.una - _peer.recover) >= 0) {
+                _peer.recovery = false;
+            }
+            else if (_peer.una != end && !_peer.sacked[_seg_idx(_peer.una)]) {
+                /* partial ACK, NewReno retransmits the next hole */
+                _send_seg(_seg_idx(_peer.una));
+            }
+        }
+    }
+    else if (ack->ack == _peer.una && ack->wnd == _peer.rwnd &&
+             _peer.nxt != _peer.una && ++_peer.dupacks == 3 && !_peer.recovery) {
+        /* fast retransmit */
+        _peer.recovery = true;
+        _peer.recover = _peer.nxt;
+        memset(_peer.retransmitted, 0, sizeof(_peer.retransmitted));
+        _peer.retransmitted[_seg_idx(_peer.una)] = true;
+        _send_seg(_seg_idx(_peer.una));
+    }
+    _peer.rwnd = ack->wnd;
+
+    /* with SACK, retransmit every hole below the highest SACKed byte once */
+    if (_peer.recovery && ack->sack_numof > 0) {
+        for (unsigned idx = _seg_idx(_peer.una); idx < _seg_idx(highest); idx++) {
+            if (!_peer.sacked[idx] && !_peer.retransmitted[idx]) {
+                _peer.retransmitted[idx] = true;
+                _send_seg(idx);
+            }
+        }
+    }
+}
+
+static void _send_new(void)
+{
+    const uint32_t end = PEER_ISS + 1 + TRANSFER_SIZE;
+    uint32_t wnd = PEER_WND_SEGS * SEG_SIZE;
+
+    if (_peer.rwnd < wnd) {
+        wnd = _peer.rwnd;
+    }
+    while (_peer.nxt != end) {
+        unsigned idx = _seg_idx(_peer.nxt);
+
+        if ((_peer.nxt + _seg_len(idx)) - _peer.una > wnd) {
+            break;
+        }
+        if (!_peer.sacked[idx]) {
+            _send_seg(idx);
+        }
+        _peer.nxt += _seg_len(idx);
+    }
+}
+
+static void _peer_run(uint16_t loss)
+{
+    const uint32_t end = PEER_ISS + 1 + TRANSFER_SIZE;
+    unsigned state;
+    _ack_t ack;
+    msg_t msg;
+
+    state = irq_disable();
+    _acks_numof = 0;
+    irq_restore(state);
+
+    memset(&_peer, 0, sizeof(_peer));
+    _peer.loss = loss;
+    _peer.state = 0x2545f491;
+    _peer.una = PEER_ISS + 1;
+    _peer.nxt = PEER_ISS + 1;
+
+    /* three way handshake, without losses */
+    _send(PEER_ISS, TCP_SYN, 0);
+    while (1) {
+        if (ztimer_msg_receive_timeout(ZTIMER_MSEC, &msg, PEER_RTO_MS) < 0) {
+            _send(PEER_ISS, TCP_SYN, 0);
+        }
+        if (_pop_ack(&ack) && (ack.ctl & (TCP_SYN | TCP_ACK)) == (TCP_SYN | TCP_ACK)) {
+            break;
+        }
+    }
+    _peer.irs = ack.seq;
+    _peer.rwnd = ack.wnd;
+    _peer.sack_perm = ack.sack_perm;
+    _send(PEER_ISS + 1, TCP_ACK, 0);
+
+    _send_new();
+    while (_peer.una != end) {
+        if (ztimer_msg_receive_timeout(ZTIMER_MSEC, &msg, PEER_RTO_MS) < 0) {
+            /* retransmission timeout, go back to the first unacknowledged byte */
+            _peer.timeouts++;
+            _peer.recovery = false;
+            _peer.dupacks = 0;
+            _peer.nxt = _peer.una;
+            /* the receiver may have dropped SACKed data, RFC 2018, section 8 */
+            memset(_peer.sacked, 0, sizeof(_peer.sacked));
+        }
+        while (_pop_ack(&ack)) {
+            _handle_ack(&ack);
+        }
+        _send_new();
+    }
+}
+
+static void *_peer_thread(void *arg)
+{
+    msg_t msg;
+
+    (void)arg;
+    msg_init_queue(_peer_queue, ARRAY_SIZE(_peer_queue));
+    while (1) {
+        msg_receive(&msg);
+        /* ACKs that arrive between runs are stale */
+        if (msg.type != PEER_MSG_RUN) {
+            continue;
+        }
+        _peer_run(msg.content.value);
+        msg_send(&msg, msg.sender_pid);
+    }
+    return NULL;
+}
+
+static int _run(uint16_t loss)
+{
+    gnrc_tcp_tcb_t *tcb;
+    uint32_t received = 0;
+    msg_t msg = { .type = PEER_MSG_RUN, .content.value = loss };
+    ssize_t res;
+
+    /* the peer runs whenever this thread waits for data */
+    msg_send(&msg, _peer_pid);
+    expect(gnrc_tcp_accept(&_queue, &tcb, GNRC_TCP_NO_TIMEOUT) == 0);
+
+    uint32_t start = ztimer_now(ZTIMER_USEC);
+    while (received < TRANSFER_SIZE) {
+        res = gnrc_tcp_recv(tcb, _buf, sizeof(_buf), GNRC_TCP_NO_TIMEOUT);
+        if (res <= 0) {
+            printf("recv failed: %d\n", (int)res);
+            return -1;
+        }
+        for (ssize_t i = 0; i < res; i++) {
+            if (_buf[i] != _pattern(received + i)) {
+                printf("data mismatch at %" PRIu32 "\n", received + (uint32_t)i);
+                return -1;
+            }
+        }
+        received += res;
+    }
+    uint32_t us = ztimer_now(ZTIMER_USEC) - start;
+
+    /* the listening TCB takes the next connection, once the peer is done */
+    gnrc_tcp_abort(tcb);
+    msg_receive(&msg);
+
+    printf("{ \"loss\" : %u, \"sack\" : %u, \"bytes\" : %lu, \"us\" : %" PRIu32 ", "
+           "\"bytes_per_sec\" : %" PRIu32 ", \"segments\" : %u, \"timeouts\" : %u }\n",
+           loss, (unsigned)_peer.sack_perm, (unsigned long)TRANSFER_SIZE, us,
+           (uint32_t)(((uint64_t)TRANSFER_SIZE * US_PER_SEC) / us),
+           _peer.segments, _peer.timeouts);
+    return 0;
+}
+
+int main(void)
+{
+    gnrc_tcp_ep_t local;
+    int res = 0;
+
+    netdev_test_setup(&_netdev, 0);
+    netdev_test_set_send_cb(&_netdev, _netdev_send);
+    netdev_test_set_recv_cb(&_netdev, _netdev_recv);
+    netdev_test_set_isr_cb(&_netdev, _netdev_isr);
+    netdev_test_set_get_cb(&_netdev, NETOPT_DEVICE_TYPE, _get_device_type);
+    netdev_test_set_get_cb(&_netdev, NETOPT_MAX_PDU_SIZE, _get_max_packet_size);
+    netdev_test_set_get_cb(&_netdev, NETOPT_ADDRESS, _get_address);
+    expect(gnrc_netif_ethernet_create(&_netif, _netif_stack, sizeof(_netif_stack),
+                                      GNRC_NETIF_PRIO, "lossy_link",
+                                      &_netdev.netdev.netdev) == 0);
+
+    /* static addresses and neighbor, so nothing waits for DAD or NUD */
+    ipv6_addr_from_str(&_addr, "2001:db8::1");
+    ipv6_addr_from_str(&_peer_addr, "2001:db8::2");
+    expect(gnrc_netif_ipv6_addr_add(&_netif, &_addr, 64,
+                                    GNRC_NETIF_IPV6_ADDRS_FLAGS_STATE_VALID) > 0);
+    expect(gnrc_ipv6_nib_nc_set(&_peer_addr, _netif.pid, _peer_mac,
+                                sizeof(_peer_mac)) == 0);
+
+    _peer_pid = thread_create(_peer_stack, sizeof(_peer_stack), PEER_PRIO, 0,
+                              _peer_thread, NULL, "peer");
+
+    expect(gnrc_tcp_ep_from_str(&local, "[2001:db8::1]:8080") == 0);
+    gnrc_tcp_tcb_init(&_tcb);
+    expect(gnrc_tcp_listen(&_queue, &_tcb, 1, &local) == 0);
+
+    printf("{ \"board\" : \"%s\", \"ooo\" : %u, \"window\" : %u, \"segment\" : %u }\n",
+           RIOT_BOARD, (unsigned)IS_USED(MODULE_GNRC_TCP_OOO),
+           (unsigned)GNRC_TCP_RCV_BUF_SIZE, (unsigned)SEG_SIZE);
+
+    for (unsigned i = 0; i < ARRAY_SIZE(_loss); i++) {
+        res |= _run(_loss[i]);
+    }
+
+    if (res == 0) {
+        puts("[SUCCESS]");
+    }
+    return res;
+}
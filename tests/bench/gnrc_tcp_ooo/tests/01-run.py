@@ -0,0 +1,26 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2026 Mesotic SAS
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import sys
+from testrunner import run
+
+
+RESULT_REGEXP = (r"{{ \"loss\" : {loss}, \"sack\" : [01], \"bytes\" : \d+, \"us\" : \d+, "
+                 r"\"bytes_per_sec\" : \d+, \"segments\" : \d+, \"timeouts\" : \d+ }}")
+
+
+def testfunc(child):
+    child.expect(r"{ \"board\" : \"[^\"]+\", \"ooo\" : [01], \"window\" : \d+, "
+                 r"\"segment\" : \d+ }")
+    for loss in (0, 10, 20, 50, 100):
+        child.expect(RESULT_REGEXP.format(loss=loss))
+    child.expect_exact("[SUCCESS]")
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc, timeout=120))
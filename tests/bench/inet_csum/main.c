@@ -0,0 +1,89 @@
+/*
+ * Copyright (C) 2026 Mesotic SAS
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Throughput benchmark for the Internet checksum
+ *
+ * @}
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+
+#include "benchmark.h"
+#include "macros/utils.h"
+#include "net/inet_csum.h"
+
+#ifndef BENCH_RUNS
+#define BENCH_RUNS          (10UL * 1000UL)
+#endif
+
+#define MAX_SIZE            (1280U)
+
+/* one additional byte to measure at an odd address */
+static uint32_t _buf[(MAX_SIZE / sizeof(uint32_t)) + 1];
+static const unsigned _sizes[] = { 20, 64, 256, MAX_SIZE };
+static volatile uint16_t _sum;
+
+/* adds one 16-bit word per iteration */
+static uint16_t _reference(uint16_t sum, const uint8_t *buf, uint16_t len)
+{
+    uint32_t csum = sum;
+
+    for (unsigned i = 0; i < (len >> 1U); buf += 2, i++) {
+        csum += (uint16_t)(*buf << 8) + *(buf + 1);
+    }
+    if (len & 1) {
+        csum += (uint16_t)(*buf << 8);
+    }
+    while (csum >> 16) {
+        csum = (csum & 0xffff) + (csum >> 16);
+    }
+    return csum;
+}
+
+int main(void)
+{
+    uint8_t *aligned = (uint8_t *)_buf;
+    uint8_t *odd = aligned + 1;
+    char name[32];
+    int res = 0;
+
+    puts("inet_csum benchmark\n");
+
+    for (unsigned i = 0; i < sizeof(_buf); i++) {
+        aligned[i] = (i * 131) + 7;
+    }
+
+    for (unsigned i = 0; i < ARRAY_SIZE(_sizes); i++) {
+        unsigned size = _sizes[i];
+
+        if ((inet_csum(0, aligned, size) != _reference(0, aligned, size)) ||
+            (inet_csum(0, odd, size) != _reference(0, odd, size))) {
+            printf("checksum mismatch for size %u\n", size);
+            res = 1;
+        }
+
+        printf("size: %u\n", size);
+        snprintf(name, sizeof(name), "aligned (%u)", size);
+        BENCHMARK_FUNC(name, BENCH_RUNS, _sum = inet_csum(0, aligned, size));
+        snprintf(name, sizeof(name), "odd (%u)", size);
+        BENCHMARK_FUNC(name, BENCH_RUNS, _sum = inet_csum(0, odd, size));
+        snprintf(name, sizeof(name), "reference (%u)", size);
+        BENCHMARK_FUNC(name, BENCH_RUNS, _sum = _reference(0, aligned, size));
+    }
+
+    if (res == 0) {
+        puts("\n[SUCCESS]");
+    }
+    return res;
+}
@@ -0,0 +1,125 @@
+/*
+ * Copyright (C) 2026 Mesotic SAS
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Benchmark for nanoCoAP cache lookups over the number of entries
+ *
+ * @}
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "benchmark.h"
+#include "hashes/sha256.h"
+#include "net/nanocoap/cache.h"
+
+#ifndef BENCH_RUNS
+#define BENCH_RUNS          (10UL * 1000UL)
+#endif
+
+#define KEYS_NUMOF          (2 * CONFIG_NANOCOAP_CACHE_ENTRIES)
+
+static uint8_t _keys[KEYS_NUMOF][CONFIG_NANOCOAP_CACHE_KEY_LENGTH];
+static uint8_t _resp_buf[16];
+static coap_pkt_t _resp;
+
+static unsigned _numof;
+static unsigned _next;
+static uint32_t _rand_state = 1;
+
+/* xorshift32, cheap enough not to hide the cost of a lookup */
+static unsigned _rand(void)
+{
+    _rand_state ^= _rand_state << 13;
+    _rand_state ^= _rand_state >> 17;
+    _rand_state ^= _rand_state << 5;
+    return _rand_state;
+}
+
+static void _init_keys(void)
+{
+    uint8_t digest[SHA256_DIGEST_LENGTH];
+
+    for (unsigned i = 0; i < KEYS_NUMOF; i++) {
+        sha256(&i, sizeof(i), digest);
+        memcpy(_keys[i], digest, CONFIG_NANOCOAP_CACHE_KEY_LENGTH);
+    }
+}
+
+static void _init_resp(void)
+{
+    uint8_t token[2] = { 0xDA, 0xEC };
+    size_t len = coap_build_hdr((coap_hdr_t *)_resp_buf, COAP_TYPE_NON,
+                                token, sizeof(token), COAP_CODE_205, 0xABCD);
+
+    coap_pkt_init(&_resp, _resp_buf, sizeof(_resp_buf), len);
+    coap_opt_finish(&_resp, COAP_OPT_FINISH_NONE);
+}
+
+static int _fill(unsigned numof)
+{
+    nanocoap_cache_init();
+    for (unsigned i = 0; i < numof; i++) {
+        if (!nanocoap_cache_add_by_key(_keys[i], COAP_METHOD_GET, &_resp,
+                                       coap_get_total_len(&_resp))) {
+            return -1;
+        }
+    }
+    _numof = numof;
+    return 0;
+}
+
+static void _lookup_hit(void)
+{
+    /* keys [0, _numof) are stored in the cache. Take them in random order,
+     * in order the hit entry is anywhere in the LRU list, not always the
+     * least recently used one. */
+    if (!nanocoap_cache_key_lookup(_keys[_rand() % _numof])) {
+        puts("unexpected cache miss");
+    }
+}
+
+static void _lookup_miss(void)
+{
+    /* keys [CONFIG_NANOCOAP_CACHE_ENTRIES, KEYS_NUMOF) are never stored */
+    if (nanocoap_cache_key_lookup(_keys[CONFIG_NANOCOAP_CACHE_ENTRIES + _next])) {
+        puts("unexpected cache hit");
+    }
+    _next = (_next + 1) % _numof;
+}
+
+int main(void)
+{
+    char name[32];
+
+    puts("nanoCoAP cache lookup benchmark\n");
+
+    _init_keys();
+    _init_resp();
+
+    for (unsigned numof = 4; numof <= CONFIG_NANOCOAP_CACHE_ENTRIES; numof *= 2) {
+        if (_fill(numof)) {
+            printf("failed to fill cache with %u entries\n", numof);
+            return 1;
+        }
+        printf("entries: %u\n", numof);
+        snprintf(name, sizeof(name), "lookup hit (%u)", numof);
+        BENCHMARK_FUNC(name, BENCH_RUNS, _lookup_hit());
+        _next = 0;
+        snprintf(name, sizeof(name), "lookup miss (%u)", numof);
+        BENCHMARK_FUNC(name, BENCH_RUNS, _lookup_miss());
+    }
+
+    puts("\n[SUCCESS]");
+    return 0;
+}
@@ -0,0 +1,27 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2026 Mesotic SAS
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import sys
+from testrunner import run
+
+
+BENCHMARK_REGEXP = r"\s+lookup {kind} \(\d+\):\s+\d+us\s+---\s+\d*\.*\d+us per call\s+---\s+\d+ calls per sec"
+
+
+def testfunc(child):
+    child.expect_exact("nanoCoAP cache lookup benchmark")
+    while True:
+        idx = child.expect([r"entries: \d+\r\n", r"\[SUCCESS\]"])
+        if idx == 1:
+            break
+        child.expect(BENCHMARK_REGEXP.format(kind="hit"))
+        child.expect(BENCHMARK_REGEXP.format(kind="miss"))
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc))
@@ -0,0 +1,87 @@
+/*
+ * Copyright (C) 2026 Mesotic SAS
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Host time spent in ztimer_sleep() with virtual time on native
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <time.h>
+
+#include "test_utils/expect.h"
+#include "ztimer.h"
+
+#ifndef SLEEPS_NUMOF
+#define SLEEPS_NUMOF        (10U)
+#endif
+
+/* spin for that long between sleeps, which must not be skipped */
+#define BUSY_US             (1000U)
+
+static const uint32_t _periods_us[] = { 1000, 100000, 1000000, 60000000 };
+
+static uint64_t _host_us(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ((uint64_t)ts.tv_sec * 1000000U) + (ts.tv_nsec / 1000U);
+}
+
+static void _busy(void)
+{
+    uint32_t start = ztimer_now(ZTIMER_USEC);
+
+    while ((ztimer_now(ZTIMER_USEC) - start) < BUSY_US) {}
+}
+
+static void _run(uint32_t period_us)
+{
+    uint32_t start, late_max = 0;
+    uint64_t virt = 0, host;
+
+    host = _host_us();
+    for (unsigned i = 0; i < SLEEPS_NUMOF; i++) {
+        uint32_t slept;
+
+        _busy();
+        start = ztimer_now(ZTIMER_USEC);
+        ztimer_sleep(ZTIMER_USEC, period_us);
+        slept = ztimer_now(ZTIMER_USEC) - start;
+        expect(slept >= period_us);
+        if ((slept - period_us) > late_max) {
+            late_max = slept - period_us;
+        }
+        virt += slept + BUSY_US;
+    }
+    host = _host_us() - host;
+
+    printf("{ \"period_us\" : %" PRIu32 ", \"sleeps\" : %u, \"virtual_us\" : %" PRIu64
+           ", \"host_us\" : %" PRIu64 ", \"speedup\" : %" PRIu64
+           ", \"late_max_us\" : %" PRIu32 " }\n",
+           period_us, SLEEPS_NUMOF, virt, host, host ? virt / host : 0, late_max);
+}
+
+int main(void)
+{
+    printf("{ \"board\" : \"%s\" }\n", RIOT_BOARD);
+
+    for (unsigned i = 0; i < ARRAY_SIZE(_periods_us); i++) {
+        _run(_periods_us[i]);
+    }
+
+    puts("[SUCCESS]");
+    return 0;
+}
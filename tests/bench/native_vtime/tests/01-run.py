@@ -0,0 +1,25 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2026 Mesotic SAS
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import sys
+from testrunner import run
+
+
+RESULT_REGEXP = (r"{{ \"period_us\" : {period}, \"sleeps\" : \d+, \"virtual_us\" : \d+, "
+                 r"\"host_us\" : \d+, \"speedup\" : \d+, \"late_max_us\" : \d+ }}")
+
+
+def testfunc(child):
+    child.expect(r"{ \"board\" : \"[^\"]+\" }")
+    for period in (1000, 100000, 1000000, 60000000):
+        child.expect(RESULT_REGEXP.format(period=period))
+    child.expect_exact("[SUCCESS]")
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc, timeout=30))
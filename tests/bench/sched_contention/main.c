@@ -0,0 +1,340 @@
+/*
+ * Copyright (C) 2026 Mesotic SAS
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Contention benchmark for mutex, msg, cond and the scheduler
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "cond.h"
+#include "msg.h"
+#include "mutex.h"
+#include "sched.h"
+#include "thread.h"
+#include "ztimer.h"
+
+#ifndef THREADS_MAX
+#define THREADS_MAX         (8U)
+#endif
+
+#ifndef SAMPLES_NUMOF
+#define SAMPLES_NUMOF       (256U)
+#endif
+
+/* number of priority changes timed as one sample */
+#ifndef CHANGE_PRIO_BATCH
+#define CHANGE_PRIO_BATCH   (256U)
+#endif
+
+#define QUEUE_SIZE          (4U)
+
+static char _stacks[THREADS_MAX][THREAD_STACKSIZE_DEFAULT];
+static uint32_t _samples[SAMPLES_NUMOF];
+static msg_t _queue[QUEUE_SIZE];
+
+static volatile unsigned _count;
+static volatile unsigned _exited;
+static volatile bool _done;
+static volatile uint32_t _t0;
+
+static mutex_t _mutexes[THREADS_MAX];
+static cond_t _cond;
+static volatile unsigned _generation;
+static kernel_pid_t _main_pid;
+
+static inline uint32_t _now(void)
+{
+    return ztimer_now(ZTIMER_USEC);
+}
+
+static void _sample(uint32_t value)
+{
+    if (_count < SAMPLES_NUMOF) {
+        _samples[_count++] = value;
+    }
+    _done = (_count == SAMPLES_NUMOF);
+}
+
+static int _cmp(const void *a, const void *b)
+{
+    uint32_t x = *(const uint32_t *)a, y = *(const uint32_t *)b;
+
+    return (x > y) - (x < y);
+}
+
+static void _reset(void)
+{
+    _count = 0;
+    _exited = 0;
+    _done = false;
+}
+
+static void _report(const char *bench, unsigned threads, const char *unit)
+{
+    unsigned n = _count;
+
+    qsort(_samples, n, sizeof(_samples[0]), _cmp);
+    printf("{ \"bench\" : \"%s\", \"threads\" : %u, \"unit\" : \"%s\", "
+           "\"samples\" : %u, \"min\" : %" PRIu32 ", \"p50\" : %" PRIu32 ", \"p90\" : %" PRIu32
+           ", \"p99\" : %" PRIu32 ", \"max\" : %" PRIu32 " }\n",
+           bench, threads, unit, n, _samples[0], _samples[(n * 50) / 100],
+           _samples[(n * 90) / 100], _samples[(n * 99) / 100], _samples[n - 1]);
+}
+
+/* threads with a higher priority than main run until they block right away */
+static kernel_pid_t _create(unsigned idx, uint8_t prio, thread_task_func_t func,
+                            void *arg)
+{
+    return thread_create(_stacks[idx], sizeof(_stacks[idx]), prio, 0, func,
+                         arg, "contender");
+}
+
+/* waits for all threads with lower or equal priority to finish */
+static void _join(unsigned threads)
+{
+    while (_exited < threads) {
+        ztimer_sleep(ZTIMER_USEC, 100);
+    }
+}
+
+static void _mutex_turn(void)
+{
+    mutex_t *mutex = &_mutexes[0];
+
+    while (1) {
+        mutex_lock(mutex);
+        if (_done) {
+            mutex_unlock(mutex);
+            return;
+        }
+        _sample(_now() - _t0);
+        _t0 = _now();
+        mutex_unlock(mutex);
+    }
+}
+
+static void *_mutex_handoff_thread(void *arg)
+{
+    (void)arg;
+    _mutex_turn();
+    _exited++;
+    return NULL;
+}
+
+static void _mutex_handoff(unsigned threads)
+{
+    mutex_t *mutex = &_mutexes[0];
+
+    mutex_lock(mutex);
+    for (unsigned i = 0; i < threads; i++) {
+        _create(i, THREAD_PRIORITY_MAIN, _mutex_handoff_thread, NULL);
+    }
+    /* let every thread block on the mutex */
+    thread_yield();
+    _t0 = _now();
+    mutex_unlock(mutex);
+    _mutex_turn();
+    _join(threads);
+    _report("mutex_handoff", threads, "us");
+}
+
+static void *_msg_sender_thread(void *arg)
+{
+    msg_t msg = { .type = 0 };
+
+    (void)arg;
+    while (!_done) {
+        msg_send(&msg, _main_pid);
+    }
+    _exited++;
+    return NULL;
+}
+
+static void _msg_queue_full(unsigned threads)
+{
+    msg_t msg;
+
+    for (unsigned i = 0; i < threads; i++) {
+        /* the senders fill the queue and block */
+        _create(i, THREAD_PRIORITY_MAIN - 1, _msg_sender_thread, NULL);
+    }
+    while (!_done) {
+        uint32_t start = _now();
+
+        msg_receive(&msg);
+        _sample(_now() - start);
+    }
+    /* unblock the remaining senders, they stop once their message is taken */
+    while (_exited < threads) {
+        msg_receive(&msg);
+    }
+    while (msg_try_receive(&msg) >= 0) {}
+    _report("msg_queue_full", threads, "us");
+}
+
+static void *_mutex_chain_thread(void *arg)
+{
+    unsigned idx = (uintptr_t)arg;
+
+    if (idx < _count) {
+        /* not the last link, hold the mutex the next link waits for */
+        mutex_lock(&_mutexes[idx]);
+    }
+    mutex_lock(&_mutexes[idx - 1]);
+    if (idx == _count) {
+        _samples[_exited] = _now() - _t0;
+    }
+    else {
+        mutex_unlock(&_mutexes[idx]);
+    }
+    mutex_unlock(&_mutexes[idx - 1]);
+    return NULL;
+}
+
+static void _mutex_chain(unsigned threads)
+{
+    unsigned rounds = SAMPLES_NUMOF;
+
+    /* _count holds the length of the chain, _exited the number of rounds */
+    _count = threads;
+    for (_exited = 0; _exited < rounds; _exited++) {
+        mutex_lock(&_mutexes[0]);
+        for (unsigned i = 1; i <= threads; i++) {
+            uint8_t prio = (i < THREAD_PRIORITY_MAIN) ? THREAD_PRIORITY_MAIN - i : 0;
+
+            /* each thread blocks on the previous link */
+            _create(i - 1, prio, _mutex_chain_thread, (void *)(uintptr_t)i);
+        }
+        _t0 = _now();
+        mutex_unlock(&_mutexes[0]);
+    }
+    _count = rounds;
+    _report("mutex_chain", threads, "us");
+}
+
+static void *_runnable_thread(void *arg)
+{
+    (void)arg;
+    while (!_done) {
+        thread_yield();
+    }
+    _exited++;
+    return NULL;
+}
+
+static void _sched_change_priority(unsigned threads)
+{
+    thread_t *thread = NULL;
+
+    for (unsigned i = 0; i < threads; i++) {
+        thread = thread_get(_create(i, THREAD_PRIORITY_MAIN + 1, _runnable_thread, NULL));
+    }
+    /* a single call is shorter than a tick of ZTIMER_USEC, so each sample is
+     * the average over a batch of calls in nanoseconds */
+    for (unsigned i = 0; i < SAMPLES_NUMOF; i++) {
+        uint32_t start = _now();
+
+        for (unsigned j = 0; j < CHANGE_PRIO_BATCH; j++) {
+            sched_change_priority(thread, THREAD_PRIORITY_MAIN + 1 + (j & 1));
+        }
+        _samples[i] = ((_now() - start) * 1000) / CHANGE_PRIO_BATCH;
+    }
+    _count = SAMPLES_NUMOF;
+    _done = true;
+    _join(threads);
+    _report("sched_change_priority", threads, "ns");
+}
+
+static void *_cond_thread(void *arg)
+{
+    mutex_t *mutex = &_mutexes[0];
+    unsigned generation = 0;
+
+    (void)arg;
+    mutex_lock(mutex);
+    while (1) {
+        while (generation == _generation) {
+            cond_wait(&_cond, mutex);
+        }
+        if (_done) {
+            break;
+        }
+        generation = _generation;
+        _sample(_now() - _t0);
+    }
+    mutex_unlock(mutex);
+    _exited++;
+    return NULL;
+}
+
+static void _cond_broadcast(unsigned threads)
+{
+    mutex_t *mutex = &_mutexes[0];
+
+    _generation = 0;
+    cond_init(&_cond);
+    for (unsigned i = 0; i < threads; i++) {
+        _create(i, THREAD_PRIORITY_MAIN - 1, _cond_thread, NULL);
+    }
+    while (1) {
+        /* all threads are waiting once main gets the mutex */
+        mutex_lock(mutex);
+        bool done = _count + threads > SAMPLES_NUMOF;
+
+        _done = done;
+        _generation++;
+        _t0 = _now();
+        cond_broadcast(&_cond);
+        mutex_unlock(mutex);
+        if (done) {
+            break;
+        }
+    }
+    _join(threads);
+    _report("cond_broadcast", threads, "us");
+}
+
+int main(void)
+{
+    static void (* const benches[])(unsigned) = {
+        _mutex_handoff,
+        _msg_queue_full,
+        _mutex_chain,
+        _sched_change_priority,
+        _cond_broadcast,
+    };
+
+    _main_pid = thread_getpid();
+    msg_init_queue(_queue, QUEUE_SIZE);
+    for (unsigned i = 0; i < THREADS_MAX; i++) {
+        mutex_init(&_mutexes[i]);
+    }
+
+    printf("{ \"board\" : \"%s\", \"threads_max\" : %u, "
+           "\"change_prio_batch\" : %u }\n",
+           RIOT_BOARD, THREADS_MAX, CHANGE_PRIO_BATCH);
+    for (unsigned i = 0; i < sizeof(benches) / sizeof(benches[0]); i++) {
+        for (unsigned threads = 1; threads <= THREADS_MAX; threads *= 2) {
+            _reset();
+            benches[i](threads);
+        }
+    }
+
+    puts("[SUCCESS]");
+    return 0;
+}
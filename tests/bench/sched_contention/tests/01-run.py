@@ -0,0 +1,33 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2026 Mesotic SAS
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import sys
+from testrunner import run
+
+
+RESULT_REGEXP = (r"{{ \"bench\" : \"{bench}\", \"threads\" : \d+, \"unit\" : \"[nu]s\", "
+                 r"\"samples\" : \d+, "
+                 r"\"min\" : \d+, \"p50\" : \d+, \"p90\" : \d+, \"p99\" : \d+, \"max\" : \d+ }}")
+BENCHES = ("mutex_handoff", "msg_queue_full", "mutex_chain",
+           "sched_change_priority", "cond_broadcast")
+
+
+def testfunc(child):
+    child.expect(r"{ \"board\" : \"[^\"]+\", \"threads_max\" : (\d+), "
+                 r"\"change_prio_batch\" : \d+ }")
+    threads_max = int(child.match.group(1))
+    for bench in BENCHES:
+        threads = 1
+        while threads <= threads_max:
+            child.expect(RESULT_REGEXP.format(bench=bench))
+            threads *= 2
+    child.expect_exact("[SUCCESS]")
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc))
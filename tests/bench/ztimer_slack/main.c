@@ -0,0 +1,138 @@
+/*
+ * Copyright (C) 2026 Mesotic SAS
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Interrupts saved by ztimer wakeup coalescing for a mix of
+ *              periodic timers
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+
+#include "container.h"
+#include "test_utils/expect.h"
+#include "ztimer.h"
+#include "ztimer/mock.h"
+
+#ifndef DURATION_MS
+#define DURATION_MS     (3600000LU)
+#endif
+
+typedef struct {
+    ztimer_t timer;
+    uint32_t period;        /**< minimum interval in ms */
+    uint32_t due;           /**< time the timer was due at */
+    uint32_t fired;
+    uint64_t delay;         /**< sum of ms fired after due */
+} periodic_t;
+
+/* minimum intervals in ms of timers found on a 6LoWPAN node: a sensor, gcoap
+ * retransmissions, RPL trickle, NIB neighbor reachability and router
+ * advertisements. Like those protocols do, each interval is extended by a
+ * random amount of up to half its minimum. */
+static const uint32_t _periods[] = {
+    1000,
+    2000, 2300, 2700, 3000,
+    8000, 16000,
+    28000, 29500, 30500, 32000,
+    60000,
+};
+
+static const unsigned _slack_percents[] = { 0, 1, 5, 10, 25 };
+
+#define TIMERS_NUMOF    ARRAY_SIZE(_periods)
+
+static ztimer_mock_t _mock;
+static periodic_t _timers[TIMERS_NUMOF];
+static unsigned _slack_percent;
+static uint32_t _seed;
+
+/* the same pseudo random sequence for every run */
+static uint32_t _random(uint32_t max)
+{
+    _seed = (_seed * 1103515245U) + 12345U;
+    return (_seed >> 16) % max;
+}
+
+static void _set(periodic_t *p)
+{
+    uint32_t interval = p->period + _random(p->period / 2);
+
+    ztimer_set_slack(&_mock.super, &p->timer, interval,
+                     (p->period * _slack_percent) / 100);
+    p->due = _mock.now + interval;
+}
+
+static void _fire(void *arg)
+{
+    periodic_t *p = arg;
+
+    expect((int32_t)(_mock.now - p->due) >= 0);
+    expect(_mock.now - p->due <= (p->period * _slack_percent) / 100);
+    p->delay += _mock.now - p->due;
+    p->fired++;
+    _set(p);
+}
+
+static void _run(void)
+{
+    ztimer_clock_t *clock = &_mock.super;
+    uint32_t start, cpu_us;
+    uint32_t fired = 0;
+    uint64_t delay = 0;
+
+    _seed = 1;
+    ztimer_mock_init(&_mock, 32);
+    for (unsigned i = 0; i < TIMERS_NUMOF; i++) {
+        _timers[i] = (periodic_t){
+            .timer = { .callback = _fire, .arg = &_timers[i] },
+            .period = _periods[i],
+        };
+        _set(&_timers[i]);
+    }
+
+    start = ztimer_now(ZTIMER_USEC);
+    while (_mock.now < DURATION_MS) {
+        expect(_mock.armed);
+        ztimer_mock_advance(&_mock, _mock.target);
+    }
+    cpu_us = ztimer_now(ZTIMER_USEC) - start;
+
+    for (unsigned i = 0; i < TIMERS_NUMOF; i++) {
+        ztimer_remove(clock, &_timers[i].timer);
+        fired += _timers[i].fired;
+        delay += _timers[i].delay;
+    }
+    expect(fired == clock->slack_stats.fired);
+
+    printf("{ \"slack_percent\" : %u, \"timers\" : %u, \"duration_ms\" : %lu, "
+           "\"fired\" : %" PRIu32 ", \"wakeups\" : %" PRIu32 ", "
+           "\"saved\" : %" PRIu32 ", \"coalesced\" : %" PRIu32 ", "
+           "\"avg_delay_ms\" : %" PRIu32 ", \"cpu_us\" : %" PRIu32 " }\n",
+           _slack_percent, (unsigned)TIMERS_NUMOF, (unsigned long)DURATION_MS,
+           fired, clock->slack_stats.wakeups,
+           fired - clock->slack_stats.wakeups, clock->slack_stats.coalesced,
+           (uint32_t)(delay / fired), cpu_us);
+}
+
+int main(void)
+{
+    for (unsigned i = 0; i < ARRAY_SIZE(_slack_percents); i++) {
+        _slack_percent = _slack_percents[i];
+        _run();
+    }
+
+    puts("[SUCCESS]");
+    return 0;
+}
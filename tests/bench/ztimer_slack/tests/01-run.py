@@ -0,0 +1,25 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2026 Mesotic SAS
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import sys
+from testrunner import run
+
+
+RESULT_REGEXP = (r"{{ \"slack_percent\" : {slack}, \"timers\" : \d+, \"duration_ms\" : \d+, "
+                 r"\"fired\" : \d+, \"wakeups\" : \d+, \"saved\" : \d+, "
+                 r"\"coalesced\" : \d+, \"avg_delay_ms\" : \d+, \"cpu_us\" : \d+ }}")
+
+
+def testfunc(child):
+    for slack in (0, 1, 5, 10, 25):
+        child.expect(RESULT_REGEXP.format(slack=slack))
+    child.expect_exact("[SUCCESS]")
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc, timeout=120))
@@ -0,0 +1,126 @@
+/*
+ * Copyright (C) 2026 Mesotic SAS
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Worst case ztimer set / remove latency over the number of timers
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+
+#include "test_utils/expect.h"
+#include "timex.h"
+#include "ztimer.h"
+
+#ifndef NUMOF_TIMERS
+#define NUMOF_TIMERS    (256U)
+#endif
+
+#ifndef REPEAT
+#define REPEAT          (1000U)
+#endif
+
+/* far enough in the future to not trigger while the benchmark runs */
+#ifndef BASE
+#define BASE            (60LU * US_PER_SEC)
+#endif
+
+#ifndef SPREAD
+#define SPREAD          (1000LU)
+#endif
+
+static ztimer_t _timers[NUMOF_TIMERS];
+static ztimer_t _probe;
+static unsigned _triggers;
+
+static void _callback(void *arg)
+{
+    unsigned *triggers = arg;
+    *triggers += 1;
+}
+
+static void _fill(unsigned numof)
+{
+    for (unsigned i = 0; i < numof; i++) {
+        ztimer_set(ZTIMER_USEC, &_timers[i], BASE + (SPREAD * i));
+    }
+}
+
+static void _clear(unsigned numof)
+{
+    for (unsigned i = 0; i < numof; i++) {
+        ztimer_remove(ZTIMER_USEC, &_timers[i]);
+    }
+}
+
+static void _print_avg(uint32_t sum)
+{
+    uint32_t avg = (uint32_t)(((uint64_t)sum * 1000) / REPEAT);
+
+    printf("%4" PRIu32 ".%03" PRIu32 "us", avg / 1000, avg % 1000);
+}
+
+static void _measure(unsigned numof)
+{
+    uint32_t set_sum = 0, set_max = 0;
+    uint32_t del_sum = 0, del_max = 0;
+
+    _fill(numof);
+
+    for (unsigned i = 0; i < REPEAT; i++) {
+        /* the probe expires after all other timers */
+        uint32_t start = ztimer_now(ZTIMER_USEC);
+        ztimer_set(ZTIMER_USEC, &_probe, BASE + (SPREAD * (numof + 1)));
+        uint32_t set = ztimer_now(ZTIMER_USEC);
+        ztimer_remove(ZTIMER_USEC, &_probe);
+        uint32_t del = ztimer_now(ZTIMER_USEC);
+
+        set_sum += set - start;
+        set_max = (set - start > set_max) ? set - start : set_max;
+        del_sum += del - set;
+        del_max = (del - set > del_max) ? del - set : del_max;
+    }
+
+    _clear(numof);
+
+    printf("timers: %4u set: avg ", numof);
+    _print_avg(set_sum);
+    printf(" max %4" PRIu32 "us remove: avg ", set_max);
+    _print_avg(del_sum);
+    printf(" max %4" PRIu32 "us\n", del_max);
+}
+
+int main(void)
+{
+    printf("ztimer timing wheel benchmark (%s)\n",
+           IS_USED(MODULE_ZTIMER_WHEEL) ? "wheel" : "list");
+
+    for (unsigned i = 0; i < NUMOF_TIMERS; i++) {
+        _timers[i].callback = _callback;
+        _timers[i].arg = &_triggers;
+    }
+    _probe.callback = _callback;
+    _probe.arg = &_triggers;
+
+    _measure(0);
+    for (unsigned numof = 16; numof < NUMOF_TIMERS; numof *= 4) {
+        _measure(numof);
+    }
+    _measure(NUMOF_TIMERS);
+
+    expect(!_triggers);
+    puts("[SUCCESS]");
+
+    return 0;
+}
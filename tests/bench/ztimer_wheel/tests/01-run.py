@@ -0,0 +1,26 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2026 Mesotic SAS
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import sys
+from testrunner import run
+
+
+RESULT_REGEXP = (r"timers:\s+\d+ set: avg\s+\d+\.\d+us max\s+\d+us "
+                 r"remove: avg\s+\d+\.\d+us max\s+\d+us")
+
+
+def testfunc(child):
+    child.expect(r"ztimer timing wheel benchmark \((wheel|list)\)")
+    while True:
+        idx = child.expect([RESULT_REGEXP, r"\[SUCCESS\]"])
+        if idx == 1:
+            break
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc))
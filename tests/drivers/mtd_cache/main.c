@@ -0,0 +1,160 @@
+/*
+ * Copyright (C) 2026 Mesotic SAS
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Compares the erases of small writes with and without mtd_cache
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "container.h"
+#include "mtd.h"
+#include "mtd_cache.h"
+#include "mtd_emulated.h"
+
+#define SECTOR_COUNT        (16U)
+#define PAGES_PER_SECTOR    (4U)
+#define PAGE_SIZE           (256U)
+#define SECTOR_SIZE         (PAGES_PER_SECTOR * PAGE_SIZE)
+#define MTD_SIZE            (SECTOR_COUNT * SECTOR_SIZE)
+
+#ifndef WRITES_NUMOF
+#define WRITES_NUMOF        (1000U)
+#endif
+
+#ifndef CACHE_LINES
+#define CACHE_LINES         (2U)
+#endif
+
+/* most writes go to the first sectors, like file system metadata */
+#define HOT_SIZE            (2 * SECTOR_SIZE)
+
+MTD_EMULATED_DEV(0, SECTOR_COUNT, PAGES_PER_SECTOR, PAGE_SIZE);
+
+static mtd_cache_line_t _lines[CACHE_LINES];
+static uint8_t _cache_buf[CACHE_LINES * SECTOR_SIZE];
+
+static mtd_cache_t _cache = {
+    .mtd.driver = &mtd_cache_driver,
+    .parent = &mtd_emulated_dev0.base,
+    .lines = _lines,
+    .buf = _cache_buf,
+    .lines_numof = ARRAY_SIZE(_lines),
+};
+
+static mtd_desc_t _counting_driver;
+static unsigned _erases;
+
+static uint8_t _ref[MTD_SIZE];
+static uint8_t _read[MTD_SIZE];
+static uint32_t _state;
+
+static int _erase_sector(mtd_dev_t *dev, uint32_t sector, uint32_t count)
+{
+    _erases += count;
+    return _mtd_emulated_driver.erase_sector(dev, sector, count);
+}
+
+static int _erase(mtd_dev_t *dev, uint32_t addr, uint32_t count)
+{
+    _erases += count / SECTOR_SIZE;
+    return _mtd_emulated_driver.erase(dev, addr, count);
+}
+
+static uint32_t _rand(void)
+{
+    /* xorshift32, both runs write the same data */
+    _state ^= _state << 13;
+    _state ^= _state >> 17;
+    _state ^= _state << 5;
+    return _state;
+}
+
+static int _run(mtd_dev_t *dev, const char *name)
+{
+    uint8_t buf[64];
+
+    _state = 0x2545f491;
+    _erases = 0;
+    memset(_ref, 0xff, sizeof(_ref));
+
+    if (mtd_init(dev) || mtd_erase_sector(dev, 0, SECTOR_COUNT)) {
+        printf("%s: init failed\n", name);
+        return -1;
+    }
+
+    for (unsigned i = 0; i < WRITES_NUMOF; i++) {
+        uint32_t region = (_rand() % 4) ? HOT_SIZE : MTD_SIZE;
+        uint32_t len = 8 + (_rand() % (sizeof(buf) - 8));
+        uint32_t addr = _rand() % (region - len);
+
+        for (unsigned j = 0; j < len; j++) {
+            buf[j] = _rand();
+        }
+        memcpy(&_ref[addr], buf, len);
+
+        if (mtd_write_page(dev, buf, addr / PAGE_SIZE, addr % PAGE_SIZE, len)) {
+            printf("%s: write %u failed\n", name, i);
+            return -1;
+        }
+    }
+
+    /* flushes the cache */
+    mtd_power(dev, MTD_POWER_DOWN);
+
+    printf("%s: %u writes, %u erases", name, WRITES_NUMOF, _erases);
+    if (dev == &_cache.mtd) {
+        printf(", %" PRIu32 " hits, %" PRIu32 " misses, %" PRIu32 " writebacks",
+               _cache.stats.hits, _cache.stats.misses, _cache.stats.writebacks);
+    }
+    puts("");
+
+    if (mtd_read(dev, _read, 0, sizeof(_read)) ||
+        memcmp(_read, _ref, sizeof(_ref))) {
+        printf("%s: data mismatch\n", name);
+        return -1;
+    }
+    if (memcmp(mtd_emulated_dev0.memory, _ref, sizeof(_ref))) {
+        printf("%s: data mismatch on the backing device\n", name);
+        return -1;
+    }
+
+    return 0;
+}
+
+int main(void)
+{
+    int res = 0;
+    unsigned direct;
+
+    _counting_driver = _mtd_emulated_driver;
+    _counting_driver.erase_sector = _erase_sector;
+    _counting_driver.erase = _erase;
+    mtd_emulated_dev0.base.driver = &_counting_driver;
+
+    printf("mtd_cache benchmark (%u sectors of %u bytes, %u cache lines)\n\n",
+           SECTOR_COUNT, SECTOR_SIZE, CACHE_LINES);
+
+    res |= _run(&mtd_emulated_dev0.base, "direct");
+    direct = _erases;
+    res |= _run(&_cache.mtd, "cache");
+
+    if (res == 0 && _erases < direct) {
+        puts("\n[SUCCESS]");
+    }
+    return res;
+}
@@ -0,0 +1,23 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2026 Mesotic SAS
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import sys
+from testrunner import run
+
+
+def testfunc(child):
+    child.expect(r"direct: (\d+) writes, (\d+) erases")
+    direct = int(child.match.group(2))
+    child.expect(r"cache: (\d+) writes, (\d+) erases, (\d+) hits, (\d+) misses")
+    cached = int(child.match.group(2))
+    assert cached < direct
+    child.expect_exact("[SUCCESS]")
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc))
@@ -0,0 +1,31 @@
+/*
+ * Copyright (C) 2026 Mesotic SAS
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Tests the internal NIB API with the hash index enabled
+ *
+ * @}
+ */
+
+#include "embUnit.h"
+
+/* the cases of tests/unittests, built here with
+ * CONFIG_GNRC_IPV6_NIB_HASH_NUMOF > 0 */
+#include "tests-gnrc_ipv6_nib-internal.c"
+
+int main(void)
+{
+    TESTS_START();
+    TESTS_RUN(tests_gnrc_ipv6_nib_internal_tests());
+    TESTS_END();
+    return 0;
+}
@@ -0,0 +1,222 @@
+/*
+ * Copyright (C) 2026 Mesotic SAS
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @{
+ *
+ * @file
+ * @brief       Tests batched frame reception of gnrc_netif
+ *
+ * A mock device holds a number of frames and reports them with
+ * @ref NETOPT_RX_PENDING. A single ISR must drain all of them in batches of at
+ * most @ref CONFIG_GNRC_NETIF_RX_BUDGET frames.
+ *
+ * @}
+ */
+
+#include <errno.h>
+#include <string.h>
+
+#include "embUnit.h"
+#include "msg.h"
+#include "net/gnrc.h"
+#include "net/gnrc/netif/raw.h"
+#include "net/netdev_test.h"
+#include "test_utils/expect.h"
+#include "ztimer.h"
+
+#define NETIF_STACKSIZE     THREAD_STACKSIZE_DEFAULT
+#define NETIF_PRIO          (THREAD_PRIORITY_MAIN - 4)
+#define MAIN_QUEUE_SIZE     (32U)
+#define FRAME_SIZE          (2U)
+#define RECV_TIMEOUT_MS     (100U)
+
+static char _netif_stack[NETIF_STACKSIZE];
+static msg_t _main_msg_queue[MAIN_QUEUE_SIZE];
+
+static gnrc_netif_t _netif;
+static netdev_test_t _dev;
+static gnrc_netreg_entry_t _dump;
+
+/* frames held by the mock device and sequence number of the next one */
+static unsigned _frames_left;
+static uint8_t _seq;
+
+static int _get_device_type(netdev_t *dev, void *value, size_t max_len)
+{
+    (void)dev;
+    expect(max_len == sizeof(uint16_t));
+    /* like slipdev, the other user of gnrc_netif_raw */
+    *((uint16_t *)value) = NETDEV_TYPE_SLIP;
+    return sizeof(uint16_t);
+}
+
+static int _get_rx_pending(netdev_t *dev, void *value, size_t max_len)
+{
+    (void)dev;
+    expect(max_len == sizeof(netopt_enable_t));
+    *((netopt_enable_t *)value) = _frames_left ? NETOPT_ENABLE : NETOPT_DISABLE;
+    return sizeof(netopt_enable_t);
+}
+
+static int _recv(netdev_t *dev, char *buf, int len, void *info)
+{
+    (void)dev;
+    (void)info;
+    if (!_frames_left) {
+        return (buf == NULL) ? 0 : -ENOBUFS;
+    }
+    if ((buf == NULL) && (len == 0)) {
+        return FRAME_SIZE;
+    }
+    if (buf != NULL) {
+        /* first byte 0 so gnrc_netif_raw leaves the type undefined */
+        buf[0] = 0;
+        buf[1] = _seq;
+    }
+    _seq++;
+    _frames_left--;
+    return FRAME_SIZE;
+}
+
+static void _isr(netdev_t *dev)
+{
+    dev->event_callback(dev, NETDEV_EVENT_RX_COMPLETE);
+}
+
+static void _set_up(void)
+{
+    gnrc_netif_rx_batch_stats_t stats;
+
+    _frames_left = 0;
+    _seq = 0;
+    netdev_test_set_get_cb(&_dev, NETOPT_RX_PENDING, _get_rx_pending);
+    gnrc_netif_rx_batch_stats(&_netif, &stats, true);
+}
+
+/* triggers an ISR with the mock holding @p frames frames and checks that
+ * exactly these are passed up in order */
+static void _rx_frames(unsigned frames)
+{
+    msg_t msg;
+
+    _frames_left = frames;
+    netdev_trigger_event_isr(&_dev.netdev.netdev);
+
+    for (unsigned i = 0; i < frames; i++) {
+        gnrc_pktsnip_t *pkt;
+
+        TEST_ASSERT_EQUAL_INT(1, ztimer_msg_receive_timeout(ZTIMER_MSEC, &msg,
+                                                            RECV_TIMEOUT_MS));
+        TEST_ASSERT_EQUAL_INT(GNRC_NETAPI_MSG_TYPE_RCV, msg.type);
+        pkt = msg.content.ptr;
+        TEST_ASSERT_EQUAL_INT(FRAME_SIZE, pkt->size);
+        TEST_ASSERT_EQUAL_INT(i, ((uint8_t *)pkt->data)[1]);
+        gnrc_pktbuf_release(pkt);
+    }
+    TEST_ASSERT_EQUAL_INT(0, _frames_left);
+    /* no further events read from the drained device */
+    TEST_ASSERT(ztimer_msg_receive_timeout(ZTIMER_MSEC, &msg,
+                                           RECV_TIMEOUT_MS) < 0);
+}
+
+static void test_rx_batch__single(void)
+{
+    gnrc_netif_rx_batch_stats_t stats;
+
+    _rx_frames(1);
+    gnrc_netif_rx_batch_stats(&_netif, &stats, false);
+    TEST_ASSERT_EQUAL_INT(1, stats.events);
+    TEST_ASSERT_EQUAL_INT(1, stats.frames);
+    TEST_ASSERT_EQUAL_INT(0, stats.budget_exhausted);
+    TEST_ASSERT_EQUAL_INT(1, stats.hist[0]);
+}
+
+static void test_rx_batch__budget_exhausted(void)
+{
+    const unsigned rest = CONFIG_GNRC_NETIF_RX_BUDGET / 2;
+    gnrc_netif_rx_batch_stats_t stats;
+
+    /* two full batches, the rest is read from the event posted by the second */
+    _rx_frames((2 * CONFIG_GNRC_NETIF_RX_BUDGET) + rest);
+    gnrc_netif_rx_batch_stats(&_netif, &stats, false);
+    TEST_ASSERT_EQUAL_INT(3, stats.events);
+    TEST_ASSERT_EQUAL_INT((2 * CONFIG_GNRC_NETIF_RX_BUDGET) + rest,
+                          stats.frames);
+    TEST_ASSERT_EQUAL_INT(2, stats.budget_exhausted);
+    /* CONFIG_GNRC_NETIF_RX_BUDGET (8) and rest (4) fall into buckets 3 and 2 */
+    TEST_ASSERT_EQUAL_INT(2, stats.hist[3]);
+    TEST_ASSERT_EQUAL_INT(1, stats.hist[2]);
+}
+
+static void test_rx_batch__budget_drained(void)
+{
+    gnrc_netif_rx_batch_stats_t stats;
+
+    /* the device is empty after the last frame of the second batch, so no
+     * third event is posted */
+    _rx_frames(2 * CONFIG_GNRC_NETIF_RX_BUDGET);
+    gnrc_netif_rx_batch_stats(&_netif, &stats, false);
+    TEST_ASSERT_EQUAL_INT(2, stats.events);
+    TEST_ASSERT_EQUAL_INT(2 * CONFIG_GNRC_NETIF_RX_BUDGET, stats.frames);
+    TEST_ASSERT_EQUAL_INT(1, stats.budget_exhausted);
+}
+
+static void test_rx_batch__pending_unsupported(void)
+{
+    gnrc_netif_rx_batch_stats_t stats;
+    msg_t msg;
+
+    /* without NETOPT_RX_PENDING only one frame is read per ISR */
+    netdev_test_set_get_cb(&_dev, NETOPT_RX_PENDING, NULL);
+    _frames_left = 2;
+    netdev_trigger_event_isr(&_dev.netdev.netdev);
+    TEST_ASSERT_EQUAL_INT(1, ztimer_msg_receive_timeout(ZTIMER_MSEC, &msg,
+                                                        RECV_TIMEOUT_MS));
+    gnrc_pktbuf_release(msg.content.ptr);
+    TEST_ASSERT(ztimer_msg_receive_timeout(ZTIMER_MSEC, &msg,
+                                           RECV_TIMEOUT_MS) < 0);
+    TEST_ASSERT_EQUAL_INT(1, _frames_left);
+    gnrc_netif_rx_batch_stats(&_netif, &stats, false);
+    TEST_ASSERT_EQUAL_INT(1, stats.events);
+    TEST_ASSERT_EQUAL_INT(1, stats.frames);
+    TEST_ASSERT_EQUAL_INT(0, stats.budget_exhausted);
+}
+
+static Test *tests_gnrc_netif_rx_batch(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture(test_rx_batch__single),
+        new_TestFixture(test_rx_batch__budget_exhausted),
+        new_TestFixture(test_rx_batch__budget_drained),
+        new_TestFixture(test_rx_batch__pending_unsupported),
+    };
+
+    EMB_UNIT_TESTCALLER(tests, _set_up, NULL, fixtures);
+
+    return (Test *)&tests;
+}
+
+int main(void)
+{
+    msg_init_queue(_main_msg_queue, MAIN_QUEUE_SIZE);
+    netdev_test_setup(&_dev, NULL);
+    netdev_test_set_get_cb(&_dev, NETOPT_DEVICE_TYPE, _get_device_type);
+    netdev_test_set_recv_cb(&_dev, _recv);
+    netdev_test_set_isr_cb(&_dev, _isr);
+    gnrc_netif_raw_create(&_netif, _netif_stack, sizeof(_netif_stack),
+                          NETIF_PRIO, "netdev_test", &_dev.netdev.netdev);
+    gnrc_netreg_entry_init_pid(&_dump, GNRC_NETREG_DEMUX_CTX_ALL,
+                               thread_getpid());
+    gnrc_netreg_register(GNRC_NETTYPE_UNDEF, &_dump);
+
+    TESTS_START();
+    TESTS_RUN(tests_gnrc_netif_rx_batch());
+    TESTS_END();
+    return 0;
+}
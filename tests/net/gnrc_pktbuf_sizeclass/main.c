@@ -0,0 +1,31 @@
+/*
+ * Copyright (C) 2026 Mesotic SAS
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Tests the packet buffer with the size class allocator
+ *
+ * @}
+ */
+
+#include "embUnit.h"
+
+/* the cases of tests/unittests, built here with
+ * gnrc_pktbuf_static_sizeclass */
+#include "tests-pktbuf.c"
+
+int main(void)
+{
+    TESTS_START();
+    TESTS_RUN(tests_pktbuf_tests());
+    TESTS_END();
+    return 0;
+}
@@ -28,6 +28,7 @@
 #include "xtimer.h"
 
 #include "constants.h"
+#include "gnrc_sock_udp_batch.h"
 #include "stack.h"
 
 #define _TEST_BUFFER_SIZE   (128)
@@ -518,6 +519,137 @@ static void test_sock_udp_recv_buf__success(void)
     expect(_check_net());
 }
 
+static void test_gnrc_sock_udp_recv_batch__truncated(void)
+{
+    static const ipv6_addr_t src_addr = { .u8 = _TEST_ADDR_REMOTE };
+    static const ipv6_addr_t dst_addr = { .u8 = _TEST_ADDR_LOCAL };
+    static const sock_udp_ep_t local = { .family = AF_INET6,
+                                         .port = _TEST_PORT_LOCAL };
+    uint8_t short_buf[4];
+    gnrc_sock_udp_batch_rx_t msgs[3] = {
+        { .data = short_buf, .max_len = sizeof(short_buf) },
+        { .data = _test_buffer, .max_len = sizeof(_test_buffer) },
+        { .data = _test_buffer, .max_len = sizeof(_test_buffer) },
+    };
+
+    expect(0 == sock_udp_create(&_sock, &local, NULL, SOCK_FLAGS_REUSE_EP));
+    expect(_inject_packet(&src_addr, &dst_addr, _TEST_PORT_REMOTE,
+                          _TEST_PORT_LOCAL, "ABCDEFGH", sizeof("ABCDEFGH"),
+                          _TEST_NETIF));
+    expect(_inject_packet(&src_addr, &dst_addr, _TEST_PORT_REMOTE,
+                          _TEST_PORT_LOCAL, "IJ", sizeof("IJ"),
+                          _TEST_NETIF));
+    /* only the queued datagrams are taken */
+    expect(2 == gnrc_sock_udp_recv_batch(&_sock, msgs, ARRAY_SIZE(msgs),
+                                  SOCK_NO_TIMEOUT));
+    /* the full length is reported for the truncated datagram */
+    expect(sizeof("ABCDEFGH") == msgs[0].len);
+    expect(memcmp(short_buf, "ABCD", sizeof(short_buf)) == 0);
+    expect(sizeof("IJ") == msgs[1].len);
+    expect(memcmp(_test_buffer, "IJ", sizeof("IJ")) == 0);
+    expect(_TEST_PORT_REMOTE == msgs[1].remote.port);
+    expect(_check_net());
+}
+
+static void test_gnrc_sock_udp_recv_batch__aux(void)
+{
+    static const ipv6_addr_t src_addr = { .u8 = _TEST_ADDR_REMOTE };
+    static const ipv6_addr_t dst_addr = { .u8 = _TEST_ADDR_LOCAL };
+    static const sock_udp_ep_t local = { .family = AF_INET6,
+                                         .port = _TEST_PORT_LOCAL };
+    static const inject_aux_t inject_aux[] = {
+        { .timestamp = 1337, .rssi = -11 },
+        { .timestamp = 4242, .rssi = -42 },
+    };
+    gnrc_sock_udp_batch_rx_t msgs[2] = {
+        { .data = _test_buffer, .max_len = sizeof(_test_buffer),
+          .aux = { .flags = SOCK_AUX_GET_TIMESTAMP | SOCK_AUX_GET_RSSI } },
+        /* the second datagram only asks for the RSSI */
+        { .data = _test_buffer, .max_len = sizeof(_test_buffer),
+          .aux = { .flags = SOCK_AUX_GET_RSSI } },
+    };
+
+    expect(0 == sock_udp_create(&_sock, &local, NULL, SOCK_FLAGS_REUSE_EP));
+    for (unsigned i = 0; i < ARRAY_SIZE(inject_aux); i++) {
+        expect(_inject_packet_aux(&src_addr, &dst_addr, _TEST_PORT_REMOTE,
+                                  _TEST_PORT_LOCAL, "ABCD", sizeof("ABCD"),
+                                  _TEST_NETIF, &inject_aux[i]));
+    }
+    expect(2 == gnrc_sock_udp_recv_batch(&_sock, msgs, ARRAY_SIZE(msgs), 0));
+#if IS_USED(MODULE_SOCK_AUX_TIMESTAMP)
+    expect(!(msgs[0].aux.flags & SOCK_AUX_GET_TIMESTAMP));
+    expect(inject_aux[0].timestamp == msgs[0].aux.timestamp);
+    expect(0 == msgs[1].aux.timestamp);
+#else
+    expect(msgs[0].aux.flags & SOCK_AUX_GET_TIMESTAMP);
+#endif
+#if IS_USED(MODULE_SOCK_AUX_RSSI)
+    expect(!(msgs[0].aux.flags & SOCK_AUX_GET_RSSI));
+    expect(inject_aux[0].rssi == msgs[0].aux.rssi);
+    expect(!(msgs[1].aux.flags & SOCK_AUX_GET_RSSI));
+    expect(inject_aux[1].rssi == msgs[1].aux.rssi);
+#else
+    expect(msgs[0].aux.flags & SOCK_AUX_GET_RSSI);
+    expect(msgs[1].aux.flags & SOCK_AUX_GET_RSSI);
+#endif
+    expect(!(msgs[1].aux.flags & SOCK_AUX_GET_TIMESTAMP));
+    expect(_check_net());
+}
+
+#ifdef MODULE_GNRC_SOCK_CHECK_REUSE
+static char _inject_stack[THREAD_STACKSIZE_DEFAULT];
+
+static void *_inject_wrong(void *arg)
+{
+    static const ipv6_addr_t wrong_addr = { .u8 = _TEST_ADDR_WRONG };
+    static const ipv6_addr_t dst_addr = { .u8 = _TEST_ADDR_LOCAL };
+
+    (void)arg;
+    xtimer_usleep(_TEST_TIMEOUT / 2);
+    expect(_inject_packet(&wrong_addr, &dst_addr, _TEST_PORT_REMOTE,
+                          _TEST_PORT_LOCAL, "ABCD", sizeof("ABCD"),
+                          _TEST_NETIF));
+    return NULL;
+}
+
+static void test_gnrc_sock_udp_recv_batch__EPROTO(void)
+{
+    static const ipv6_addr_t wrong_addr = { .u8 = _TEST_ADDR_WRONG };
+    static const ipv6_addr_t src_addr = { .u8 = _TEST_ADDR_REMOTE };
+    static const ipv6_addr_t dst_addr = { .u8 = _TEST_ADDR_LOCAL };
+    static const sock_udp_ep_t local = { .family = AF_INET6,
+                                         .port = _TEST_PORT_LOCAL };
+    static const sock_udp_ep_t remote = { .addr = { .ipv6 = _TEST_ADDR_REMOTE },
+                                          .family = AF_INET6,
+                                          .port = _TEST_PORT_REMOTE };
+    gnrc_sock_udp_batch_rx_t msgs[2] = {
+        { .data = _test_buffer, .max_len = sizeof(_test_buffer) },
+        { .data = _test_buffer, .max_len = sizeof(_test_buffer) },
+    };
+    uint32_t start;
+
+    expect(0 == sock_udp_create(&_sock, &local, &remote, SOCK_FLAGS_REUSE_EP));
+    /* the datagram of the wrong remote is skipped */
+    expect(_inject_packet(&wrong_addr, &dst_addr, _TEST_PORT_REMOTE,
+                          _TEST_PORT_LOCAL, "ABCD", sizeof("ABCD"),
+                          _TEST_NETIF));
+    expect(_inject_packet(&src_addr, &dst_addr, _TEST_PORT_REMOTE,
+                          _TEST_PORT_LOCAL, "EFGH", sizeof("EFGH"),
+                          _TEST_NETIF));
+    expect(1 == gnrc_sock_udp_recv_batch(&_sock, msgs, ARRAY_SIZE(msgs),
+                                  _TEST_TIMEOUT));
+    expect(memcmp(_test_buffer, "EFGH", sizeof("EFGH")) == 0);
+    /* skipping one in the middle of the timeout does not restart it */
+    start = xtimer_now_usec();
+    thread_create(_inject_stack, sizeof(_inject_stack),
+                  THREAD_PRIORITY_MAIN - 1, 0, _inject_wrong, NULL, "inject");
+    expect(-ETIMEDOUT == gnrc_sock_udp_recv_batch(&_sock, msgs, ARRAY_SIZE(msgs),
+                                           _TEST_TIMEOUT));
+    expect((xtimer_now_usec() - start) < (_TEST_TIMEOUT + _TEST_TIMEOUT / 4));
+    expect(_check_net());
+}
+#endif
+
 static void test_sock_udp_send__EAFNOSUPPORT(void)
 {
     static const sock_udp_ep_t remote = { .addr = { .ipv6 = _TEST_ADDR_REMOTE },
@@ -855,6 +987,11 @@ int main(void)
     CALL(test_sock_udp_recv__non_blocking());
     CALL(test_sock_udp_recv__aux());
     CALL(test_sock_udp_recv_buf__success());
+    CALL(test_gnrc_sock_udp_recv_batch__truncated());
+    CALL(test_gnrc_sock_udp_recv_batch__aux());
+#ifdef MODULE_GNRC_SOCK_CHECK_REUSE
+    CALL(test_gnrc_sock_udp_recv_batch__EPROTO());
+#endif
     _prepare_send_checks();
     CALL(test_sock_udp_send__EAFNOSUPPORT());
     CALL(test_sock_udp_send__EINVAL_addr());
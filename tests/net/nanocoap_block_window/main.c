@@ -0,0 +1,256 @@
+/*
+ * Copyright (C) 2026 Mesotic SAS
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Tests the windowed Block2 download of nanocoap_sock against
+ *              a scripted server on the loopback address
+ *
+ * The server answers the requests of the window out of order, with the last
+ * block first, drops the first request of a block, and sends duplicates of
+ * responses that were already received.
+ *
+ * @}
+ */
+
+#include <string.h>
+
+#include "embUnit.h"
+#include "mutex.h"
+#include "net/nanocoap_sock.h"
+#include "net/sock/udp.h"
+#include "thread.h"
+#include "ztimer.h"
+
+#define BLOCKS_NUMOF    (5U)
+#define BLOCK_SIZE      (16U)
+#define TOKEN_LEN       (4U)
+#define TIMEOUT_US      (2U * US_PER_SEC)
+
+typedef struct {
+    unsigned count;             /**< number of transmissions seen */
+    uint16_t id;                /**< message ID of the last transmission */
+    uint8_t token[TOKEN_LEN];   /**< token of the request */
+} _request_t;
+
+static char _stack[THREAD_STACKSIZE_DEFAULT];
+static sock_udp_t _server;
+static sock_udp_ep_t _client;
+static _request_t _requests[BLOCKS_NUMOF];
+static uint16_t _acked[2 * BLOCKS_NUMOF];
+static unsigned _acked_numof;
+static int _server_res;
+static mutex_t _server_done = MUTEX_INIT_LOCKED;
+
+static uint8_t _received[BLOCKS_NUMOF * BLOCK_SIZE];
+static size_t _received_len;
+
+static uint8_t _data(size_t offset)
+{
+    return (offset * 7) + 1;
+}
+
+/* receives one message, records requests and empty ACKs */
+static int _server_recv(uint32_t timeout)
+{
+    uint8_t buf[64];
+    coap_pkt_t pkt;
+    coap_block1_t block2;
+
+    ssize_t res = sock_udp_recv(&_server, buf, sizeof(buf), timeout, &_client);
+    if (res < 0) {
+        return res;
+    }
+    if (coap_parse(&pkt, buf, res) < 0) {
+        return -EBADMSG;
+    }
+    if (coap_get_type(&pkt) == COAP_TYPE_ACK) {
+        if (coap_get_code_raw(&pkt) != COAP_CODE_EMPTY ||
+            _acked_numof >= ARRAY_SIZE(_acked)) {
+            return -EBADMSG;
+        }
+        _acked[_acked_numof++] = coap_get_id(&pkt);
+        return 0;
+    }
+    if (coap_get_type(&pkt) != COAP_TYPE_CON ||
+        coap_get_token_len(&pkt) != TOKEN_LEN ||
+        !coap_get_block2(&pkt, &block2) || block2.blknum >= BLOCKS_NUMOF ||
+        block2.szx != COAP_BLOCKSIZE_16) {
+        return -EBADMSG;
+    }
+
+    _request_t *req = &_requests[block2.blknum];
+    req->count++;
+    req->id = coap_get_id(&pkt);
+    memcpy(req->token, coap_get_token(&pkt), TOKEN_LEN);
+    return 0;
+}
+
+/* receives until the request for blknum was seen count times */
+static int _server_wait(unsigned blknum, unsigned count)
+{
+    uint32_t start = ztimer_now(ZTIMER_USEC);
+
+    while (_requests[blknum].count < count) {
+        uint32_t passed = ztimer_now(ZTIMER_USEC) - start;
+        int res = (passed < TIMEOUT_US) ? _server_recv(TIMEOUT_US - passed)
+                                        : -ETIMEDOUT;
+        if (res < 0) {
+            return res;
+        }
+    }
+    return 0;
+}
+
+/* sends the response to block blknum as separate CON response with id */
+static int _server_send(unsigned blknum, uint16_t id)
+{
+    uint8_t buf[64];
+    coap_pkt_t pkt;
+    bool more = blknum < (BLOCKS_NUMOF - 1);
+    ssize_t len;
+
+    len = coap_build_hdr((coap_hdr_t *)buf, COAP_TYPE_CON,
+                         _requests[blknum].token, TOKEN_LEN, COAP_CODE_205, id);
+    coap_pkt_init(&pkt, buf, sizeof(buf), len);
+    coap_opt_add_uint(&pkt, COAP_OPT_BLOCK2,
+                      (blknum << 4) | (more << 3) | COAP_BLOCKSIZE_16);
+    len = coap_opt_finish(&pkt, COAP_OPT_FINISH_PAYLOAD);
+    for (unsigned i = 0; i < BLOCK_SIZE; i++) {
+        buf[len + i] = _data((blknum * BLOCK_SIZE) + i);
+    }
+    len = sock_udp_send(&_server, buf, len + BLOCK_SIZE, &_client);
+    return (len < 0) ? len : 0;
+}
+
+static int _server_script(void)
+{
+    int res;
+
+    /* only the first block is requested until its size is confirmed */
+    if ((res = _server_wait(0, 1)) || (res = _server_send(0, 0x100))) {
+        return res;
+    }
+    /* then the rest of the window */
+    for (unsigned i = 1; i < BLOCKS_NUMOF; i++) {
+        if ((res = _server_wait(i, 1))) {
+            return res;
+        }
+    }
+    /* the last block first, block 3 twice, block 1 is lost and the response
+     * to the already delivered block 0 is repeated */
+    if ((res = _server_send(4, 0x104)) || (res = _server_send(3, 0x103)) ||
+        (res = _server_send(3, 0x103)) || (res = _server_send(2, 0x102)) ||
+        (res = _server_send(0, 0x100))) {
+        return res;
+    }
+    /* the retransmission of block 1 completes the resource */
+    if ((res = _server_wait(1, 2)) || (res = _server_send(1, 0x101))) {
+        return res;
+    }
+    /* every CON response is acknowledged, block 0 and 3 twice */
+    while (_acked_numof < 7) {
+        if ((res = _server_recv(TIMEOUT_US))) {
+            return res;
+        }
+    }
+    return 0;
+}
+
+static void *_server_thread(void *arg)
+{
+    (void)arg;
+    _server_res = _server_script();
+    mutex_unlock(&_server_done);
+    return NULL;
+}
+
+static int _block_cb(void *arg, size_t offset, uint8_t *buf, size_t len,
+                     int more)
+{
+    (void)arg;
+    (void)more;
+
+    /* blocks have to be passed on in order */
+    if (offset != _received_len || offset + len > sizeof(_received)) {
+        return -EINVAL;
+    }
+    memcpy(&_received[offset], buf, len);
+    _received_len += len;
+    return 0;
+}
+
+static unsigned _acks_for(uint16_t id)
+{
+    unsigned count = 0;
+
+    for (unsigned i = 0; i < _acked_numof; i++) {
+        count += (_acked[i] == id);
+    }
+    return count;
+}
+
+static void test_nanocoap_block_window__reorder_loss_dup(void)
+{
+    const sock_udp_ep_t local = { .family = AF_INET6, .port = COAP_PORT };
+    sock_udp_ep_t remote = { .family = AF_INET6, .port = COAP_PORT };
+    nanocoap_sock_t sock;
+
+    ipv6_addr_set_loopback((ipv6_addr_t *)&remote.addr.ipv6);
+    TEST_ASSERT_EQUAL_INT(0, sock_udp_create(&_server, &local, NULL, 0));
+    thread_create(_stack, sizeof(_stack), THREAD_PRIORITY_MAIN - 1, 0,
+                  _server_thread, NULL, "server");
+
+    TEST_ASSERT_EQUAL_INT(0, nanocoap_sock_connect(&sock, NULL, &remote));
+    TEST_ASSERT_EQUAL_INT(0, nanocoap_sock_get_blockwise(&sock, "/file",
+                                                         COAP_BLOCKSIZE_16,
+                                                         _block_cb, NULL));
+    mutex_lock(&_server_done);
+    nanocoap_sock_close(&sock);
+    sock_udp_close(&_server);
+
+    TEST_ASSERT_EQUAL_INT(0, _server_res);
+    /* the content arrived complete and in order */
+    TEST_ASSERT_EQUAL_INT(sizeof(_received), _received_len);
+    for (unsigned i = 0; i < sizeof(_received); i++) {
+        TEST_ASSERT_EQUAL_INT(_data(i), _received[i]);
+    }
+    /* only the lost block was requested again */
+    TEST_ASSERT_EQUAL_INT(2, _requests[1].count);
+    for (unsigned i = 2; i < BLOCKS_NUMOF; i++) {
+        TEST_ASSERT_EQUAL_INT(1, _requests[i].count);
+    }
+    /* duplicates were acknowledged as well */
+    TEST_ASSERT_EQUAL_INT(2, _acks_for(0x100));
+    TEST_ASSERT_EQUAL_INT(1, _acks_for(0x101));
+    TEST_ASSERT_EQUAL_INT(1, _acks_for(0x102));
+    TEST_ASSERT_EQUAL_INT(2, _acks_for(0x103));
+    TEST_ASSERT_EQUAL_INT(1, _acks_for(0x104));
+}
+
+static Test *tests_nanocoap_block_window(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture(test_nanocoap_block_window__reorder_loss_dup),
+    };
+
+    EMB_UNIT_TESTCALLER(nanocoap_block_window_tests, NULL, NULL, fixtures);
+
+    return (Test *)&nanocoap_block_window_tests;
+}
+
+int main(void)
+{
+    TESTS_START();
+    TESTS_RUN(tests_nanocoap_block_window());
+    TESTS_END();
+    return 0;
+}
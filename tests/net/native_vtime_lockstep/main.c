@@ -0,0 +1,118 @@
+/*
+ * Copyright (C) 2026 Mesotic SAS
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Two native nodes skipping idle time in lockstep
+ *
+ * Each node multicasts its virtual time once per period, the period depending
+ * on the node ID. The difference between the virtual clocks of the nodes must
+ * stay the same while both of them skip most of the time they sleep.
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "byteorder.h"
+#include "net/ipv6/addr.h"
+#include "net/sock/udp.h"
+#include "periph/cpuid.h"
+#include "test_utils/expect.h"
+#include "thread.h"
+#include "ztimer.h"
+
+#ifndef ROUNDS
+#define ROUNDS          (20U)
+#endif
+
+#define PORT            (4711U)
+#define PERIOD_US       (100000U)
+
+static uint64_t _host_us(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ((uint64_t)ts.tv_sec * 1000000U) + (ts.tv_nsec / 1000U);
+}
+
+int main(void)
+{
+    sock_udp_ep_t local = SOCK_IPV6_EP_ANY;
+    sock_udp_ep_t remote = { .family = AF_INET6, .port = PORT,
+                             .netif = SOCK_ADDR_ANY_NETIF };
+    sock_udp_t sock;
+    uint8_t id[CPUID_LEN];
+    uint32_t period, next, start = 0;
+    int32_t offset = 0;
+    uint32_t received = 0, skew_max = 0;
+    uint64_t host = 0;
+
+    /* nodes started with different IDs sleep for different times */
+    cpuid_get(id);
+    period = PERIOD_US * (1 + (id[0] & 1));
+
+    local.port = PORT;
+    ipv6_addr_set_all_nodes_multicast((ipv6_addr_t *)&remote.addr.ipv6,
+                                      IPV6_ADDR_MCAST_SCP_LINK_LOCAL);
+    expect(sock_udp_create(&sock, &local, NULL, 0) == 0);
+
+    next = ztimer_now(ZTIMER_USEC) + period;
+    for (unsigned sent = 0; sent < ROUNDS;) {
+        uint32_t now = ztimer_now(ZTIMER_USEC);
+        network_uint32_t time;
+
+        if ((int32_t)(next - now) <= 0) {
+            time = byteorder_htonl(now);
+            sock_udp_send(&sock, &time, sizeof(time), &remote);
+            next += period;
+            sent++;
+            continue;
+        }
+
+        if (sock_udp_recv(&sock, &time, sizeof(time), next - now,
+                          NULL) != sizeof(time)) {
+            continue;
+        }
+        now = ztimer_now(ZTIMER_USEC);
+
+        /* the nodes booted at different times, only the difference between
+         * their clocks has to stay the same */
+        int32_t diff = now - byteorder_ntohl(time);
+        if (!received++) {
+            offset = diff;
+            start = now;
+            host = _host_us();
+            continue;
+        }
+        if ((uint32_t)abs(diff - offset) > skew_max) {
+            skew_max = abs(diff - offset);
+        }
+    }
+
+    printf("{ \"period_us\" : %" PRIu32 ", \"received\" : %" PRIu32
+           ", \"skew_max_us\" : %" PRIu32 ", \"virtual_us\" : %" PRIu32
+           ", \"host_us\" : %" PRIu64 " }\n",
+           period, received, skew_max, ztimer_now(ZTIMER_USEC) - start,
+           _host_us() - host);
+    puts("[SUCCESS]");
+
+    /* a node that exits would hold back the other one */
+    while (1) {
+        thread_sleep();
+    }
+
+    return 0;
+}
@@ -0,0 +1,65 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2026 Mesotic SAS
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import os
+import subprocess
+import sys
+
+import pexpect
+
+RIOTBASE = os.getenv("RIOTBASE", os.path.abspath(os.path.join(os.path.dirname(__file__), "../../../")))
+ZEP_DISPATCH_PATH = os.path.join(RIOTBASE, "dist/tools/zep_dispatch/bin/zep_dispatch")
+NODES_NUMOF = 2
+# host jitter between reading the clock and sending or receiving
+SKEW_MAX_US = 20000
+TIMEOUT = 30
+
+RESULT_REGEXP = (r"{ \"period_us\" : (\d+), \"received\" : (\d+), "
+                 r"\"skew_max_us\" : (\d+), \"virtual_us\" : (\d+), "
+                 r"\"host_us\" : (\d+) }")
+
+
+def spawn_node(node_id):
+    env = dict(os.environ)
+    # the node ID selects the period of the node
+    env["TERMFLAGS"] = "--id={}".format(node_id)
+    return pexpect.spawn("make", ["term"], env=env, encoding="utf-8",
+                         timeout=TIMEOUT, logfile=sys.stdout)
+
+
+def testfunc(nodes):
+    periods = set()
+    for node in nodes:
+        node.expect(RESULT_REGEXP)
+        period, received, skew_max, virtual, host = \
+            (int(x) for x in node.match.groups())
+        periods.add(period)
+        assert received > 1
+        # the virtual clocks of both nodes advanced together ...
+        assert skew_max < SKEW_MAX_US
+        # ... while skipping most of the time
+        assert virtual > 2 * host
+        node.expect_exact("[SUCCESS]")
+    assert len(periods) == NODES_NUMOF
+
+
+if __name__ == "__main__":
+    board = os.environ.get('BOARD', 'native')
+    if board not in ['native', 'native64']:
+        print('\x1b[1;31mThis test requires a native board.\x1b[0m\n',
+              file=sys.stderr)
+        sys.exit(1)
+    with subprocess.Popen([ZEP_DISPATCH_PATH, '-l', str(NODES_NUMOF),
+                           '127.0.0.1', '17754']) as zep_dispatch:
+        nodes = [spawn_node(i) for i in range(NODES_NUMOF)]
+        try:
+            testfunc(nodes)
+        finally:
+            for node in nodes:
+                node.terminate(force=True)
+            zep_dispatch.terminate()
@@ -0,0 +1,76 @@
+/*
+ * Copyright (C) 2026 Mesotic SAS
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Tests the slice-by-8 CRC32 implementation against the CRC32
+ *              unittest vectors and a bitwise reference
+ *
+ * @}
+ */
+
+#include <stdint.h>
+
+#include "checksum/crc32.h"
+#include "embUnit.h"
+
+/* the vectors of tests/unittests, built here with module crc32_slice8 */
+#include "tests-checksum-crc32.c"
+
+static uint32_t _crc32_bitwise(const uint8_t *buf, size_t len)
+{
+    uint32_t crc = 0xffffffff;
+
+    while (len--) {
+        crc ^= *buf++;
+        for (unsigned bit = 0; bit < 8; bit++) {
+            crc = (crc >> 1) ^ (0xedb88320 & -(crc & 1));
+        }
+    }
+    return ~crc;
+}
+
+static void test_crc32_slice8_reference(void)
+{
+    static uint8_t buf[300];
+    uint32_t seed = 1;
+
+    for (unsigned i = 0; i < sizeof(buf); i++) {
+        seed = (seed * 1103515245U) + 12345U;
+        buf[i] = seed >> 16;
+    }
+    for (unsigned offset = 0; offset < 8; offset++) {
+        for (size_t len = 0; len <= sizeof(buf) - offset; len += 13) {
+            TEST_ASSERT_EQUAL_INT(_crc32_bitwise(buf + offset, len),
+                                  crc32(buf + offset, len));
+        }
+    }
+}
+
+static Test *tests_crc32_slice8_tests(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture(test_crc32_slice8_reference),
+    };
+
+    EMB_UNIT_TESTCALLER(crc32_slice8_tests, NULL, NULL, fixtures);
+
+    return (Test *)&crc32_slice8_tests;
+}
+
+int main(void)
+{
+    TESTS_START();
+    TESTS_RUN(tests_checksum_crc32_tests());
+    TESTS_RUN(tests_crc32_slice8_tests());
+    TESTS_END();
+    return 0;
+}
@@ -0,0 +1,168 @@
+/*
+ * Copyright (C) 2026 Mesotic SAS
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Priority event queue test application
+ *
+ * @}
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "event/prio_queue.h"
+#include "thread.h"
+#include "test_utils/expect.h"
+
+#define EVENTS_NUMOF    (8U)
+
+static char _stack[THREAD_STACKSIZE_DEFAULT];
+static event_prio_queue_t _queue;
+static event_prio_t _events[EVENTS_NUMOF];
+static char _order[EVENTS_NUMOF + 1];
+static unsigned _order_len;
+
+static void _handler(event_t *event)
+{
+    event_prio_t *ev = (event_prio_t *)event;
+
+    _order[_order_len++] = 'a' + (ev - _events);
+    _order[_order_len] = '\0';
+}
+
+static void _post(unsigned idx, uint8_t level)
+{
+    _events[idx].level = level;
+    event_prio_post(&_queue, &_events[idx]);
+    expect(event_prio_is_queued(&_events[idx]));
+}
+
+/* drains the queue, recording the order the events run in */
+static const char *_drain(void)
+{
+    event_prio_t *event;
+
+    _order_len = 0;
+    _order[0] = '\0';
+    while ((event = event_prio_get(&_queue))) {
+        expect(!event_prio_is_queued(event));
+        event->super.handler(&event->super);
+    }
+    expect(_queue.pending == 0);
+    return _order;
+}
+
+static void _expect_order(const char *expected)
+{
+    const char *order = _drain();
+
+    if (strcmp(order, expected)) {
+        printf("expected \"%s\", got \"%s\"\n", expected, order);
+        puts("[FAILED]");
+        expect(0);
+    }
+}
+
+static void test_order(void)
+{
+    /* FIFO within a level */
+    _post(0, 1);
+    _post(1, 1);
+    _post(2, 1);
+    _expect_order("abc");
+
+    /* most urgent level first, regardless of posting order */
+    _post(0, 3);
+    _post(1, 2);
+    _post(2, 3);
+    _post(3, 0);
+    _post(4, 2);
+    _post(5, 0);
+    _expect_order("dfbeac");
+
+    /* posting a queued event keeps its position */
+    _post(0, 1);
+    _post(1, 1);
+    _post(0, 1);
+    _expect_order("ab");
+    puts("order OK");
+}
+
+static void test_cancel(void)
+{
+    /* only event of its level */
+    _post(0, 2);
+    event_prio_cancel(&_queue, &_events[0]);
+    expect(!event_prio_is_queued(&_events[0]));
+    expect(_queue.pending == 0);
+    _expect_order("");
+
+    /* head, middle and tail */
+    for (unsigned i = 0; i < 5; i++) {
+        _post(i, 1);
+    }
+    event_prio_cancel(&_queue, &_events[0]);
+    event_prio_cancel(&_queue, &_events[2]);
+    event_prio_cancel(&_queue, &_events[4]);
+    /* not queued, nothing happens */
+    event_prio_cancel(&_queue, &_events[4]);
+    _expect_order("bd");
+
+    /* cancelled events can be posted again, at the end of their level */
+    for (unsigned i = 0; i < 3; i++) {
+        _post(i, 0);
+    }
+    event_prio_cancel(&_queue, &_events[0]);
+    _post(0, 0);
+    _post(3, 1);
+    _expect_order("bcad");
+    puts("cancel OK");
+}
+
+static void *_poster(void *arg)
+{
+    (void)arg;
+    _post(6, 3);
+    _post(7, 0);
+    return NULL;
+}
+
+static void test_wait(void)
+{
+    event_prio_t *event;
+
+    /* the poster runs at a higher priority, so both events are queued before
+     * the first one is returned */
+    thread_create(_stack, sizeof(_stack), THREAD_PRIORITY_MAIN - 1,
+                  THREAD_CREATE_STACKTEST, _poster, NULL, "poster");
+    event = event_prio_wait(&_queue);
+    expect(event == &_events[7]);
+    event = event_prio_wait(&_queue);
+    expect(event == &_events[6]);
+    expect(event_prio_get(&_queue) == NULL);
+    puts("wait OK");
+}
+
+int main(void)
+{
+    for (unsigned i = 0; i < EVENTS_NUMOF; i++) {
+        _events[i].super.handler = _handler;
+    }
+    event_prio_queue_init(&_queue);
+
+    test_order();
+    test_cancel();
+    test_wait();
+
+    puts("[SUCCESS]");
+    return 0;
+}
@@ -0,0 +1,115 @@
+/*
+ * Copyright (C) 2026 Mesotic SAS
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Tests the nanocoap cache with FNV-1a cache keys
+ *
+ * @}
+ */
+
+#include <stdint.h>
+#include <string.h>
+
+#include "embUnit.h"
+#include "hashes/sha256.h"
+#include "net/nanocoap/cache.h"
+
+#define _BUF_SIZE (128U)
+
+static size_t _build_get(coap_pkt_t *pkt, uint8_t *buf, size_t len,
+                         const char *path)
+{
+    uint8_t token[2] = { 0xDA, 0xEC };
+
+    len = coap_build_hdr((coap_hdr_t *)buf, COAP_TYPE_NON, token,
+                         sizeof(token), COAP_METHOD_GET, 0xABCD);
+    coap_pkt_init(pkt, buf, _BUF_SIZE, len);
+    coap_opt_add_string(pkt, COAP_OPT_URI_PATH, path, '/');
+    return coap_opt_finish(pkt, COAP_OPT_FINISH_NONE);
+}
+
+static void test_nanocoap_cache_key_fnv__key(void)
+{
+    static const uint8_t zero[SHA256_DIGEST_LENGTH - sizeof(uint64_t)];
+    uint8_t key1[SHA256_DIGEST_LENGTH];
+    uint8_t key2[SHA256_DIGEST_LENGTH];
+    uint8_t buf1[_BUF_SIZE];
+    uint8_t buf2[_BUF_SIZE];
+    coap_pkt_t pkt1, pkt2;
+
+    /* equal requests map to the same key */
+    _build_get(&pkt1, buf1, sizeof(buf1), "/fnv");
+    _build_get(&pkt2, buf2, sizeof(buf2), "/fnv");
+    nanocoap_cache_key_generate(&pkt1, key1);
+    nanocoap_cache_key_generate(&pkt2, key2);
+    TEST_ASSERT_EQUAL_INT(0, nanocoap_cache_key_compare(key1, key2));
+
+    /* the 64-bit hash is followed by zero padding */
+    TEST_ASSERT_EQUAL_INT(0, memcmp(&key1[sizeof(uint64_t)], zero,
+                                    sizeof(zero)));
+
+    /* a different path maps to a different key */
+    _build_get(&pkt2, buf2, sizeof(buf2), "/fnv2");
+    nanocoap_cache_key_generate(&pkt2, key2);
+    TEST_ASSERT(nanocoap_cache_key_compare(key1, key2) != 0);
+}
+
+static void test_nanocoap_cache_key_fnv__lookup(void)
+{
+    uint8_t key[SHA256_DIGEST_LENGTH];
+    uint8_t buf[_BUF_SIZE];
+    uint8_t rbuf[_BUF_SIZE];
+    coap_pkt_t req, resp;
+    nanocoap_cache_entry_t *c;
+    size_t len;
+
+    nanocoap_cache_init();
+
+    len = coap_build_hdr((coap_hdr_t *)rbuf, COAP_TYPE_NON, NULL, 0,
+                         COAP_CODE_205, 0xABCD);
+    coap_pkt_init(&resp, rbuf, sizeof(rbuf), len);
+    coap_opt_finish(&resp, COAP_OPT_FINISH_NONE);
+
+    _build_get(&req, buf, sizeof(buf), "/fnv");
+    c = nanocoap_cache_add_by_req(&req, &resp, coap_get_total_len(&resp));
+    TEST_ASSERT_NOT_NULL(c);
+
+    /* the key of an equal request finds the entry */
+    _build_get(&req, buf, sizeof(buf), "/fnv");
+    nanocoap_cache_key_generate(&req, key);
+    TEST_ASSERT(c == nanocoap_cache_key_lookup(key));
+    TEST_ASSERT(c == nanocoap_cache_request_lookup(&req));
+
+    /* another request misses */
+    _build_get(&req, buf, sizeof(buf), "/fnv2");
+    TEST_ASSERT_NULL(nanocoap_cache_request_lookup(&req));
+}
+
+static Test *tests_nanocoap_cache_key_fnv_tests(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture(test_nanocoap_cache_key_fnv__key),
+        new_TestFixture(test_nanocoap_cache_key_fnv__lookup),
+    };
+
+    EMB_UNIT_TESTCALLER(nanocoap_cache_key_fnv_tests, NULL, NULL, fixtures);
+
+    return (Test *)&nanocoap_cache_key_fnv_tests;
+}
+
+int main(void)
+{
+    TESTS_START();
+    TESTS_RUN(tests_nanocoap_cache_key_fnv_tests());
+    TESTS_END();
+    return 0;
+}
@@ -0,0 +1,87 @@
+/*
+ * Copyright (C) 2026 Mesotic SAS
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Test application for the cycle counter mode and the
+ *              histograms of schedstatistics
+ *
+ * @}
+ */
+
+#include <stdio.h>
+
+#include "msg.h"
+#include "schedstatistics.h"
+#include "shell.h"
+#include "test_utils/expect.h"
+#include "thread.h"
+#include "ztimer.h"
+
+#define WAKEUPS_NUMOF   (100U)
+
+static char _stack[THREAD_STACKSIZE_DEFAULT];
+
+static void *_worker(void *arg)
+{
+    (void)arg;
+
+    while (1) {
+        msg_t m;
+
+        msg_receive(&m);
+        /* run for a different number of cycles each time */
+        for (volatile uint32_t i = 0; i < 100 * m.content.value; i++) {}
+    }
+
+    return NULL;
+}
+
+static uint32_t _sum(const uint32_t *hist)
+{
+    uint32_t sum = 0;
+
+    for (unsigned bin = 0; bin < CONFIG_SCHEDSTATISTICS_HIST_BINS; bin++) {
+        sum += hist[bin];
+    }
+    return sum;
+}
+
+int main(void)
+{
+    kernel_pid_t pid = thread_create(_stack, sizeof(_stack),
+                                     THREAD_PRIORITY_MAIN - 1, 0,
+                                     _worker, NULL, "worker");
+
+    for (unsigned i = 0; i < WAKEUPS_NUMOF; i++) {
+        msg_t m = { .content.value = i };
+
+        msg_send(&m, pid);
+        ztimer_sleep(ZTIMER_MSEC, 1);
+    }
+
+    /* the worker only got the CPU after being woken up by a message, and
+     * gave it back each time */
+    const schedstat_t *stat = &sched_pidlist[pid];
+
+    printf("worker: schedules %u, runtime %u us\n", stat->schedules,
+           (unsigned)schedstatistics_runtime_us(pid));
+    expect(stat->schedules >= WAKEUPS_NUMOF);
+    expect(_sum(stat->run_hist) == stat->schedules);
+    expect(_sum(stat->latency_hist) == stat->schedules);
+    expect(schedstatistics_runtime_us(pid) > 0);
+    puts("[SUCCESS]");
+
+    char line_buf[SHELL_DEFAULT_BUFSIZE];
+    shell_run(NULL, line_buf, SHELL_DEFAULT_BUFSIZE);
+
+    return 0;
+}
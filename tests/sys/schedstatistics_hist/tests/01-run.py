@@ -0,0 +1,38 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2026 Mesotic SAS
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import sys
+import json
+from testrunner import run
+
+
+def testfunc(child):
+    child.expect_exact("[SUCCESS]")
+    child.sendline("ps")
+    child.expect(r"\tpid \|      \|((?: +\d+)+)\r\n")
+    bins = child.match.group(1).split()
+    child.expect(r"\t +\d+ \| run  \|((?: +\d+)+)\r\n")
+    assert len(child.match.group(1).split()) == len(bins)
+    child.expect_exact(">")
+
+    child.sendline("schedstat")
+    stats = {}
+    for _ in range(3):
+        child.expect(r"(\{[^\n\r]*\})\r\n")
+        thread = json.loads(child.match.group(1))
+        stats[thread["name"]] = thread
+    worker = stats["worker"]
+    assert len(worker["run"]) == len(worker["bins"])
+    assert sum(worker["run"]) == worker["schedules"]
+    assert sum(worker["latency"]) == worker["schedules"]
+    assert worker["runtime_us"] > 0
+    child.expect_exact(">")
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc))
@@ -0,0 +1,174 @@
+/*
+ * Copyright (C) 2026 Mesotic SAS
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Tests the SUIT worker download pipeline
+ *
+ * A fetch thread reads an image from mtd_native in blocks larger than the
+ * pipeline buffers and passes them to the pipeline, whose writer thread
+ * stores them in the RAM storage backend.
+ *
+ * @}
+ */
+
+#include <errno.h>
+#include <string.h>
+
+#include "board.h"
+#include "embUnit.h"
+#include "macros/math.h"
+#include "macros/utils.h"
+#include "mtd.h"
+#include "mutex.h"
+#include "suit/storage.h"
+#include "suit/storage/ram.h"
+#include "suit/transport/worker.h"
+#include "thread.h"
+#include "ztimer.h"
+
+#define IMAGE_SIZE      (1000U)
+#define FETCH_SIZE      (100U)
+#define WRITE_DELAY_US  (200U)
+
+static char _stack[THREAD_STACKSIZE_DEFAULT];
+static mutex_t _fetch_done = MUTEX_INIT_LOCKED;
+static int _fetch_res;
+static size_t _fail_offset;
+
+static uint8_t _data(size_t offset)
+{
+    return (offset * 13) ^ (offset >> 8);
+}
+
+static suit_storage_t *_storage(void)
+{
+    return suit_storage_find_by_id(".ram.0");
+}
+
+static int _write_cb(void *arg, size_t offset, uint8_t *buf, size_t len,
+                     int more)
+{
+    (void)arg;
+    (void)more;
+
+    if (offset + len > _fail_offset) {
+        return -EIO;
+    }
+    /* take longer than the fetch, so the transport has to wait */
+    ztimer_sleep(ZTIMER_USEC, WRITE_DELAY_US);
+    return suit_storage_write(_storage(), NULL, buf, offset, len);
+}
+
+static void *_fetch_thread(void *arg)
+{
+    (void)arg;
+    uint8_t buf[FETCH_SIZE];
+    int res = 0;
+
+    for (size_t offset = 0; (res == 0) && (offset < IMAGE_SIZE);
+         offset += sizeof(buf)) {
+        size_t len = MIN(sizeof(buf), IMAGE_SIZE - offset);
+
+        res = mtd_read_page(MTD_0, buf, 0, offset, len);
+        if (res == 0) {
+            res = suit_worker_pipeline_cb(NULL, offset, buf, len,
+                                          offset + len < IMAGE_SIZE);
+        }
+    }
+    _fetch_res = suit_worker_pipeline_finish(res);
+    mutex_unlock(&_fetch_done);
+    return NULL;
+}
+
+static void _fetch(void)
+{
+    TEST_ASSERT_EQUAL_INT(0, suit_worker_pipeline_start(_write_cb, NULL));
+    thread_create(_stack, sizeof(_stack), THREAD_PRIORITY_MAIN - 1, 0,
+                  _fetch_thread, NULL, "fetch");
+    mutex_lock(&_fetch_done);
+}
+
+static void set_up(void)
+{
+    suit_storage_t *storage = _storage();
+    uint8_t buf[FETCH_SIZE];
+
+    TEST_ASSERT_NOT_NULL(storage);
+    TEST_ASSERT_EQUAL_INT(0, suit_storage_set_active_location(storage, ".ram.0"));
+    TEST_ASSERT_EQUAL_INT(0, suit_storage_start(storage, NULL, IMAGE_SIZE));
+
+    /* put the image into the emulated flash */
+    uint32_t sector_size = MTD_0->pages_per_sector * MTD_0->page_size;
+    TEST_ASSERT_EQUAL_INT(0, mtd_erase_sector(MTD_0, 0, DIV_ROUND_UP(IMAGE_SIZE,
+                                                                   sector_size)));
+    for (size_t offset = 0; offset < IMAGE_SIZE; offset += sizeof(buf)) {
+        for (unsigned i = 0; i < sizeof(buf); i++) {
+            buf[i] = _data(offset + i);
+        }
+        TEST_ASSERT_EQUAL_INT(0, mtd_write_page_raw(MTD_0, buf, 0, offset,
+                                                    sizeof(buf)));
+    }
+    _fail_offset = SIZE_MAX;
+}
+
+static void test_suit_worker_pipeline__image(void)
+{
+    suit_worker_stats_t stats;
+    const uint8_t *image;
+    size_t len;
+
+    _fetch();
+    TEST_ASSERT_EQUAL_INT(0, _fetch_res);
+    TEST_ASSERT_EQUAL_INT(0, suit_storage_finish(_storage(), NULL));
+
+    /* the image was stored byte for byte */
+    TEST_ASSERT_EQUAL_INT(0, suit_storage_read_ptr(_storage(), &image, &len));
+    TEST_ASSERT_EQUAL_INT(IMAGE_SIZE, len);
+    for (unsigned i = 0; i < IMAGE_SIZE; i++) {
+        TEST_ASSERT_EQUAL_INT(_data(i), image[i]);
+    }
+
+    suit_worker_pipeline_stats(&stats);
+    TEST_ASSERT_EQUAL_INT(IMAGE_SIZE, stats.bytes);
+    TEST_ASSERT(stats.fetch_stall_us > 0);
+    TEST_ASSERT(stats.write_us >= (IMAGE_SIZE / 64) * WRITE_DELAY_US);
+}
+
+static void test_suit_worker_pipeline__write_error(void)
+{
+    _fail_offset = IMAGE_SIZE / 2;
+    _fetch();
+    TEST_ASSERT_EQUAL_INT(-EIO, _fetch_res);
+}
+
+static Test *tests_suit_worker_pipeline(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture(test_suit_worker_pipeline__image),
+        new_TestFixture(test_suit_worker_pipeline__write_error),
+    };
+
+    EMB_UNIT_TESTCALLER(suit_worker_pipeline_tests, set_up, NULL, fixtures);
+
+    return (Test *)&suit_worker_pipeline_tests;
+}
+
+int main(void)
+{
+    mtd_init(MTD_0);
+    suit_storage_init_all();
+
+    TESTS_START();
+    TESTS_RUN(tests_suit_worker_pipeline());
+    TESTS_END();
+    return 0;
+}
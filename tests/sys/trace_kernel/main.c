@@ -0,0 +1,128 @@
+/*
+ * Copyright (C) 2026 Mesotic SAS
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Test application for the kernel events and exports of
+ *              `sys/trace`
+ *
+ * @}
+ */
+
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "msg.h"
+#include "mutex.h"
+#include "test_utils/expect.h"
+#include "thread.h"
+#include "trace.h"
+#include "ztimer.h"
+
+#define MSG_TYPE    (0x4242)
+#define REPLY_TYPE  (0x4243)
+
+typedef struct {
+    size_t len;
+    char start[16];
+} sink_t;
+
+static char _stack[THREAD_STACKSIZE_DEFAULT];
+static mutex_t _lock = MUTEX_INIT;
+static kernel_pid_t _main_pid;
+
+static void *_worker(void *arg)
+{
+    (void)arg;
+    msg_t m = { .type = MSG_TYPE };
+
+    mutex_lock(&_lock);
+    mutex_unlock(&_lock);
+    msg_send(&m, _main_pid);
+    msg_receive(&m);
+    m.type = REPLY_TYPE;
+    msg_reply(&m, &m);
+    /* stay around, so the trace export can name the thread */
+    thread_sleep();
+    return NULL;
+}
+
+static void _write_sink(void *ctx, const void *data, size_t len)
+{
+    sink_t *sink = ctx;
+
+    if (sink->len < sizeof(sink->start)) {
+        size_t n = sizeof(sink->start) - sink->len;
+
+        memcpy(&sink->start[sink->len], data, (len < n) ? len : n);
+    }
+    sink->len += len;
+}
+
+int main(void)
+{
+    unsigned count[TRACE_TYPE_NUMOF] = { 0 };
+    sink_t metadata = { 0 };
+    sink_t stream = { 0 };
+    trace_event_t event;
+    bool reply_traced = false;
+    kernel_pid_t worker;
+    msg_t m;
+
+    _main_pid = thread_getpid();
+    trace_reset();
+    trace(42);
+
+    /* worker blocks on the mutex held by main */
+    mutex_lock(&_lock);
+    worker = thread_create(_stack, sizeof(_stack), THREAD_PRIORITY_MAIN - 1, 0,
+                  _worker, NULL, "worker");
+    ztimer_sleep(ZTIMER_MSEC, 1);
+    mutex_unlock(&_lock);
+    msg_receive(&m);
+    expect(m.type == MSG_TYPE);
+    msg_send_receive(&m, &m, worker);
+    expect(m.type == REPLY_TYPE);
+
+    for (size_t i = 0; trace_get(i, &event); i++) {
+        count[event.type]++;
+        if ((event.type == TRACE_MSG_RECV) && (event.pid == worker) &&
+            (event.arg == REPLY_TYPE)) {
+            reply_traced = true;
+        }
+    }
+    for (unsigned type = 0; type < TRACE_TYPE_NUMOF; type++) {
+        printf("%s: %u\n", trace_type_name(type), count[type]);
+#ifndef CPU_NATIVE
+        /* ISRs are only traced on native */
+        if ((type == TRACE_ISR_ENTER) || (type == TRACE_ISR_EXIT)) {
+            continue;
+        }
+#endif
+        expect(count[type] > 0);
+    }
+    expect(reply_traced);
+    expect(trace_lost() == 0);
+
+    puts("[JSON]");
+    trace_export_json(trace_write_stdio, NULL);
+
+    trace_export_ctf(_write_sink, &metadata, _write_sink, &stream);
+    printf("[CTF] metadata: %u bytes, stream: %u bytes\n",
+           (unsigned)metadata.len, (unsigned)stream.len);
+    expect(memcmp(metadata.start, "/* CTF 1.8 */", 13) == 0);
+    expect(stream.len == 8 + 15 * trace_numof());
+    expect(memcmp(stream.start, &(uint32_t){ 0xC1FC1FC1 }, 4) == 0);
+
+    puts("[SUCCESS]");
+    return 0;
+}
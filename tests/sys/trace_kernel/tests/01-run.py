@@ -0,0 +1,56 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2026 Mesotic SAS
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import os
+import signal
+import sys
+import json
+from pexpect.popen_spawn import PopenSpawn
+from testrunner import run
+
+JSON_REGEXP = r"\[JSON\]\r?\n(\{\"traceEvents\":.*?\n\]\})\r?\n"
+CTF_REGEXP = r"\[CTF\] metadata: \d+ bytes, stream: \d+ bytes\r?\n"
+
+
+def check_json(export):
+    trace = json.loads(export)["traceEvents"]
+    names = {e["args"]["name"] for e in trace if e["ph"] == "M"}
+    assert any(name.startswith("worker") for name in names), names
+    phases = {e["ph"] for e in trace}
+    assert {"B", "E", "i"} <= phases, phases
+    instants = {e["name"] for e in trace if e["ph"] == "i"}
+    for name in ("user", "msg_send", "msg_recv", "mutex_block",
+                 "mutex_unblock", "ztimer_fire"):
+        assert name in instants, name
+
+
+def check_not_a_tty():
+    # the export must not depend on the host flushing its stdout per line,
+    # as it does for a terminal
+    if os.environ.get("BOARD") not in ("native", "native64"):
+        return
+    child = PopenSpawn(os.environ["ELFFILE"], timeout=30, encoding="utf-8")
+    try:
+        child.expect(JSON_REGEXP)
+        check_json(child.match.group(1))
+        child.expect(CTF_REGEXP)
+        child.expect_exact("[SUCCESS]")
+    finally:
+        child.kill(signal.SIGKILL)
+
+
+def testfunc(child):
+    child.expect(JSON_REGEXP)
+    check_json(child.match.group(1))
+    child.expect(CTF_REGEXP)
+    child.expect_exact("[SUCCESS]")
+    check_not_a_tty()
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc))
@@ -0,0 +1,157 @@
+/*
+ * Copyright (C) 2026 Mesotic SAS
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       ztimer timing wheel randomized test application
+ *
+ * @}
+ */
+
+#include <stdbool.h>
+#include <stdio.h>
+
+#include "random.h"
+#include "test_utils/expect.h"
+#include "ztimer.h"
+#include "ztimer/mock.h"
+
+#ifndef NUMOF_TIMERS
+#define NUMOF_TIMERS    (64U)
+#endif
+
+#ifndef ROUNDS
+#define ROUNDS          (1000U)
+#endif
+
+#ifndef SEED
+#define SEED            (0x5EEDU)
+#endif
+
+/* start shortly before the wrap around of the 32 bit counter */
+#define START           (UINT32_MAX - (1UL << 22))
+
+typedef struct {
+    ztimer_t timer;
+    uint32_t target;
+    bool armed;
+} test_timer_t;
+
+static ztimer_mock_t _mock;
+static test_timer_t _timers[NUMOF_TIMERS];
+static uint32_t _last;
+static unsigned _expected;
+static unsigned _fired;
+
+static void _callback(void *arg)
+{
+    test_timer_t *t = arg;
+
+    expect(t->armed);
+    expect(_mock.now == t->target);
+    /* targets never lie more than 2^31 ticks apart in this test */
+    expect((int32_t)(_mock.now - _last) >= 0);
+
+    _last = _mock.now;
+    t->armed = false;
+    _fired++;
+}
+
+static uint32_t _random_interval(void)
+{
+    /* mostly short timers, but cover all levels up to 2^24 ticks */
+    switch (random_uint32_range(0, 4)) {
+    case 0:
+        return random_uint32_range(0, 16);
+    case 1:
+        return random_uint32_range(0, 1UL << 12);
+    case 2:
+        return random_uint32_range(0, 1UL << 18);
+    default:
+        return random_uint32_range(0, 1UL << 24);
+    }
+}
+
+static void _set(test_timer_t *t)
+{
+    uint32_t val = _random_interval();
+
+    if (t->armed) {
+        /* the timer is removed implicitly */
+        _expected--;
+    }
+    t->target = _mock.now + val;
+    t->armed = true;
+    _expected++;
+    ztimer_set(&_mock.super, &t->timer, val);
+}
+
+static void _remove(test_timer_t *t)
+{
+    if (t->armed) {
+        t->armed = false;
+        _expected--;
+    }
+    ztimer_remove(&_mock.super, &t->timer);
+}
+
+static bool _any_armed(void)
+{
+    for (unsigned i = 0; i < NUMOF_TIMERS; i++) {
+        if (_timers[i].armed) {
+            return true;
+        }
+    }
+    return false;
+}
+
+int main(void)
+{
+    random_init(SEED);
+    ztimer_mock_init(&_mock, 32);
+    ztimer_mock_jump(&_mock, START);
+    _last = START;
+
+    for (unsigned i = 0; i < NUMOF_TIMERS; i++) {
+        _timers[i].timer.callback = _callback;
+        _timers[i].timer.arg = &_timers[i];
+    }
+
+    for (unsigned round = 0; round < ROUNDS; round++) {
+        for (unsigned i = 0; i < NUMOF_TIMERS; i++) {
+            switch (random_uint32_range(0, 8)) {
+            case 0:
+            case 1:
+            case 2:
+                _set(&_timers[i]);
+                break;
+            case 3:
+                _remove(&_timers[i]);
+                break;
+            default:
+                break;
+            }
+        }
+        ztimer_mock_advance(&_mock, random_uint32_range(1, 1UL << 16));
+    }
+
+    while (_any_armed()) {
+        ztimer_mock_advance(&_mock, 1UL << 16);
+    }
+
+    printf("timers fired: %u, expected: %u\n", _fired, _expected);
+    expect(_fired == _expected);
+    expect(_mock.now < START);
+
+    puts("SUCCESS!");
+
+    return 0;
+}
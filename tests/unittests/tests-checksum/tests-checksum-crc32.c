@@ -7,6 +7,7 @@
  */
 
 #include "checksum/crc32.h"
+#include "container.h"
 #include "tests-checksum.h"
 
 static void test_checksum_crc32_sequence_empty(void)
@@ -56,6 +57,23 @@ static void test_checksum_crc32_sequence_4bytes(void)
     TEST_ASSERT_EQUAL_INT(expect, crc32(buf, sizeof(buf)));
 }
 
+static void test_checksum_crc32_sequence_offsets(void)
+{
+    /* covers all alignments and remainders of multi-byte implementations */
+    static const uint32_t expect[] = {
+        0xaa316b09, 0x23e4e641, 0x16cb580e, 0xc9b1bed0, 0xbd422267,
+        0x8f8ea469, 0xd23a41c5, 0x35bb7e03, 0xa232cd48,
+    };
+    uint8_t buf[100];
+
+    for (unsigned i = 0; i < sizeof(buf); i++) {
+        buf[i] = i * 7 + 3;
+    }
+    for (unsigned i = 0; i < ARRAY_SIZE(expect); i++) {
+        TEST_ASSERT_EQUAL_INT(expect[i], crc32(buf + i, sizeof(buf) - i));
+    }
+}
+
 Test *tests_checksum_crc32_tests(void)
 {
     EMB_UNIT_TESTFIXTURES(fixtures) {
@@ -64,6 +82,7 @@ Test *tests_checksum_crc32_tests(void)
         new_TestFixture(test_checksum_crc32_sequence_256a),
         new_TestFixture(test_checksum_crc32_sequence_1to9),
         new_TestFixture(test_checksum_crc32_sequence_4bytes),
+        new_TestFixture(test_checksum_crc32_sequence_offsets),
     };
 
     EMB_UNIT_TESTCALLER(checksum_crc32_tests, NULL, NULL, fixtures);
@@ -1689,6 +1689,111 @@ static void test_nib_offl_iter__three_elem_middle_removed(void)
     TEST_ASSERT_NULL(_nib_offl_iter(res));
 }
 
+/*
+ * Creates off-link entries with overlapping prefixes of different lengths in
+ * mixed order and looks up addresses within them.
+ * Expected result: the entry with the longest matching prefix is returned
+ * or NULL if no prefix matches.
+ */
+static void test_nib_offl_get_lpm__overlapping(void)
+{
+    _nib_offl_entry_t *dst16, *dst32, *dst48, *dst64;
+    static const ipv6_addr_t next_hop = { .u64 = { { .u8 = LINK_LOCAL_PREFIX },
+                                                 { .u64 = TEST_UINT64 } } };
+    static const ipv6_addr_t pfx = { .u8 = { 0x20, 0x01, 0x0d, 0xb8,
+                                             0x00, 0x01, 0x00, 0x02 } };
+    ipv6_addr_t addr = { .u8 = { 0x20, 0x01, 0x0d, 0xb8, 0x00, 0x01, 0x00, 0x02,
+                                 0, 0, 0, 0, 0, 0, 0, 0x01 } };
+    gnrc_ipv6_nib_ft_t fte;
+
+    TEST_ASSERT_NOT_NULL((dst64 = _nib_offl_alloc(&next_hop, IFACE, &pfx, 64)));
+    dst64->mode |= _FT;
+    TEST_ASSERT_NOT_NULL((dst16 = _nib_offl_alloc(&next_hop, IFACE, &pfx, 16)));
+    dst16->mode |= _FT;
+    TEST_ASSERT_NOT_NULL((dst48 = _nib_offl_alloc(&next_hop, IFACE, &pfx, 48)));
+    dst48->mode |= _FT;
+    TEST_ASSERT_NOT_NULL((dst32 = _nib_offl_alloc(&next_hop, IFACE, &pfx, 32)));
+    dst32->mode |= _FT;
+    /* 2001:db8:1:2::1 */
+    TEST_ASSERT(dst64 == _nib_offl_get_lpm(&addr));
+    TEST_ASSERT_EQUAL_INT(0, _nib_get_route(&addr, NULL, &fte));
+    TEST_ASSERT_EQUAL_INT(64, fte.dst_len);
+    /* 2001:db8:1:3::1 */
+    addr.u8[7] = 0x03;
+    TEST_ASSERT(dst48 == _nib_offl_get_lpm(&addr));
+    TEST_ASSERT_EQUAL_INT(0, _nib_get_route(&addr, NULL, &fte));
+    TEST_ASSERT_EQUAL_INT(48, fte.dst_len);
+    /* 2001:db8:2:3::1 */
+    addr.u8[5] = 0x02;
+    TEST_ASSERT(dst32 == _nib_offl_get_lpm(&addr));
+    TEST_ASSERT_EQUAL_INT(0, _nib_get_route(&addr, NULL, &fte));
+    TEST_ASSERT_EQUAL_INT(32, fte.dst_len);
+    /* 2001:db9:2:3::1 */
+    addr.u8[3] = 0xb9;
+    TEST_ASSERT(dst16 == _nib_offl_get_lpm(&addr));
+    TEST_ASSERT_EQUAL_INT(0, _nib_get_route(&addr, NULL, &fte));
+    TEST_ASSERT_EQUAL_INT(16, fte.dst_len);
+    /* 2002:db9:2:3::1 */
+    addr.u8[1] = 0x02;
+    TEST_ASSERT_NULL(_nib_offl_get_lpm(&addr));
+}
+
+/*
+ * Creates off-link entries for 2001:db8::/32 and 2001:db8::/64 and looks up
+ * 2001:db8::1, which shares as many bits with both prefixes.
+ * Expected result: _nib_offl_get_lpm() returns the /64. The route is the /64
+ * with the hash index and the first entry created without it.
+ */
+static void test_nib_offl_get_lpm__equal_match(void)
+{
+    _nib_offl_entry_t *dst32, *dst64;
+    static const ipv6_addr_t next_hop = { .u64 = { { .u8 = LINK_LOCAL_PREFIX },
+                                                 { .u64 = TEST_UINT64 } } };
+    static const ipv6_addr_t pfx = { .u8 = { 0x20, 0x01, 0x0d, 0xb8 } };
+    static const ipv6_addr_t addr = { .u8 = { 0x20, 0x01, 0x0d, 0xb8,
+                                              0, 0, 0, 0, 0, 0, 0, 0,
+                                              0, 0, 0, 0x01 } };
+    gnrc_ipv6_nib_ft_t fte;
+
+    TEST_ASSERT_NOT_NULL((dst32 = _nib_offl_alloc(&next_hop, IFACE, &pfx, 32)));
+    dst32->mode |= _FT;
+    TEST_ASSERT_NOT_NULL((dst64 = _nib_offl_alloc(&next_hop, IFACE, &pfx, 64)));
+    dst64->mode |= _FT;
+    TEST_ASSERT(dst64 == _nib_offl_get_lpm(&addr));
+    TEST_ASSERT_EQUAL_INT(0, _nib_get_route(&addr, NULL, &fte));
+    TEST_ASSERT_EQUAL_INT(CONFIG_GNRC_IPV6_NIB_HASH_NUMOF ? 64 : 32,
+                          fte.dst_len);
+}
+
+/*
+ * Clears an off-link entry and adds it again with alternating prefix lengths
+ * more often than there are off-link entries.
+ * Expected result: a cleared entry is not found anymore and the re-added one
+ * is found with its new prefix length.
+ */
+static void test_nib_offl_clear__readd(void)
+{
+    _nib_offl_entry_t *dst;
+    static const ipv6_addr_t next_hop = { .u64 = { { .u8 = LINK_LOCAL_PREFIX },
+                                                 { .u64 = TEST_UINT64 } } };
+    static const ipv6_addr_t addr = { .u64 = { { .u8 = GLOBAL_PREFIX },
+                                             { .u64 = TEST_UINT64 } } };
+
+    for (unsigned i = 0; i < (2 * CONFIG_GNRC_IPV6_NIB_OFFL_NUMOF); i++) {
+        unsigned pfx_len = (i % 2) ? 64 : GLOBAL_PREFIX_LEN;
+
+        TEST_ASSERT_NOT_NULL((dst = _nib_offl_alloc(&next_hop, IFACE, &addr,
+                                                    pfx_len)));
+        dst->mode |= _FT;
+        TEST_ASSERT(dst == _nib_offl_get_lpm(&addr));
+        TEST_ASSERT_EQUAL_INT(pfx_len, dst->pfx_len);
+        dst->mode = _EMPTY;
+        _nib_offl_clear(dst);
+        TEST_ASSERT_NULL(_nib_offl_get_lpm(&addr));
+        TEST_ASSERT_NULL(_nib_offl_iter(NULL));
+    }
+}
+
 #if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_DC)
 /*
  * Creates a destination cache entry.
@@ -2132,6 +2237,9 @@ Test *tests_gnrc_ipv6_nib_internal_tests(void)
         new_TestFixture(test_nib_offl_iter__one_elem),
         new_TestFixture(test_nib_offl_iter__three_elem),
         new_TestFixture(test_nib_offl_iter__three_elem_middle_removed),
+        new_TestFixture(test_nib_offl_get_lpm__overlapping),
+        new_TestFixture(test_nib_offl_get_lpm__equal_match),
+        new_TestFixture(test_nib_offl_clear__readd),
 #if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_DC)
         new_TestFixture(test_nib_dc_add__success),
         new_TestFixture(test_nib_dc_remove),
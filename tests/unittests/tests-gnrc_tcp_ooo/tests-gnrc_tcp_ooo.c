@@ -0,0 +1,275 @@
+/*
+ * Copyright (C) 2026 Mesotic SAS
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @{
+ *
+ * @file
+ */
+#include <string.h>
+
+#include "embUnit.h"
+
+#include "byteorder.h"
+#include "net/gnrc/pktbuf.h"
+#include "net/tcp.h"
+
+#include "include/gnrc_tcp_common.h"
+#include "include/gnrc_tcp_ooo.h"
+#include "include/gnrc_tcp_option.h"
+#include "include/gnrc_tcp_pkt.h"
+
+#include "tests-gnrc_tcp_ooo.h"
+
+#define RCV_NXT         (1000U)
+#define RCV_BUF_SIZE    (256U)
+
+static gnrc_tcp_tcb_t _tcb;
+static uint8_t _rcv_buf[RCV_BUF_SIZE];
+
+static void set_up(void)
+{
+    gnrc_pktbuf_init();
+    memset(&_tcb, 0, sizeof(_tcb));
+    _tcb.status = STATUS_SACK_PERMITTED;
+    _tcb.rcv_nxt = RCV_NXT;
+    _tcb.rcv_wnd = 4000;
+    ringbuffer_init(&_tcb.rcv_buf, (char *)_rcv_buf, sizeof(_rcv_buf));
+}
+
+static void tear_down(void)
+{
+    _gnrc_tcp_ooo_clear(&_tcb);
+    TEST_ASSERT(gnrc_pktbuf_is_empty());
+}
+
+static void _add(uint32_t seq, uint16_t len)
+{
+    gnrc_pktsnip_t *pkt = gnrc_pktbuf_add(NULL, NULL, len, GNRC_NETTYPE_UNDEF);
+
+    TEST_ASSERT_NOT_NULL(pkt);
+    memset(pkt->data, (uint8_t)seq, len);
+    TEST_ASSERT_EQUAL_INT(0, _gnrc_tcp_ooo_add(&_tcb, pkt, seq, len));
+    /* the queue holds its own reference */
+    gnrc_pktbuf_release(pkt);
+}
+
+static void _assert_block(const uint32_t *blocks, unsigned idx,
+                          uint32_t left, uint32_t right)
+{
+    TEST_ASSERT_EQUAL_INT(left, blocks[2 * idx]);
+    TEST_ASSERT_EQUAL_INT(right, blocks[2 * idx + 1]);
+}
+
+static void test_gnrc_tcp_ooo__sack_blocks_not_permitted(void)
+{
+    uint32_t blocks[2 * GNRC_TCP_OOO_SACK_BLOCKS_MAX];
+
+    _tcb.status = 0;
+    _add(RCV_NXT + 100, 100);
+    TEST_ASSERT_EQUAL_INT(0, _gnrc_tcp_ooo_sack_blocks(&_tcb, blocks));
+}
+
+static void test_gnrc_tcp_ooo__sack_blocks_merge(void)
+{
+    uint32_t blocks[2 * GNRC_TCP_OOO_SACK_BLOCKS_MAX];
+
+    /* adjacent and overlapping segments form one block */
+    _add(RCV_NXT + 100, 100);
+    _add(RCV_NXT + 200, 100);
+    _add(RCV_NXT + 250, 100);
+    TEST_ASSERT_EQUAL_INT(1, _gnrc_tcp_ooo_sack_blocks(&_tcb, blocks));
+    _assert_block(blocks, 0, RCV_NXT + 100, RCV_NXT + 350);
+}
+
+static void test_gnrc_tcp_ooo__sack_blocks_recent_first(void)
+{
+    uint32_t blocks[2 * GNRC_TCP_OOO_SACK_BLOCKS_MAX];
+
+    _add(RCV_NXT + 500, 100);
+    _add(RCV_NXT + 100, 100);
+    _add(RCV_NXT + 300, 100);
+    /* RFC 2018, section 4: the block of the latest segment comes first */
+    TEST_ASSERT_EQUAL_INT(3, _gnrc_tcp_ooo_sack_blocks(&_tcb, blocks));
+    _assert_block(blocks, 0, RCV_NXT + 300, RCV_NXT + 400);
+    _assert_block(blocks, 1, RCV_NXT + 100, RCV_NXT + 200);
+    _assert_block(blocks, 2, RCV_NXT + 500, RCV_NXT + 600);
+}
+
+static void test_gnrc_tcp_ooo__sack_blocks_limit(void)
+{
+    uint32_t blocks[2 * GNRC_TCP_OOO_SACK_BLOCKS_MAX];
+
+    /* six disjoint segments, the latest one is the highest */
+    for (unsigned i = 0; i < 6; i++) {
+        _add(RCV_NXT + 100 + 200 * i, 100);
+    }
+    TEST_ASSERT_EQUAL_INT(GNRC_TCP_OOO_SACK_BLOCKS_MAX,
+                          _gnrc_tcp_ooo_sack_blocks(&_tcb, blocks));
+    /* the latest segment is reported although it is beyond the fourth */
+    _assert_block(blocks, 0, RCV_NXT + 1100, RCV_NXT + 1200);
+    _assert_block(blocks, 1, RCV_NXT + 100, RCV_NXT + 200);
+    _assert_block(blocks, 2, RCV_NXT + 300, RCV_NXT + 400);
+    _assert_block(blocks, 3, RCV_NXT + 500, RCV_NXT + 600);
+}
+
+static void test_gnrc_tcp_ooo__sack_blocks_limit_recent_low(void)
+{
+    uint32_t blocks[2 * GNRC_TCP_OOO_SACK_BLOCKS_MAX];
+
+    for (unsigned i = 6; i > 0; i--) {
+        _add(RCV_NXT + 100 + 200 * (i - 1), 100);
+    }
+    TEST_ASSERT_EQUAL_INT(GNRC_TCP_OOO_SACK_BLOCKS_MAX,
+                          _gnrc_tcp_ooo_sack_blocks(&_tcb, blocks));
+    _assert_block(blocks, 0, RCV_NXT + 100, RCV_NXT + 200);
+    _assert_block(blocks, 1, RCV_NXT + 300, RCV_NXT + 400);
+    _assert_block(blocks, 2, RCV_NXT + 500, RCV_NXT + 600);
+    _assert_block(blocks, 3, RCV_NXT + 700, RCV_NXT + 800);
+}
+
+static void test_gnrc_tcp_ooo__sack_blocks_below_rcv_nxt(void)
+{
+    uint32_t blocks[2 * GNRC_TCP_OOO_SACK_BLOCKS_MAX];
+
+    _add(RCV_NXT + 100, 100);
+    _add(RCV_NXT + 300, 100);
+    /* data that is acknowledged cumulatively is not reported again */
+    _tcb.rcv_nxt = RCV_NXT + 150;
+    TEST_ASSERT_EQUAL_INT(2, _gnrc_tcp_ooo_sack_blocks(&_tcb, blocks));
+    _assert_block(blocks, 0, RCV_NXT + 300, RCV_NXT + 400);
+    _assert_block(blocks, 1, RCV_NXT + 150, RCV_NXT + 200);
+    _tcb.rcv_nxt = RCV_NXT + 200;
+    TEST_ASSERT_EQUAL_INT(1, _gnrc_tcp_ooo_sack_blocks(&_tcb, blocks));
+    _assert_block(blocks, 0, RCV_NXT + 300, RCV_NXT + 400);
+}
+
+static void test_gnrc_tcp_ooo__drain_buffer_full(void)
+{
+    uint32_t blocks[2 * GNRC_TCP_OOO_SACK_BLOCKS_MAX];
+    uint8_t buf[RCV_BUF_SIZE];
+
+    _add(RCV_NXT + 100, 200);
+    _add(RCV_NXT, 100);
+    _gnrc_tcp_ooo_drain(&_tcb);
+    TEST_ASSERT_EQUAL_INT(RCV_NXT + RCV_BUF_SIZE, _tcb.rcv_nxt);
+    /* the rest was SACKed already, it must not be dropped */
+    TEST_ASSERT_EQUAL_INT(1, _tcb.ooo_numof);
+    TEST_ASSERT_EQUAL_INT(1, _gnrc_tcp_ooo_sack_blocks(&_tcb, blocks));
+    _assert_block(blocks, 0, RCV_NXT + RCV_BUF_SIZE, RCV_NXT + 300);
+
+    /* the rest follows once the user made room */
+    TEST_ASSERT_EQUAL_INT(100, ringbuffer_get(&_tcb.rcv_buf, (char *)buf, 100));
+    _gnrc_tcp_ooo_drain(&_tcb);
+    TEST_ASSERT_EQUAL_INT(RCV_NXT + 300, _tcb.rcv_nxt);
+    TEST_ASSERT_EQUAL_INT(0, _tcb.ooo_numof);
+    TEST_ASSERT_EQUAL_INT(0, _gnrc_tcp_ooo_sack_blocks(&_tcb, blocks));
+    TEST_ASSERT_EQUAL_INT(200, ringbuffer_get(&_tcb.rcv_buf, (char *)buf,
+                                              sizeof(buf)));
+    TEST_ASSERT_EQUAL_INT((uint8_t)(RCV_NXT + 100), buf[200 - 1]);
+}
+
+/* builds an ACK and checks the SACK option it carries */
+static void _check_sack_option(unsigned numof)
+{
+    gnrc_pktsnip_t *pkt = NULL, *tcp;
+    uint16_t seq_con = 0;
+    tcp_hdr_t *hdr;
+    uint8_t *opt;
+
+    for (unsigned i = 0; i < numof; i++) {
+        _add(RCV_NXT + 100 + 200 * i, 100);
+    }
+    TEST_ASSERT_EQUAL_INT(0, _gnrc_tcp_pkt_build(&_tcb, &pkt, &seq_con,
+                                                 MSK_ACK, 0, _tcb.rcv_nxt,
+                                                 NULL, 0));
+    tcp = gnrc_pktsnip_search_type(pkt, GNRC_NETTYPE_TCP);
+    TEST_ASSERT_NOT_NULL(tcp);
+    hdr = tcp->data;
+    /* two NOPs, kind, length and eight bytes per block */
+    TEST_ASSERT_EQUAL_INT(TCP_HDR_OFFSET_MIN + 1 + 2 * numof,
+                          byteorder_ntohs(hdr->off_ctl) >> 12);
+    TEST_ASSERT(sizeof(tcp_hdr_t) + 4 + 8 * numof <= TCP_HDR_OFFSET_MAX * 4);
+    opt = (uint8_t *)(hdr + 1);
+    TEST_ASSERT_EQUAL_INT(TCP_OPTION_KIND_NOP, opt[0]);
+    TEST_ASSERT_EQUAL_INT(TCP_OPTION_KIND_NOP, opt[1]);
+    TEST_ASSERT_EQUAL_INT(TCP_OPTION_KIND_SACK, opt[2]);
+    TEST_ASSERT_EQUAL_INT(2 + 8 * numof, opt[3]);
+    /* latest segment first, then ascending */
+    TEST_ASSERT_EQUAL_INT(RCV_NXT + 100 + 200 * (numof - 1),
+                          byteorder_bebuftohl(&opt[4]));
+    TEST_ASSERT_EQUAL_INT(RCV_NXT + 200 + 200 * (numof - 1),
+                          byteorder_bebuftohl(&opt[8]));
+    for (unsigned i = 1; i < numof; i++) {
+        TEST_ASSERT_EQUAL_INT(RCV_NXT + 100 + 200 * (i - 1),
+                              byteorder_bebuftohl(&opt[4 + 8 * i]));
+        TEST_ASSERT_EQUAL_INT(RCV_NXT + 200 + 200 * (i - 1),
+                              byteorder_bebuftohl(&opt[8 + 8 * i]));
+    }
+    gnrc_pktbuf_release(pkt);
+}
+
+static void test_gnrc_tcp_ooo__option_three_blocks(void)
+{
+    _check_sack_option(3);
+}
+
+static void test_gnrc_tcp_ooo__option_four_blocks(void)
+{
+    _check_sack_option(4);
+}
+
+static void test_gnrc_tcp_ooo__option_parse_sack_perm(void)
+{
+    struct {
+        tcp_hdr_t hdr;
+        uint8_t opt[4];
+    } seg = { .opt = { TCP_OPTION_KIND_NOP, TCP_OPTION_KIND_NOP,
+                       TCP_OPTION_KIND_SACK_PERM,
+                       TCP_OPTION_LENGTH_SACK_PERM } };
+
+    _tcb.status = 0;
+    /* only honored on SYN, RFC 2018, section 2 */
+    seg.hdr.off_ctl = byteorder_htons(
+        _gnrc_tcp_option_build_offset_control(TCP_HDR_OFFSET_MIN + 1, MSK_ACK));
+    TEST_ASSERT_EQUAL_INT(0, _gnrc_tcp_option_parse(&_tcb, &seg.hdr));
+    TEST_ASSERT_EQUAL_INT(0, _tcb.status & STATUS_SACK_PERMITTED);
+    seg.hdr.off_ctl = byteorder_htons(
+        _gnrc_tcp_option_build_offset_control(TCP_HDR_OFFSET_MIN + 1, MSK_SYN));
+    TEST_ASSERT_EQUAL_INT(0, _gnrc_tcp_option_parse(&_tcb, &seg.hdr));
+    TEST_ASSERT(_tcb.status & STATUS_SACK_PERMITTED);
+    /* invalid length */
+    seg.opt[3] = TCP_OPTION_LENGTH_SACK_PERM + 1;
+    TEST_ASSERT_EQUAL_INT(-1, _gnrc_tcp_option_parse(&_tcb, &seg.hdr));
+}
+
+Test *tests_gnrc_tcp_ooo_tests(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture(test_gnrc_tcp_ooo__sack_blocks_not_permitted),
+        new_TestFixture(test_gnrc_tcp_ooo__sack_blocks_merge),
+        new_TestFixture(test_gnrc_tcp_ooo__sack_blocks_recent_first),
+        new_TestFixture(test_gnrc_tcp_ooo__sack_blocks_limit),
+        new_TestFixture(test_gnrc_tcp_ooo__sack_blocks_limit_recent_low),
+        new_TestFixture(test_gnrc_tcp_ooo__sack_blocks_below_rcv_nxt),
+        new_TestFixture(test_gnrc_tcp_ooo__drain_buffer_full),
+        new_TestFixture(test_gnrc_tcp_ooo__option_three_blocks),
+        new_TestFixture(test_gnrc_tcp_ooo__option_four_blocks),
+        new_TestFixture(test_gnrc_tcp_ooo__option_parse_sack_perm),
+    };
+
+    EMB_UNIT_TESTCALLER(gnrc_tcp_ooo_tests, set_up, tear_down, fixtures);
+
+    return (Test *)&gnrc_tcp_ooo_tests;
+}
+
+void tests_gnrc_tcp_ooo(void)
+{
+    TESTS_RUN(tests_gnrc_tcp_ooo_tests());
+}
+/** @} */
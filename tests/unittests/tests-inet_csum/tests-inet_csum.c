@@ -165,6 +165,58 @@ static void test_inet_csum__empty_app_buffer(void)
     TEST_ASSERT_EQUAL_INT(hdr_expected, pyld_sum);
 }
 
+/* byte-wise reference implementation of inet_csum_slice() */
+static uint16_t _ref_csum_slice(uint16_t sum, const uint8_t *buf, uint16_t len,
+                                size_t accum_len)
+{
+    uint32_t csum = sum;
+
+    for (unsigned i = 0; i < len; i++, accum_len++) {
+        csum += ((accum_len & 1) ? buf[i] : (uint16_t)(buf[i] << 8));
+    }
+    while (csum >> 16) {
+        csum = (csum & 0xffff) + (csum >> 16);
+    }
+    return csum;
+}
+
+static uint32_t _xorshift32(uint32_t *state)
+{
+    uint32_t x = *state;
+
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    return *state = x;
+}
+
+static void test_inet_csum__differential(void)
+{
+    static uint8_t data[1300];
+    uint32_t state = 0x1b1e5eed;
+
+    for (unsigned round = 0; round < 2000; round++) {
+        /* mostly random data, but also long runs of 0xff to provoke carries */
+        uint8_t fill = (round & 1) ? 0xff : 0x00;
+        for (unsigned i = 0; i < sizeof(data); i++) {
+            data[i] = (_xorshift32(&state) & 3) ? fill : (uint8_t)state;
+        }
+        if (round & 2) {
+            for (unsigned i = 0; i < sizeof(data); i++) {
+                data[i] = _xorshift32(&state);
+            }
+        }
+
+        unsigned offset = _xorshift32(&state) % 8;
+        uint16_t len = _xorshift32(&state) % (sizeof(data) - offset);
+        size_t accum_len = _xorshift32(&state) % 4;
+        uint16_t sum = (round & 4) ? _xorshift32(&state) : 0;
+
+        TEST_ASSERT_EQUAL_INT(_ref_csum_slice(sum, data + offset, len, accum_len),
+                              inet_csum_slice(sum, data + offset, len, accum_len));
+    }
+}
+
 Test *tests_inet_csum_tests(void)
 {
     EMB_UNIT_TESTFIXTURES(fixtures) {
@@ -176,6 +228,7 @@ Test *tests_inet_csum_tests(void)
         new_TestFixture(test_inet_csum__odd_len),
         new_TestFixture(test_inet_csum__two_app_snips),
         new_TestFixture(test_inet_csum__empty_app_buffer),
+        new_TestFixture(test_inet_csum__differential),
     };
 
     EMB_UNIT_TESTCALLER(inet_csum_tests, NULL, NULL, fixtures);
@@ -248,6 +248,101 @@ static void test_nanocoap_cache__del(void)
     TEST_ASSERT_EQUAL_INT(0, nanocoap_cache_used_count());
 }
 
+static void test_nanocoap_cache__colliding_keys(void)
+{
+    uint8_t rbuf[_BUF_SIZE];
+    coap_pkt_t resp;
+    uint16_t msgid = 0xABCD;
+    uint8_t token[2] = {0xDA, 0xEC};
+    uint8_t keys[CONFIG_NANOCOAP_CACHE_ENTRIES][CONFIG_NANOCOAP_CACHE_KEY_LENGTH];
+    nanocoap_cache_entry_t *ces[CONFIG_NANOCOAP_CACHE_ENTRIES];
+    size_t len;
+
+    nanocoap_cache_init();
+
+    len = coap_build_hdr((coap_hdr_t *)&rbuf[0], COAP_TYPE_NON,
+                         &token[0], 2, COAP_CODE_205, msgid);
+    coap_pkt_init(&resp, &rbuf[0], sizeof(rbuf), len);
+    coap_opt_finish(&resp, COAP_OPT_FINISH_NONE);
+
+    /* all keys share the same prefix and thus end up in one probe sequence */
+    memset(keys, 0, sizeof(keys));
+    for (unsigned i = 0; i < CONFIG_NANOCOAP_CACHE_ENTRIES; i++) {
+        keys[i][CONFIG_NANOCOAP_CACHE_KEY_LENGTH - 1] = (i + 1);
+        keys[i][CONFIG_NANOCOAP_CACHE_KEY_LENGTH - 2] = (i + 1) >> 8;
+        ces[i] = nanocoap_cache_add_by_key(keys[i], COAP_METHOD_GET,
+                                           &resp, coap_get_total_len(&resp));
+        TEST_ASSERT_NOT_NULL(ces[i]);
+    }
+
+    /* delete every second entry, so that the remaining entries have to be
+     * shifted back in the probe sequence */
+    for (unsigned i = 0; i < CONFIG_NANOCOAP_CACHE_ENTRIES; i += 2) {
+        TEST_ASSERT_EQUAL_INT(0, nanocoap_cache_del(ces[i]));
+    }
+
+    for (unsigned i = 0; i < CONFIG_NANOCOAP_CACHE_ENTRIES; i++) {
+        if (i % 2) {
+            TEST_ASSERT(ces[i] == nanocoap_cache_key_lookup(keys[i]));
+        }
+        else {
+            TEST_ASSERT_NULL(nanocoap_cache_key_lookup(keys[i]));
+        }
+    }
+}
+
+static void test_nanocoap_cache__lru(void)
+{
+    uint8_t rbuf[_BUF_SIZE];
+    coap_pkt_t resp;
+    uint16_t msgid = 0xABCD;
+    uint8_t token[2] = {0xDA, 0xEC};
+    uint8_t keys[CONFIG_NANOCOAP_CACHE_ENTRIES + 3][CONFIG_NANOCOAP_CACHE_KEY_LENGTH];
+    nanocoap_cache_entry_t *ces[CONFIG_NANOCOAP_CACHE_ENTRIES + 3];
+    const unsigned hit = CONFIG_NANOCOAP_CACHE_ENTRIES / 2;
+    size_t len;
+
+    nanocoap_cache_init();
+
+    len = coap_build_hdr((coap_hdr_t *)&rbuf[0], COAP_TYPE_NON,
+                         &token[0], 2, COAP_CODE_205, msgid);
+    coap_pkt_init(&resp, &rbuf[0], sizeof(rbuf), len);
+    coap_opt_finish(&resp, COAP_OPT_FINISH_NONE);
+
+    memset(keys, 0, sizeof(keys));
+    for (unsigned i = 0; i < ARRAY_SIZE(keys); i++) {
+        keys[i][0] = i + 1;
+    }
+    for (unsigned i = 0; i < CONFIG_NANOCOAP_CACHE_ENTRIES; i++) {
+        ces[i] = nanocoap_cache_add_by_key(keys[i], COAP_METHOD_GET,
+                                           &resp, coap_get_total_len(&resp));
+        TEST_ASSERT_NOT_NULL(ces[i]);
+    }
+
+    /* hit an entry in the middle of the list, delete another one */
+    TEST_ASSERT(ces[hit] == nanocoap_cache_key_lookup(keys[hit]));
+    TEST_ASSERT_EQUAL_INT(0, nanocoap_cache_del(ces[1]));
+    TEST_ASSERT_EQUAL_INT(-1, nanocoap_cache_del(ces[1]));
+    TEST_ASSERT_EQUAL_INT(CONFIG_NANOCOAP_CACHE_ENTRIES - 1,
+                          nanocoap_cache_used_count());
+
+    /* the first new entry takes the deleted one, the others replace the least
+     * recently used entries, skipping the deleted and the hit one */
+    for (unsigned i = CONFIG_NANOCOAP_CACHE_ENTRIES; i < ARRAY_SIZE(keys); i++) {
+        ces[i] = nanocoap_cache_add_by_key(keys[i], COAP_METHOD_GET,
+                                           &resp, coap_get_total_len(&resp));
+        TEST_ASSERT_NOT_NULL(ces[i]);
+    }
+    TEST_ASSERT_EQUAL_INT(CONFIG_NANOCOAP_CACHE_ENTRIES,
+                          nanocoap_cache_used_count());
+    TEST_ASSERT_EQUAL_INT(0, nanocoap_cache_free_count());
+    TEST_ASSERT_NULL(nanocoap_cache_key_lookup(keys[0]));
+    TEST_ASSERT_NULL(nanocoap_cache_key_lookup(keys[2]));
+    for (unsigned i = 3; i < ARRAY_SIZE(keys); i++) {
+        TEST_ASSERT(ces[i] == nanocoap_cache_key_lookup(keys[i]));
+    }
+}
+
 static void test_nanocoap_cache__max_age(void)
 {
     uint8_t buf[_BUF_SIZE];
@@ -316,6 +411,8 @@ Test *tests_nanocoap_cache_tests(void)
     EMB_UNIT_TESTFIXTURES(fixtures) {
         new_TestFixture(test_nanocoap_cache__add),
         new_TestFixture(test_nanocoap_cache__del),
+        new_TestFixture(test_nanocoap_cache__colliding_keys),
+        new_TestFixture(test_nanocoap_cache__lru),
         new_TestFixture(test_nanocoap_cache__cachekey),
         new_TestFixture(test_nanocoap_cache__cachekey_blockwise),
         new_TestFixture(test_nanocoap_cache__max_age),
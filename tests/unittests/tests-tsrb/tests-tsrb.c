@@ -213,6 +213,99 @@ static void test_add(void)
     }
 }
 
+static void test_add_get_wrap(void)
+{
+    for (int i = 0; i < (int)sizeof(_io_buffer); i++) {
+        _io_buffer[i] = TEST_INPUT + i;
+    }
+    /* move read and write position to the middle of the buffer */
+    TEST_ASSERT_EQUAL_INT(BUFFER_SIZE / 2 + 1,
+                          tsrb_add(&_tsrb, _io_buffer, BUFFER_SIZE / 2 + 1));
+    TEST_ASSERT_EQUAL_INT(BUFFER_SIZE / 2 + 1,
+                          tsrb_drop(&_tsrb, BUFFER_SIZE));
+
+    TEST_ASSERT_EQUAL_INT(BUFFER_SIZE, tsrb_add(&_tsrb, _io_buffer,
+                                                sizeof(_io_buffer)));
+    TEST_ASSERT_EQUAL_INT(TEST_INPUT, tsrb_peek_one(&_tsrb));
+    memset(_io_buffer, IO_BUFFER_CANARY, sizeof(_io_buffer));
+    TEST_ASSERT_EQUAL_INT(BUFFER_SIZE, tsrb_peek(&_tsrb, _io_buffer,
+                                                 sizeof(_io_buffer)));
+    for (int i = 0; i < BUFFER_SIZE; i++) {
+        TEST_ASSERT_EQUAL_INT((uint8_t)(TEST_INPUT + i), _io_buffer[i]);
+    }
+    memset(_io_buffer, IO_BUFFER_CANARY, sizeof(_io_buffer));
+    TEST_ASSERT_EQUAL_INT(BUFFER_SIZE, tsrb_get(&_tsrb, _io_buffer,
+                                                sizeof(_io_buffer)));
+    for (int i = 0; i < BUFFER_SIZE; i++) {
+        TEST_ASSERT_EQUAL_INT((uint8_t)(TEST_INPUT + i), _io_buffer[i]);
+    }
+    TEST_ASSERT_EQUAL_INT(IO_BUFFER_CANARY, _io_buffer[BUFFER_SIZE]);
+    TEST_ASSERT_EQUAL_INT(1, tsrb_empty(&_tsrb));
+}
+
+static void test_peek_region(void)
+{
+    uint8_t *region;
+
+    TEST_ASSERT_EQUAL_INT(0, tsrb_peek_region(&_tsrb, &region));
+    TEST_ASSERT_EQUAL_INT(0, tsrb_consume(&_tsrb, 1));
+
+    /* start reading at the last byte of the buffer */
+    for (int i = 0; i < BUFFER_SIZE - 1; i++) {
+        TEST_ASSERT_EQUAL_INT(0, tsrb_add_one(&_tsrb, TEST_INPUT));
+    }
+    TEST_ASSERT_EQUAL_INT(BUFFER_SIZE - 1, tsrb_drop(&_tsrb, BUFFER_SIZE));
+    for (int i = 0; i < (int)TEST_DROP_NUM; i++) {
+        TEST_ASSERT_EQUAL_INT(0, tsrb_add_one(&_tsrb, TEST_INPUT + i));
+    }
+
+    TEST_ASSERT_EQUAL_INT(1, tsrb_peek_region(&_tsrb, &region));
+    TEST_ASSERT(region == &_tsrb_buffer[BUFFER_SIZE - 1]);
+    TEST_ASSERT_EQUAL_INT(TEST_INPUT, *region);
+    TEST_ASSERT_EQUAL_INT(1, tsrb_consume(&_tsrb, 1));
+
+    TEST_ASSERT_EQUAL_INT(TEST_DROP_NUM - 1,
+                          tsrb_peek_region(&_tsrb, &region));
+    TEST_ASSERT(region == &_tsrb_buffer[0]);
+    for (int i = 0; i < (int)(TEST_DROP_NUM - 1); i++) {
+        TEST_ASSERT_EQUAL_INT(TEST_INPUT + 1 + i, region[i]);
+    }
+    TEST_ASSERT_EQUAL_INT(TEST_DROP_NUM - 1,
+                          tsrb_consume(&_tsrb, sizeof(_io_buffer)));
+    TEST_ASSERT_EQUAL_INT(1, tsrb_empty(&_tsrb));
+}
+
+static void test_reserve_region(void)
+{
+    uint8_t *region;
+
+    TEST_ASSERT_EQUAL_INT(BUFFER_SIZE, tsrb_reserve_region(&_tsrb, &region));
+    TEST_ASSERT(region == &_tsrb_buffer[0]);
+
+    /* start writing at the last byte of the buffer */
+    TEST_ASSERT_EQUAL_INT(BUFFER_SIZE - 1, tsrb_commit(&_tsrb, BUFFER_SIZE - 1));
+    TEST_ASSERT_EQUAL_INT(BUFFER_SIZE - 1, tsrb_drop(&_tsrb, BUFFER_SIZE));
+
+    TEST_ASSERT_EQUAL_INT(1, tsrb_reserve_region(&_tsrb, &region));
+    TEST_ASSERT(region == &_tsrb_buffer[BUFFER_SIZE - 1]);
+    *region = TEST_INPUT;
+    TEST_ASSERT_EQUAL_INT(1, tsrb_commit(&_tsrb, 1));
+
+    TEST_ASSERT_EQUAL_INT(BUFFER_SIZE - 1, tsrb_reserve_region(&_tsrb, &region));
+    TEST_ASSERT(region == &_tsrb_buffer[0]);
+    for (int i = 0; i < BUFFER_SIZE - 1; i++) {
+        region[i] = TEST_INPUT + 1 + i;
+    }
+    TEST_ASSERT_EQUAL_INT(BUFFER_SIZE - 1,
+                          tsrb_commit(&_tsrb, sizeof(_io_buffer)));
+    TEST_ASSERT_EQUAL_INT(1, tsrb_full(&_tsrb));
+    TEST_ASSERT_EQUAL_INT(0, tsrb_reserve_region(&_tsrb, &region));
+
+    for (int i = 0; i < BUFFER_SIZE; i++) {
+        TEST_ASSERT_EQUAL_INT((uint8_t)(TEST_INPUT + i), tsrb_get_one(&_tsrb));
+    }
+}
+
 static Test *tests_tsrb_tests(void)
 {
     EMB_UNIT_TESTFIXTURES(fixtures) {
@@ -228,6 +321,9 @@ static Test *tests_tsrb_tests(void)
         new_TestFixture(test_drop),
         new_TestFixture(test_add_one),
         new_TestFixture(test_add),
+        new_TestFixture(test_add_get_wrap),
+        new_TestFixture(test_peek_region),
+        new_TestFixture(test_reserve_region),
     };
 
     EMB_UNIT_TESTCALLER(tsrb_tests, NULL, tear_down, fixtures);
@@ -0,0 +1,175 @@
+/*
+ * Copyright (C) 2026 Mesotic SAS
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @{
+ *
+ * @file
+ * @brief       Unittests for ztimer wakeup coalescing
+ */
+
+#include "ztimer.h"
+#include "ztimer/mock.h"
+
+#include "embUnit/embUnit.h"
+
+#include "tests-ztimer.h"
+
+typedef struct {
+    ztimer_mock_t *mock;
+    uint32_t fired_at;
+    unsigned count;
+} fire_t;
+
+static ztimer_mock_t zmock;
+static ztimer_clock_t *z = &zmock.super;
+
+static void cb_fire(void *arg)
+{
+    fire_t *fire = arg;
+
+    fire->fired_at = fire->mock->now;
+    fire->count++;
+}
+
+static void setup(void)
+{
+    ztimer_mock_init(&zmock, 32);
+}
+
+static void test_ztimer_slack_end_of_window(void)
+{
+    fire_t fire = { .mock = &zmock };
+    ztimer_t t = { .callback = cb_fire, .arg = &fire };
+
+    ztimer_set_slack(z, &t, 100, 50);
+    ztimer_mock_advance(&zmock, 149);
+    TEST_ASSERT_EQUAL_INT(0, fire.count);
+    ztimer_mock_advance(&zmock, 1);
+    TEST_ASSERT_EQUAL_INT(1, fire.count);
+    TEST_ASSERT_EQUAL_INT(150, fire.fired_at);
+    TEST_ASSERT_EQUAL_INT(0, z->slack_stats.coalesced);
+}
+
+static void test_ztimer_slack_join(void)
+{
+    fire_t fire_a = { .mock = &zmock };
+    fire_t fire_b = { .mock = &zmock };
+    ztimer_t a = { .callback = cb_fire, .arg = &fire_a };
+    ztimer_t b = { .callback = cb_fire, .arg = &fire_b };
+
+    ztimer_set(z, &a, 1000);
+    ztimer_set_slack(z, &b, 900, 200);
+    TEST_ASSERT_EQUAL_INT(1, z->slack_stats.coalesced);
+    ztimer_mock_advance(&zmock, 999);
+    TEST_ASSERT_EQUAL_INT(0, fire_a.count + fire_b.count);
+    ztimer_mock_advance(&zmock, 1);
+    TEST_ASSERT_EQUAL_INT(1, fire_a.count);
+    TEST_ASSERT_EQUAL_INT(1, fire_b.count);
+    TEST_ASSERT_EQUAL_INT(1000, fire_b.fired_at);
+    TEST_ASSERT_EQUAL_INT(2, z->slack_stats.fired);
+    TEST_ASSERT_EQUAL_INT(1, z->slack_stats.wakeups);
+}
+
+static void test_ztimer_slack_pull(void)
+{
+    fire_t fire_a = { .mock = &zmock };
+    fire_t fire_b = { .mock = &zmock };
+    fire_t fire_c = { .mock = &zmock };
+    ztimer_t a = { .callback = cb_fire, .arg = &fire_a };
+    ztimer_t b = { .callback = cb_fire, .arg = &fire_b };
+    ztimer_t c = { .callback = cb_fire, .arg = &fire_c };
+
+    /* a goes to 500, b pulls it to 300 */
+    ztimer_set_slack(z, &a, 100, 400);
+    ztimer_set_slack(z, &b, 200, 100);
+    TEST_ASSERT_EQUAL_INT(1, z->slack_stats.coalesced);
+    /* c is exact and pulls nothing, as a cannot go before 100 */
+    ztimer_set(z, &c, 50);
+    TEST_ASSERT_EQUAL_INT(1, z->slack_stats.coalesced);
+    ztimer_mock_advance(&zmock, 299);
+    TEST_ASSERT_EQUAL_INT(1, fire_c.count);
+    TEST_ASSERT_EQUAL_INT(0, fire_a.count + fire_b.count);
+    ztimer_mock_advance(&zmock, 1);
+    TEST_ASSERT_EQUAL_INT(300, fire_a.fired_at);
+    TEST_ASSERT_EQUAL_INT(300, fire_b.fired_at);
+    TEST_ASSERT_EQUAL_INT(3, z->slack_stats.fired);
+    TEST_ASSERT_EQUAL_INT(2, z->slack_stats.wakeups);
+}
+
+static void test_ztimer_slack_exact_pulls(void)
+{
+    fire_t fire_a = { .mock = &zmock };
+    fire_t fire_b = { .mock = &zmock };
+    ztimer_t a = { .callback = cb_fire, .arg = &fire_a };
+    ztimer_t b = { .callback = cb_fire, .arg = &fire_b };
+
+    ztimer_set_slack(z, &a, 100, 400);
+    ztimer_mock_advance(&zmock, 100);
+    /* a may still move back to now */
+    ztimer_set(z, &b, 250);
+    TEST_ASSERT_EQUAL_INT(1, z->slack_stats.coalesced);
+    ztimer_mock_advance(&zmock, 250);
+    TEST_ASSERT_EQUAL_INT(350, fire_a.fired_at);
+    TEST_ASSERT_EQUAL_INT(350, fire_b.fired_at);
+    TEST_ASSERT_EQUAL_INT(1, z->slack_stats.wakeups);
+}
+
+static void test_ztimer_slack_disjoint(void)
+{
+    fire_t fire_a = { .mock = &zmock };
+    fire_t fire_b = { .mock = &zmock };
+    ztimer_t a = { .callback = cb_fire, .arg = &fire_a };
+    ztimer_t b = { .callback = cb_fire, .arg = &fire_b };
+
+    ztimer_set_slack(z, &a, 100, 50);
+    ztimer_set_slack(z, &b, 200, 50);
+    TEST_ASSERT_EQUAL_INT(0, z->slack_stats.coalesced);
+    ztimer_mock_advance(&zmock, 300);
+    TEST_ASSERT_EQUAL_INT(150, fire_a.fired_at);
+    TEST_ASSERT_EQUAL_INT(250, fire_b.fired_at);
+    TEST_ASSERT_EQUAL_INT(2, z->slack_stats.wakeups);
+}
+
+static void test_ztimer_slack_remove(void)
+{
+    fire_t fire_a = { .mock = &zmock };
+    fire_t fire_b = { .mock = &zmock };
+    ztimer_t a = { .callback = cb_fire, .arg = &fire_a };
+    ztimer_t b = { .callback = cb_fire, .arg = &fire_b };
+
+    ztimer_set_slack(z, &a, 100, 100);
+    ztimer_set_slack(z, &b, 150, 100);
+    TEST_ASSERT_EQUAL_INT(1, z->slack_stats.coalesced);
+    TEST_ASSERT(ztimer_remove(z, &a));
+    TEST_ASSERT(ztimer_is_set(z, &b));
+    ztimer_mock_advance(&zmock, 199);
+    TEST_ASSERT_EQUAL_INT(0, fire_b.count);
+    ztimer_mock_advance(&zmock, 1);
+    TEST_ASSERT_EQUAL_INT(0, fire_a.count);
+    TEST_ASSERT_EQUAL_INT(1, fire_b.count);
+    TEST_ASSERT_EQUAL_INT(200, fire_b.fired_at);
+}
+
+Test *tests_ztimer_slack_tests(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture(test_ztimer_slack_end_of_window),
+        new_TestFixture(test_ztimer_slack_join),
+        new_TestFixture(test_ztimer_slack_pull),
+        new_TestFixture(test_ztimer_slack_exact_pulls),
+        new_TestFixture(test_ztimer_slack_disjoint),
+        new_TestFixture(test_ztimer_slack_remove),
+    };
+
+    EMB_UNIT_TESTCALLER(ztimer_tests, setup, NULL, fixtures);
+
+    return (Test *)&ztimer_tests;
+}
+
+/** @} */